@@ -0,0 +1,196 @@
+#pragma once
+// ============================================================================
+// Arduino stand-in for the host (env:native)
+// ============================================================================
+// Only what the clock sources actually use. Time is virtual: millis() and
+// micros() return whatever the driver has advanced the clock to, and delay()
+// advances it, so stalls show up in the simulation instead of in wall time.
+// ============================================================================
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using std::max;
+using std::min;
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+// ============================================================================
+// Virtual Clock
+// ============================================================================
+inline uint64_t nativeClockMicros = 0;
+
+inline void nativeSetMillis(uint64_t ms) { nativeClockMicros = ms * 1000; }
+inline void nativeAdvanceMicros(uint64_t us) { nativeClockMicros += us; }
+inline void nativeAdvanceMillis(uint64_t ms) { nativeClockMicros += ms * 1000; }
+
+// Truncated to 32 bits like on the ESP32, so wraparound behaves the same
+inline unsigned long millis() {
+  return (uint32_t)(nativeClockMicros / 1000);
+}
+inline unsigned long micros() { return (uint32_t)nativeClockMicros; }
+inline void delay(unsigned long ms) { nativeAdvanceMillis(ms); }
+inline void delayMicroseconds(unsigned int us) { nativeAdvanceMicros(us); }
+inline void yield() {}
+
+// CPU clock, only recorded (power.h lowers it while the display is off)
+inline uint32_t nativeCpuMhz = 160;
+inline uint32_t getCpuFrequencyMhz() { return nativeCpuMhz; }
+inline bool setCpuFrequencyMhz(uint32_t mhz) {
+  nativeCpuMhz = mhz;
+  return true;
+}
+
+// ============================================================================
+// Math Helpers
+// ============================================================================
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+template <typename T, typename L, typename H>
+inline T constrain(T x, L low, H high) {
+  return x < low ? low : (x > high ? high : x);
+}
+
+// Deterministic PRNG (xorshift32) so runs are reproducible
+inline uint32_t nativeRandomState = 0x12345678;
+
+inline void randomSeed(unsigned long seed) {
+  nativeRandomState = seed ? (uint32_t)seed : 0x12345678;
+}
+
+inline uint32_t nativeRandom32() {
+  uint32_t x = nativeRandomState;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return nativeRandomState = x;
+}
+
+inline long random(long howBig) {
+  if (howBig <= 0)
+    return 0;
+  return nativeRandom32() % howBig;
+}
+
+inline long random(long howSmall, long howBig) {
+  if (howSmall >= howBig)
+    return howSmall;
+  return random(howBig - howSmall) + howSmall;
+}
+
+// ============================================================================
+// String
+// ============================================================================
+class String {
+private:
+  std::string s;
+
+public:
+  String() {}
+  String(const char *c) : s(c ? c : "") {}
+  String(const std::string &str) : s(str) {}
+  String(char c) : s(1, c) {}
+  String(int v) : s(std::to_string(v)) {}
+  String(unsigned int v) : s(std::to_string(v)) {}
+  String(long v) : s(std::to_string(v)) {}
+  String(unsigned long v) : s(std::to_string(v)) {}
+
+  const char *c_str() const { return s.c_str(); }
+  unsigned int length() const { return s.length(); }
+  long toInt() const { return strtol(s.c_str(), nullptr, 10); }
+
+  String &operator+=(const String &o) {
+    s += o.s;
+    return *this;
+  }
+  friend String operator+(const String &a, const String &b) {
+    return String(a.s + b.s);
+  }
+  friend String operator+(const String &a, const char *b) {
+    return String(a.s + b);
+  }
+  friend String operator+(const char *a, const String &b) {
+    return String(a + b.s);
+  }
+  bool operator==(const String &o) const { return s == o.s; }
+  bool operator==(const char *o) const { return s == o; }
+  bool operator!=(const String &o) const { return s != o.s; }
+};
+
+// ============================================================================
+// Print
+// ============================================================================
+// Byte sink base class (AsyncResponseStream on the device)
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+      n += write(*buffer++);
+    }
+    return n;
+  }
+};
+
+// ============================================================================
+// ESP
+// ============================================================================
+class EspClass {
+public:
+  uint32_t getFreeHeap() const { return 200000; }
+};
+
+inline EspClass ESP;
+
+// ============================================================================
+// Serial
+// ============================================================================
+// Set Serial.muted to keep log output out of benchmark timings.
+class HardwareSerial {
+public:
+  bool muted = false;
+
+  void begin(unsigned long) {}
+  void flush() { fflush(stdout); }
+
+  size_t printf(const char *fmt, ...) {
+    if (muted)
+      return 0;
+    va_list args;
+    va_start(args, fmt);
+    int n = vprintf(fmt, args);
+    va_end(args);
+    return n < 0 ? 0 : n;
+  }
+
+  size_t print(const char *s) { return printf("%s", s); }
+  size_t print(const String &s) { return printf("%s", s.c_str()); }
+  size_t print(char c) { return printf("%c", c); }
+  size_t print(long v) { return printf("%ld", v); }
+  size_t print(unsigned long v) { return printf("%lu", v); }
+  size_t print(int v) { return printf("%d", v); }
+  size_t print(unsigned int v) { return printf("%u", v); }
+  size_t print(double v) { return printf("%.2f", v); }
+
+  size_t println() { return printf("\n"); }
+  template <typename T> size_t println(const T &v) {
+    size_t n = print(v);
+    return n + println();
+  }
+};
+
+inline HardwareSerial Serial;
@@ -0,0 +1,17 @@
+#pragma once
+// ESPmDNS stand-in for the host (env:native)
+#include <Arduino.h>
+
+class MDNSResponder {
+public:
+  bool running = false;
+
+  bool begin(const char *) {
+    running = true;
+    return true;
+  }
+  void end() { running = false; }
+  bool addService(const char *, const char *, uint16_t) { return true; }
+};
+
+inline MDNSResponder MDNS;
@@ -0,0 +1,454 @@
+#pragma once
+// ============================================================================
+// FastLED stand-in for the host (env:native)
+// ============================================================================
+// Ports of the FastLED 3.9 routines the clock uses (lib8tion math, rainbow
+// HSV conversion, fill_gradient, blend), bit-exact with the library's default
+// FASTLED_SCALE8_FIXED / FASTLED_BLEND_FIXED build. show() only counts frames;
+// there is no SPI on the host. encodeAPA102() reproduces what the library's
+// APA102 controller clocks out per LED (no dithering), as a reference.
+// ============================================================================
+#include <Arduino.h>
+
+#include <vector>
+
+typedef uint8_t fract8;
+typedef int16_t saccum87;
+typedef uint16_t accum88;
+
+// ============================================================================
+// lib8tion
+// ============================================================================
+inline uint8_t scale8(uint8_t i, fract8 scale) {
+  return (((uint16_t)i) * (1 + (uint16_t)scale)) >> 8;
+}
+
+inline uint8_t scale8_video(uint8_t i, fract8 scale) {
+  return (((int)i * (int)scale) >> 8) + ((i && scale) ? 1 : 0);
+}
+
+inline uint8_t qadd8(uint8_t i, uint8_t j) {
+  unsigned int t = i + j;
+  return t > 255 ? 255 : t;
+}
+
+inline uint8_t qsub8(uint8_t i, uint8_t j) {
+  int t = i - j;
+  return t < 0 ? 0 : t;
+}
+
+inline uint8_t blend8(uint8_t a, uint8_t b, uint8_t amountOfB) {
+  uint16_t partial = (a << 8) | b;
+  partial += (b * amountOfB);
+  partial -= (a * amountOfB);
+  return partial >> 8;
+}
+
+inline uint8_t triwave8(uint8_t in) {
+  if (in & 0x80) {
+    in = 255 - in;
+  }
+  return in << 1;
+}
+
+inline uint8_t ease8InOutQuad(uint8_t i) {
+  uint8_t j = i;
+  if (j & 0x80) {
+    j = 255 - j;
+  }
+  uint8_t jj = scale8(j, j);
+  uint8_t jj2 = jj << 1;
+  if (i & 0x80) {
+    jj2 = 255 - jj2;
+  }
+  return jj2;
+}
+
+inline uint8_t quadwave8(uint8_t in) { return ease8InOutQuad(triwave8(in)); }
+
+inline uint16_t rand16seed = 1337;
+
+inline void random16_set_seed(uint16_t seed) { rand16seed = seed; }
+
+inline uint16_t random16() {
+  rand16seed = (rand16seed * 2053) + 13849;
+  return rand16seed;
+}
+
+inline uint8_t random8() {
+  random16();
+  return (uint8_t)(((uint8_t)(rand16seed & 0xFF)) +
+                   ((uint8_t)(rand16seed >> 8)));
+}
+
+inline uint8_t random8(uint8_t lim) { return (random8() * lim) >> 8; }
+
+inline uint8_t random8(uint8_t min, uint8_t lim) {
+  return random8(lim - min) + min;
+}
+
+// ============================================================================
+// Colour Types
+// ============================================================================
+struct CHSV {
+  union {
+    struct {
+      union {
+        uint8_t hue;
+        uint8_t h;
+      };
+      union {
+        uint8_t saturation;
+        uint8_t sat;
+        uint8_t s;
+      };
+      union {
+        uint8_t value;
+        uint8_t val;
+        uint8_t v;
+      };
+    };
+    uint8_t raw[3];
+  };
+
+  CHSV() : h(0), s(0), v(0) {}
+  CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+};
+
+struct CRGB;
+void hsv2rgb_rainbow(const CHSV &hsv, CRGB &rgb);
+
+struct CRGB {
+  union {
+    struct {
+      union {
+        uint8_t r;
+        uint8_t red;
+      };
+      union {
+        uint8_t g;
+        uint8_t green;
+      };
+      union {
+        uint8_t b;
+        uint8_t blue;
+      };
+    };
+    uint8_t raw[3];
+  };
+
+  enum HTMLColorCode {
+    Black = 0x000000,
+    White = 0xFFFFFF,
+  };
+
+  CRGB() : r(0), g(0), b(0) {}
+  CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+  CRGB(uint32_t colorcode)
+      : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF),
+        b(colorcode & 0xFF) {}
+  CRGB(HTMLColorCode colorcode) : CRGB((uint32_t)colorcode) {}
+  CRGB(const CHSV &rhs) { hsv2rgb_rainbow(rhs, *this); }
+
+  CRGB &operator=(const CHSV &rhs) {
+    hsv2rgb_rainbow(rhs, *this);
+    return *this;
+  }
+
+  uint8_t &operator[](uint8_t x) { return raw[x]; }
+  const uint8_t &operator[](uint8_t x) const { return raw[x]; }
+
+  CRGB &nscale8(uint8_t scaledown) {
+    uint16_t scale_fixed = scaledown + 1;
+    r = (((uint16_t)r) * scale_fixed) >> 8;
+    g = (((uint16_t)g) * scale_fixed) >> 8;
+    b = (((uint16_t)b) * scale_fixed) >> 8;
+    return *this;
+  }
+
+  CRGB &fadeToBlackBy(uint8_t fadefactor) { return nscale8(255 - fadefactor); }
+
+  bool operator==(const CRGB &o) const {
+    return r == o.r && g == o.g && b == o.b;
+  }
+  bool operator!=(const CRGB &o) const { return !(*this == o); }
+};
+
+// ============================================================================
+// Colour Conversion & Fills
+// ============================================================================
+inline void hsv2rgb_rainbow(const CHSV &hsv, CRGB &rgb) {
+  uint8_t hue = hsv.hue;
+  uint8_t sat = hsv.sat;
+  uint8_t val = hsv.val;
+
+  uint8_t offset8 = (hue & 0x1F) << 3;
+  uint8_t third = scale8(offset8, (256 / 3));
+  uint8_t r, g, b;
+
+  if (!(hue & 0x80)) {
+    if (!(hue & 0x40)) {
+      if (!(hue & 0x20)) {
+        r = 255 - third; // R -> O
+        g = third;
+        b = 0;
+      } else {
+        r = 171; // O -> Y
+        g = 85 + third;
+        b = 0;
+      }
+    } else {
+      if (!(hue & 0x20)) {
+        uint8_t twothirds = scale8(offset8, ((256 * 2) / 3));
+        r = 171 - twothirds; // Y -> G
+        g = 170 + third;
+        b = 0;
+      } else {
+        r = 0; // G -> A
+        g = 255 - third;
+        b = third;
+      }
+    }
+  } else {
+    if (!(hue & 0x40)) {
+      if (!(hue & 0x20)) {
+        r = 0; // A -> B
+        uint8_t twothirds = scale8(offset8, ((256 * 2) / 3));
+        g = 171 - twothirds;
+        b = 85 + twothirds;
+      } else {
+        r = third; // B -> P
+        g = 0;
+        b = 255 - third;
+      }
+    } else {
+      if (!(hue & 0x20)) {
+        r = 85 + third; // P -> K
+        g = 0;
+        b = 171 - third;
+      } else {
+        r = 170 + third; // K -> R
+        g = 0;
+        b = 85 - third;
+      }
+    }
+  }
+
+  if (sat != 255) {
+    if (sat == 0) {
+      r = 255;
+      b = 255;
+      g = 255;
+    } else {
+      uint8_t desat = 255 - sat;
+      desat = scale8_video(desat, desat);
+      uint8_t satscale = 255 - desat;
+      r = scale8(r, satscale);
+      g = scale8(g, satscale);
+      b = scale8(b, satscale);
+      r += desat;
+      g += desat;
+      b += desat;
+    }
+  }
+
+  if (val != 255) {
+    val = scale8_video(val, val);
+    if (val == 0) {
+      r = 0;
+      g = 0;
+      b = 0;
+    } else {
+      r = scale8(r, val);
+      g = scale8(g, val);
+      b = scale8(b, val);
+    }
+  }
+
+  rgb.r = r;
+  rgb.g = g;
+  rgb.b = b;
+}
+
+enum TGradientDirectionCode {
+  FORWARD_HUES,
+  BACKWARD_HUES,
+  SHORTEST_HUES,
+  LONGEST_HUES
+};
+
+inline void fill_gradient(CHSV *targetArray, uint16_t startpos,
+                          CHSV startcolor, uint16_t endpos, CHSV endcolor,
+                          TGradientDirectionCode directionCode = SHORTEST_HUES) {
+  if (endpos < startpos) {
+    uint16_t t = endpos;
+    CHSV tc = endcolor;
+    endcolor = startcolor;
+    endpos = startpos;
+    startpos = t;
+    startcolor = tc;
+  }
+
+  if (endcolor.value == 0 || endcolor.saturation == 0) {
+    endcolor.hue = startcolor.hue;
+  }
+  if (startcolor.value == 0 || startcolor.saturation == 0) {
+    startcolor.hue = endcolor.hue;
+  }
+
+  saccum87 huedistance87;
+  saccum87 satdistance87 = (endcolor.sat - startcolor.sat) << 7;
+  saccum87 valdistance87 = (endcolor.val - startcolor.val) << 7;
+
+  uint8_t huedelta8 = endcolor.hue - startcolor.hue;
+
+  if (directionCode == SHORTEST_HUES) {
+    directionCode = FORWARD_HUES;
+    if (huedelta8 > 127) {
+      directionCode = BACKWARD_HUES;
+    }
+  }
+  if (directionCode == LONGEST_HUES) {
+    directionCode = FORWARD_HUES;
+    if (huedelta8 < 128) {
+      directionCode = BACKWARD_HUES;
+    }
+  }
+
+  if (directionCode == FORWARD_HUES) {
+    huedistance87 = huedelta8 << 7;
+  } else {
+    huedistance87 = (uint8_t)(256 - huedelta8) << 7;
+    huedistance87 = -huedistance87;
+  }
+
+  uint16_t pixeldistance = endpos - startpos;
+  int16_t divisor = pixeldistance ? pixeldistance : 1;
+
+  saccum87 huedelta87 = huedistance87 / divisor;
+  saccum87 satdelta87 = satdistance87 / divisor;
+  saccum87 valdelta87 = valdistance87 / divisor;
+
+  huedelta87 *= 2;
+  satdelta87 *= 2;
+  valdelta87 *= 2;
+
+  accum88 hue88 = startcolor.hue << 8;
+  accum88 sat88 = startcolor.sat << 8;
+  accum88 val88 = startcolor.val << 8;
+  for (uint16_t i = startpos; i <= endpos; ++i) {
+    targetArray[i] = CHSV(hue88 >> 8, sat88 >> 8, val88 >> 8);
+    hue88 += huedelta87;
+    sat88 += satdelta87;
+    val88 += valdelta87;
+  }
+}
+
+inline void fill_solid(CRGB *leds, int numToFill, const CRGB &color) {
+  for (int i = 0; i < numToFill; i++) {
+    leds[i] = color;
+  }
+}
+
+inline CRGB &nblend(CRGB &existing, const CRGB &overlay,
+                    fract8 amountOfOverlay) {
+  if (amountOfOverlay == 0) {
+    return existing;
+  }
+  if (amountOfOverlay == 255) {
+    existing = overlay;
+    return existing;
+  }
+  existing.red = blend8(existing.red, overlay.red, amountOfOverlay);
+  existing.green = blend8(existing.green, overlay.green, amountOfOverlay);
+  existing.blue = blend8(existing.blue, overlay.blue, amountOfOverlay);
+  return existing;
+}
+
+inline CRGB blend(const CRGB &p1, const CRGB &p2, fract8 amountOfP2) {
+  CRGB nu(p1);
+  nblend(nu, p2, amountOfP2);
+  return nu;
+}
+
+// ============================================================================
+// Controller
+// ============================================================================
+enum ESPIChipsets { APA102, SK9822 };
+enum EOrder { RGB = 0012, RBG = 0021, GRB = 0102, GBR = 0120, BRG = 0201, BGR = 0210 };
+enum LEDColorCorrection {
+  TypicalSMD5050 = 0xFFB0F0,
+  TypicalLEDStrip = 0xFFB0F0,
+  UncorrectedColor = 0xFFFFFF,
+};
+
+class CLEDController {
+public:
+  CRGB *leds = nullptr;
+  int numLeds = 0;
+  CRGB correction = CRGB(UncorrectedColor);
+
+  CLEDController &setCorrection(CRGB c) {
+    correction = c;
+    return *this;
+  }
+  CLEDController &setCorrection(LEDColorCorrection c) {
+    correction = CRGB((uint32_t)c);
+    return *this;
+  }
+  CLEDController &setDither(uint8_t) { return *this; }
+
+  // computeAdjustment(): correction scaled by brightness, temperature off
+  CRGB adjustment(uint8_t scale) const {
+    CRGB adj(0, 0, 0);
+    for (uint8_t i = 0; i < 3; i++) {
+      uint8_t cc = correction.raw[i];
+      if (scale > 0 && cc > 0) {
+        uint32_t work = (((uint32_t)cc) + 1) * 256 * scale;
+        adj.raw[i] = (work / 0x10000L) & 0xFF;
+      }
+    }
+    return adj;
+  }
+
+  // Per-LED APA102 bytes (0xE0 | 31, then BGR) for the registered LEDs
+  std::vector<uint8_t> encodeAPA102(uint8_t brightness = 255) const {
+    CRGB adj = adjustment(brightness);
+    std::vector<uint8_t> out;
+    out.reserve(numLeds * 4);
+    for (int i = 0; i < numLeds; i++) {
+      out.push_back(0xE0 | 31);
+      out.push_back(scale8(leds[i].b, adj.b));
+      out.push_back(scale8(leds[i].g, adj.g));
+      out.push_back(scale8(leds[i].r, adj.r));
+    }
+    return out;
+  }
+};
+
+class CFastLED {
+public:
+  CLEDController controller;
+  uint8_t brightness = 255;
+
+  // Host-side counters
+  uint32_t showCount = 0;
+  uint32_t showColorCount = 0;
+
+  template <ESPIChipsets CHIPSET, uint8_t DATA_PIN, uint8_t CLOCK_PIN,
+            EOrder RGB_ORDER>
+  CLEDController &addLeds(CRGB *data, int nLedsOrOffset) {
+    controller.leds = data;
+    controller.numLeds = nLedsOrOffset;
+    return controller;
+  }
+
+  void setBrightness(uint8_t scale) { brightness = scale; }
+  uint8_t getBrightness() { return brightness; }
+  void setDither(uint8_t) {}
+
+  void show() { showCount++; }
+  void showColor(const CRGB &) { showColorCount++; }
+};
+
+inline CFastLED FastLED;
@@ -0,0 +1,24 @@
+#pragma once
+// IPAddress stand-in for the host (env:native)
+#include <Arduino.h>
+
+class IPAddress {
+public:
+  IPAddress() : bytes{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : bytes{a, b, c, d} {}
+
+  uint8_t operator[](int i) const { return bytes[i]; }
+  bool operator==(const IPAddress &o) const {
+    return memcmp(bytes, o.bytes, 4) == 0;
+  }
+
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2],
+             bytes[3]);
+    return String(buf);
+  }
+
+private:
+  uint8_t bytes[4];
+};
@@ -0,0 +1,99 @@
+#pragma once
+// ============================================================================
+// Preferences (NVS) stand-in for the host (env:native)
+// ============================================================================
+// Keeps key/value blobs in memory and counts writes, so the settings code can
+// run and its flash traffic can be measured without a device.
+// ============================================================================
+#include <Arduino.h>
+
+#include <unordered_map>
+#include <vector>
+
+class Preferences {
+public:
+  // Host-side counters
+  uint32_t writes = 0;
+  uint32_t reads = 0;
+
+  bool begin(const char *, bool = false) { return true; }
+  void end() {}
+  bool clear() {
+    store.clear();
+    return true;
+  }
+  bool remove(const char *key) { return store.erase(key) > 0; }
+  bool isKey(const char *key) { return store.count(key) > 0; }
+
+  size_t putBool(const char *key, bool v) { return putRaw(key, &v, 1); }
+  size_t putUChar(const char *key, uint8_t v) { return putRaw(key, &v, 1); }
+  size_t putUShort(const char *key, uint16_t v) { return putRaw(key, &v, 2); }
+  size_t putUInt(const char *key, uint32_t v) { return putRaw(key, &v, 4); }
+  size_t putString(const char *key, const char *v) {
+    return putRaw(key, v, strlen(v) + 1);
+  }
+  size_t putString(const char *key, const String &v) {
+    return putString(key, v.c_str());
+  }
+  size_t putBytes(const char *key, const void *v, size_t len) {
+    return putRaw(key, v, len);
+  }
+
+  bool getBool(const char *key, bool def = false) {
+    return getScalar<uint8_t>(key, def) != 0;
+  }
+  uint8_t getUChar(const char *key, uint8_t def = 0) {
+    return getScalar<uint8_t>(key, def);
+  }
+  uint16_t getUShort(const char *key, uint16_t def = 0) {
+    return getScalar<uint16_t>(key, def);
+  }
+  uint32_t getUInt(const char *key, uint32_t def = 0) {
+    return getScalar<uint32_t>(key, def);
+  }
+  size_t getString(const char *key, char *value, size_t maxLen) {
+    auto it = find(key);
+    if (it == store.end() || maxLen == 0)
+      return 0;
+    size_t n = std::min(it->second.size(), maxLen);
+    memcpy(value, it->second.data(), n);
+    value[n - 1] = '\0';
+    return n;
+  }
+  size_t getBytesLength(const char *key) {
+    auto it = find(key);
+    return it == store.end() ? 0 : it->second.size();
+  }
+  size_t getBytes(const char *key, void *buf, size_t maxLen) {
+    auto it = find(key);
+    if (it == store.end() || it->second.size() > maxLen)
+      return 0;
+    memcpy(buf, it->second.data(), it->second.size());
+    return it->second.size();
+  }
+
+private:
+  std::unordered_map<std::string, std::vector<uint8_t>> store;
+
+  size_t putRaw(const char *key, const void *v, size_t len) {
+    writes++;
+    const uint8_t *p = (const uint8_t *)v;
+    store[key] = std::vector<uint8_t>(p, p + len);
+    return len;
+  }
+
+  std::unordered_map<std::string, std::vector<uint8_t>>::iterator
+  find(const char *key) {
+    reads++;
+    return store.find(key);
+  }
+
+  template <typename T> T getScalar(const char *key, T def) {
+    auto it = find(key);
+    if (it == store.end() || it->second.size() != sizeof(T))
+      return def;
+    T v;
+    memcpy(&v, it->second.data(), sizeof(T));
+    return v;
+  }
+};
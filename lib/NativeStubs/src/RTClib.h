@@ -0,0 +1,145 @@
+#pragma once
+// ============================================================================
+// RTClib stand-in for the host (env:native)
+// ============================================================================
+// DateTime is a port of RTClib's calendar math. RTC_DS1307 is a simulated
+// chip: it keeps a unix time anchored to the virtual millis() clock and counts
+// how many reads hit the "bus". driftPpm makes the chip run fast (> 0) or
+// slow (< 0) against the virtual clock.
+// ============================================================================
+#include <Arduino.h>
+
+#define SECONDS_FROM_1970_TO_2000 946684800
+
+class TimeSpan {
+public:
+  TimeSpan(int32_t seconds = 0) : _seconds(seconds) {}
+  TimeSpan(int16_t days, int8_t hours, int8_t minutes, int8_t seconds)
+      : _seconds((int32_t)days * 86400L + (int32_t)hours * 3600 +
+                 (int32_t)minutes * 60 + seconds) {}
+  int32_t totalseconds() const { return _seconds; }
+
+protected:
+  int32_t _seconds;
+};
+
+class DateTime {
+public:
+  DateTime(uint32_t t = SECONDS_FROM_1970_TO_2000) {
+    t -= SECONDS_FROM_1970_TO_2000;
+    ss = t % 60;
+    t /= 60;
+    mm = t % 60;
+    t /= 60;
+    hh = t % 24;
+    uint16_t days = t / 24;
+    uint8_t leap;
+    for (yOff = 0;; ++yOff) {
+      leap = yOff % 4 == 0;
+      if (days < 365U + leap)
+        break;
+      days -= 365 + leap;
+    }
+    for (m = 1; m < 12; ++m) {
+      uint8_t daysPerMonth = daysInMonth[m - 1];
+      if (leap && m == 2)
+        ++daysPerMonth;
+      if (days < daysPerMonth)
+        break;
+      days -= daysPerMonth;
+    }
+    d = days + 1;
+  }
+
+  DateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour = 0,
+           uint8_t min = 0, uint8_t sec = 0) {
+    if (year >= 2000U)
+      year -= 2000U;
+    yOff = year;
+    m = month;
+    d = day;
+    hh = hour;
+    mm = min;
+    ss = sec;
+  }
+
+  uint16_t year() const { return 2000U + yOff; }
+  uint8_t month() const { return m; }
+  uint8_t day() const { return d; }
+  uint8_t hour() const { return hh; }
+  uint8_t minute() const { return mm; }
+  uint8_t second() const { return ss; }
+
+  // 0 = Sunday
+  uint8_t dayOfTheWeek() const {
+    uint16_t day = date2days(yOff, m, d);
+    return (day + 6) % 7; // Jan 1, 2000 is a Saturday
+  }
+
+  uint32_t unixtime() const {
+    uint16_t days = date2days(yOff, m, d);
+    return (((uint32_t)days * 24 + hh) * 60 + mm) * 60 + ss +
+           SECONDS_FROM_1970_TO_2000;
+  }
+
+  DateTime operator+(const TimeSpan &span) const {
+    return DateTime(unixtime() + span.totalseconds());
+  }
+  DateTime operator-(const TimeSpan &span) const {
+    return DateTime(unixtime() - span.totalseconds());
+  }
+  TimeSpan operator-(const DateTime &right) const {
+    return TimeSpan(unixtime() - right.unixtime());
+  }
+
+protected:
+  uint8_t yOff, m, d, hh, mm, ss;
+
+  static constexpr uint8_t daysInMonth[] = {31, 28, 31, 30, 31, 30,
+                                            31, 31, 30, 31, 30};
+
+  static uint16_t date2days(uint16_t y, uint8_t m, uint8_t d) {
+    if (y >= 2000U)
+      y -= 2000U;
+    uint16_t days = d;
+    for (uint8_t i = 1; i < m; ++i)
+      days += daysInMonth[i - 1];
+    if (m > 2 && y % 4 == 0)
+      ++days;
+    return days + 365 * y + (y + 3) / 4 - 1;
+  }
+};
+
+class RTC_DS1307 {
+public:
+  // Simulation knobs
+  bool present = true;
+  bool running = true;
+  uint32_t nowReads = 0;
+  int32_t driftPpm = 0;
+
+  bool begin() { return present; }
+  bool isrunning() { return running; }
+
+  void adjust(const DateTime &dt) {
+    anchorUnix = dt.unixtime();
+    anchorMicros = nativeClockMicros;
+    running = true;
+  }
+
+  DateTime now() {
+    nowReads++;
+    return peek();
+  }
+
+  // The chip's time without counting a bus read
+  DateTime peek() const {
+    uint64_t elapsed = nativeClockMicros - anchorMicros;
+    uint64_t chipMicros = elapsed + (int64_t)elapsed * driftPpm / 1000000;
+    return DateTime(anchorUnix + (uint32_t)(chipMicros / 1000000));
+  }
+
+private:
+  uint32_t anchorUnix = SECONDS_FROM_1970_TO_2000;
+  uint64_t anchorMicros = 0;
+};
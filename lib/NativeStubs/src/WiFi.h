@@ -0,0 +1,163 @@
+#pragma once
+// ============================================================================
+// WiFi stand-in for the host (env:native)
+// ============================================================================
+// A scripted access point: begin() schedules the outcome of the attempt
+// (got IP after connectMs, or a NO_AP_FOUND disconnect after failMs, if the
+// network is out of range), and the driver delivers due events with
+// nativePoll(), as the WiFi event task would. nativeDropLink() simulates a
+// beacon timeout. Nothing here advances the virtual clock.
+// ============================================================================
+#include <Arduino.h>
+
+#include "IPAddress.h"
+
+typedef enum {
+  ARDUINO_EVENT_WIFI_STA_START,
+  ARDUINO_EVENT_WIFI_STA_CONNECTED,
+  ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+  ARDUINO_EVENT_WIFI_STA_GOT_IP,
+  ARDUINO_EVENT_WIFI_STA_LOST_IP,
+  ARDUINO_EVENT_WIFI_AP_START,
+  ARDUINO_EVENT_MAX
+} arduino_event_id_t;
+
+typedef struct {
+  uint8_t reason;
+} wifi_event_sta_disconnected_t;
+
+typedef union {
+  wifi_event_sta_disconnected_t wifi_sta_disconnected;
+} arduino_event_info_t;
+
+typedef arduino_event_id_t WiFiEvent_t;
+typedef arduino_event_info_t WiFiEventInfo_t;
+typedef void (*WiFiEventFuncCb)(arduino_event_id_t, arduino_event_info_t);
+
+#define WIFI_REASON_ASSOC_LEAVE 8
+#define WIFI_REASON_BEACON_TIMEOUT 200
+#define WIFI_REASON_NO_AP_FOUND 201
+
+typedef enum { WIFI_OFF, WIFI_STA, WIFI_AP, WIFI_AP_STA } wifi_mode_t;
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+class WiFiClass {
+public:
+  // Simulation knobs
+  bool apInRange = true;
+  uint32_t connectMs = 3000;
+  uint32_t failMs = 4000;
+
+  // Host-side counters
+  uint32_t begins = 0;
+  uint32_t modeChanges = 0;
+  uint32_t softAPs = 0;
+
+  int onEvent(WiFiEventFuncCb cb, arduino_event_id_t = ARDUINO_EVENT_MAX) {
+    callback = cb;
+    return 0;
+  }
+  bool persistent(bool) { return true; }
+  bool setAutoReconnect(bool) { return true; }
+
+  bool mode(wifi_mode_t m) {
+    if (m != currentMode) {
+      modeChanges++;
+      currentMode = m;
+    }
+    if (m != WIFI_STA && m != WIFI_AP_STA) {
+      drop(WIFI_REASON_ASSOC_LEAVE);
+    }
+    return true;
+  }
+  wifi_mode_t getMode() const { return currentMode; }
+
+  wl_status_t begin(const char *, const char * = nullptr) {
+    begins++;
+    linkStatus = WL_DISCONNECTED;
+    pending = apInRange ? ARDUINO_EVENT_WIFI_STA_GOT_IP
+                        : ARDUINO_EVENT_WIFI_STA_DISCONNECTED;
+    pendingReason = WIFI_REASON_NO_AP_FOUND;
+    pendingAt = nativeClockMicros + (apInRange ? connectMs : failMs) * 1000ULL;
+    return linkStatus;
+  }
+
+  bool disconnect(bool wifiOff = false, bool = false) {
+    drop(WIFI_REASON_ASSOC_LEAVE);
+    if (wifiOff) {
+      mode(WIFI_OFF);
+    }
+    return true;
+  }
+
+  wl_status_t status() const { return linkStatus; }
+  IPAddress localIP() const {
+    return linkStatus == WL_CONNECTED ? IPAddress(192, 168, 1, 42)
+                                      : IPAddress();
+  }
+
+  bool softAPConfig(IPAddress, IPAddress, IPAddress) { return true; }
+  bool softAP(const char *) {
+    softAPs++;
+    return true;
+  }
+  IPAddress softAPIP() const { return IPAddress(192, 168, 4, 1); }
+
+  // Deliver the attempt's outcome once it is due
+  void nativePoll() {
+    if (pending == ARDUINO_EVENT_MAX || nativeClockMicros < pendingAt) {
+      return;
+    }
+    arduino_event_id_t event = pending;
+    pending = ARDUINO_EVENT_MAX;
+    if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+      linkStatus = WL_CONNECTED;
+      raise(event, 0);
+    } else {
+      raise(event, pendingReason);
+    }
+  }
+
+  // The access point went away under a live link
+  void nativeDropLink() {
+    if (linkStatus == WL_CONNECTED) {
+      drop(WIFI_REASON_BEACON_TIMEOUT);
+    }
+  }
+
+  void nativeReset() { *this = WiFiClass(); }
+
+private:
+  WiFiEventFuncCb callback = nullptr;
+  wifi_mode_t currentMode = WIFI_OFF;
+  wl_status_t linkStatus = WL_IDLE_STATUS;
+  arduino_event_id_t pending = ARDUINO_EVENT_MAX;
+  uint8_t pendingReason = 0;
+  uint64_t pendingAt = 0;
+
+  void raise(arduino_event_id_t event, uint8_t reason) {
+    if (callback) {
+      arduino_event_info_t info;
+      info.wifi_sta_disconnected.reason = reason;
+      callback(event, info);
+    }
+  }
+
+  void drop(uint8_t reason) {
+    bool wasUp = linkStatus == WL_CONNECTED || pending != ARDUINO_EVENT_MAX;
+    pending = ARDUINO_EVENT_MAX;
+    linkStatus = WL_DISCONNECTED;
+    if (wasUp) {
+      raise(ARDUINO_EVENT_WIFI_STA_DISCONNECTED, reason);
+    }
+  }
+};
+
+inline WiFiClass WiFi;
@@ -0,0 +1,10 @@
+#pragma once
+// I2C stand-in for the host (env:native) - the simulated RTC needs no bus
+#include <Arduino.h>
+
+class TwoWire {
+public:
+  bool begin(int = -1, int = -1, uint32_t = 0) { return true; }
+};
+
+inline TwoWire Wire;
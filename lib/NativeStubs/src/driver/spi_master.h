@@ -0,0 +1,148 @@
+#pragma once
+// ============================================================================
+// ESP-IDF spi_master stand-in for the host (env:native)
+// ============================================================================
+// Simulates a DMA transfer queue against the virtual clock: a queued
+// transaction "takes" length / clock_speed_hz of simulated time and can only
+// be reaped with spi_device_get_trans_result() once that time has passed.
+//
+// To check buffer ownership the stub snapshots tx_buffer when a transaction
+// is queued and compares it when the transfer completes: any CPU write to a
+// buffer the DMA still owns is counted in nativeSpi.ownershipViolations.
+// ============================================================================
+#include <Arduino.h>
+#include <esp_err.h>
+
+#include <vector>
+
+typedef uint32_t TickType_t;
+#ifndef portMAX_DELAY
+#define portMAX_DELAY 0xFFFFFFFFUL
+#endif
+
+typedef enum { SPI1_HOST = 0, SPI2_HOST = 1, SPI3_HOST = 2 } spi_host_device_t;
+typedef enum { SPI_DMA_DISABLED = 0, SPI_DMA_CH_AUTO = 3 } spi_common_dma_t;
+
+struct spi_transaction_t {
+  uint32_t flags;
+  uint16_t cmd;
+  uint64_t addr;
+  size_t length;   // Total data length, in bits
+  size_t rxlength; // Total data length received, in bits
+  void *user;
+  const void *tx_buffer;
+  void *rx_buffer;
+};
+
+typedef void (*transaction_cb_t)(spi_transaction_t *trans);
+
+struct spi_bus_config_t {
+  int mosi_io_num;
+  int miso_io_num;
+  int sclk_io_num;
+  int quadwp_io_num;
+  int quadhd_io_num;
+  int max_transfer_sz;
+  uint32_t flags;
+  int intr_flags;
+};
+
+struct spi_device_interface_config_t {
+  uint8_t command_bits;
+  uint8_t address_bits;
+  uint8_t dummy_bits;
+  uint8_t mode;
+  int clock_speed_hz;
+  int spics_io_num;
+  uint32_t flags;
+  int queue_size;
+  transaction_cb_t pre_cb;
+  transaction_cb_t post_cb;
+};
+
+// Host-side state of the simulated bus
+struct NativeSpiState {
+  uint32_t slowdown = 1; // Multiply transfer time (to provoke overruns)
+  uint32_t queued = 0;
+  uint32_t completed = 0;
+  uint32_t ownershipViolations = 0;
+  uint64_t bytesWritten = 0;
+  std::vector<uint8_t> lastTransfer; // Bytes of the last completed transfer
+};
+
+inline NativeSpiState nativeSpi;
+
+struct NativeSpiDevice {
+  spi_device_interface_config_t config;
+  spi_transaction_t *inFlight = nullptr;
+  uint64_t doneAtMicros = 0;
+  std::vector<uint8_t> snapshot;
+};
+typedef NativeSpiDevice *spi_device_handle_t;
+
+inline esp_err_t spi_bus_initialize(spi_host_device_t,
+                                    const spi_bus_config_t *,
+                                    spi_common_dma_t) {
+  return ESP_OK;
+}
+
+inline esp_err_t
+spi_bus_add_device(spi_host_device_t, const spi_device_interface_config_t *cfg,
+                   spi_device_handle_t *handle) {
+  static NativeSpiDevice device;
+  device = NativeSpiDevice();
+  device.config = *cfg;
+  *handle = &device;
+  return ESP_OK;
+}
+
+// Only one transaction in flight is simulated (queue_size 1)
+inline esp_err_t spi_device_queue_trans(spi_device_handle_t handle,
+                                        spi_transaction_t *trans, TickType_t) {
+  if (handle->inFlight) {
+    return ESP_ERR_TIMEOUT;
+  }
+  size_t bytes = (trans->length + 7) / 8;
+  const uint8_t *tx = (const uint8_t *)trans->tx_buffer;
+  handle->snapshot.assign(tx, tx + bytes);
+  handle->inFlight = trans;
+  uint64_t micros = (uint64_t)trans->length * 1000000ULL /
+                    handle->config.clock_speed_hz * nativeSpi.slowdown;
+  handle->doneAtMicros = nativeClockMicros + micros;
+  nativeSpi.queued++;
+  return ESP_OK;
+}
+
+inline esp_err_t spi_device_get_trans_result(spi_device_handle_t handle,
+                                             spi_transaction_t **trans_desc,
+                                             TickType_t ticks_to_wait) {
+  if (!handle->inFlight) {
+    return ESP_ERR_TIMEOUT;
+  }
+  if (nativeClockMicros < handle->doneAtMicros) {
+    if (ticks_to_wait == 0) {
+      return ESP_ERR_TIMEOUT;
+    }
+    nativeClockMicros = handle->doneAtMicros; // Blocking wait
+  }
+
+  spi_transaction_t *t = handle->inFlight;
+  const uint8_t *tx = (const uint8_t *)t->tx_buffer;
+  if (memcmp(tx, handle->snapshot.data(), handle->snapshot.size()) != 0) {
+    nativeSpi.ownershipViolations++;
+  }
+  nativeSpi.lastTransfer = handle->snapshot;
+  nativeSpi.bytesWritten += handle->snapshot.size();
+  nativeSpi.completed++;
+  handle->inFlight = nullptr;
+
+  // The completion ISR fires when the transfer ends, not when it is reaped
+  if (handle->config.post_cb) {
+    uint64_t now = nativeClockMicros;
+    nativeClockMicros = handle->doneAtMicros;
+    handle->config.post_cb(t);
+    nativeClockMicros = now;
+  }
+  *trans_desc = t;
+  return ESP_OK;
+}
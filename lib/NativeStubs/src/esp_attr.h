@@ -0,0 +1,6 @@
+#pragma once
+// ESP-IDF placement attributes stand-in for the host (env:native)
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define WORD_ALIGNED_ATTR __attribute__((aligned(4)))
+#define DMA_ATTR WORD_ALIGNED_ATTR
@@ -0,0 +1,5 @@
+#pragma once
+// esp_timer stand-in for the host (env:native) - reads the virtual clock
+#include <Arduino.h>
+
+inline int64_t esp_timer_get_time() { return (int64_t)nativeClockMicros; }
@@ -0,0 +1,11 @@
+#pragma once
+// FreeRTOS base types stand-in for the host (env:native)
+#include <Arduino.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdPASS 1
+#define pdFAIL 0
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
@@ -0,0 +1,23 @@
+#pragma once
+// FreeRTOS task stand-in for the host (env:native)
+// A created task runs on its own detached thread. vTaskDelete() just
+// returns, so a task function must return right after calling it (as every
+// task in src/ does).
+#include "FreeRTOS.h"
+
+#include <thread>
+
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+inline BaseType_t xTaskCreate(TaskFunction_t task, const char *, uint32_t,
+                              void *arg, UBaseType_t, TaskHandle_t *handle) {
+  if (handle) {
+    *handle = nullptr;
+  }
+  std::thread(task, arg).detach();
+  return pdPASS;
+}
+
+inline void vTaskDelete(TaskHandle_t) {}
+inline void vTaskDelay(TickType_t ticks) { delay(ticks); }
@@ -0,0 +1,180 @@
+#pragma once
+// ============================================================================
+// lwIP sockets stand-in for the host (env:native)
+// ============================================================================
+// One simulated UDP socket, no real network. The bench queues datagrams for
+// it with nativeUdp().deliver() and collects what it sent with
+// nativeUdp().takeSent(). A task using the socket runs on a real thread (see
+// freertos/task.h), so lwip_recvfrom() blocks in real time: until a datagram
+// is queued, the SO_RCVTIMEO timeout passes or the socket is closed.
+// ============================================================================
+#include <Arduino.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#define NATIVE_UDP_FD 3
+
+struct NativeDatagram {
+  std::vector<uint8_t> data;
+  sockaddr_in peer;
+};
+
+struct NativeUdp {
+  std::mutex lock;
+  std::condition_variable changed;
+  std::deque<NativeDatagram> inbox; // To the socket
+  std::deque<NativeDatagram> sent;  // From the socket
+  bool open = false;
+  uint16_t port = 0;      // Bound port (host order), 0: not bound
+  uint32_t timeoutMs = 0; // SO_RCVTIMEO, 0: wait forever
+  uint32_t opens = 0;
+
+  // A datagram from 10.0.0.2:peerPort; false if no socket is bound (the
+  // datagram is lost, as on a real network)
+  bool deliver(const uint8_t *data, size_t length, uint16_t peerPort) {
+    NativeDatagram datagram;
+    datagram.data.assign(data, data + length);
+    memset(&datagram.peer, 0, sizeof(datagram.peer));
+    datagram.peer.sin_family = AF_INET;
+    datagram.peer.sin_port = htons(peerPort);
+    datagram.peer.sin_addr.s_addr = htonl(0x0A000002);
+    std::lock_guard<std::mutex> guard(lock);
+    if (!open || port == 0) {
+      return false;
+    }
+    inbox.push_back(datagram);
+    changed.notify_all();
+    return true;
+  }
+
+  // The oldest datagram the socket sent, waiting up to waitMs for one
+  bool takeSent(NativeDatagram &out, uint32_t waitMs) {
+    std::unique_lock<std::mutex> guard(lock);
+    if (!changed.wait_for(guard, std::chrono::milliseconds(waitMs),
+                          [this] { return !sent.empty(); })) {
+      return false;
+    }
+    out = sent.front();
+    sent.pop_front();
+    return true;
+  }
+
+  // The port the socket is bound to, 0 if none
+  uint16_t boundPort() {
+    std::lock_guard<std::mutex> guard(lock);
+    return open ? port : 0;
+  }
+};
+
+// Never destroyed: a socket task may still be waiting on it at exit
+inline NativeUdp &nativeUdp() {
+  static NativeUdp *udp = new NativeUdp;
+  return *udp;
+}
+
+inline int lwip_socket(int domain, int type, int) {
+  NativeUdp &udp = nativeUdp();
+  std::lock_guard<std::mutex> guard(udp.lock);
+  if (domain != AF_INET || type != SOCK_DGRAM || udp.open) {
+    errno = EMFILE;
+    return -1;
+  }
+  udp.open = true;
+  udp.port = 0;
+  udp.timeoutMs = 0;
+  udp.inbox.clear();
+  udp.opens++;
+  return NATIVE_UDP_FD;
+}
+
+inline int lwip_bind(int fd, const sockaddr *name, socklen_t) {
+  NativeUdp &udp = nativeUdp();
+  std::lock_guard<std::mutex> guard(udp.lock);
+  if (fd != NATIVE_UDP_FD || !udp.open) {
+    errno = EBADF;
+    return -1;
+  }
+  udp.port = ntohs(((const sockaddr_in *)name)->sin_port);
+  return 0;
+}
+
+inline int lwip_setsockopt(int fd, int level, int option, const void *value,
+                           socklen_t) {
+  NativeUdp &udp = nativeUdp();
+  std::lock_guard<std::mutex> guard(udp.lock);
+  if (fd != NATIVE_UDP_FD || !udp.open) {
+    errno = EBADF;
+    return -1;
+  }
+  if (level == SOL_SOCKET && option == SO_RCVTIMEO) {
+    const timeval *timeout = (const timeval *)value;
+    udp.timeoutMs = timeout->tv_sec * 1000 + timeout->tv_usec / 1000;
+  }
+  return 0;
+}
+
+inline ssize_t lwip_recvfrom(int fd, void *mem, size_t length, int,
+                             sockaddr *from, socklen_t *fromLength) {
+  NativeUdp &udp = nativeUdp();
+  std::unique_lock<std::mutex> guard(udp.lock);
+  auto ready = [&udp] { return !udp.open || !udp.inbox.empty(); };
+  if (udp.timeoutMs == 0) {
+    udp.changed.wait(guard, ready);
+  } else if (!udp.changed.wait_for(
+                 guard, std::chrono::milliseconds(udp.timeoutMs), ready)) {
+    errno = EAGAIN;
+    return -1;
+  }
+  if (fd != NATIVE_UDP_FD || !udp.open) {
+    errno = EBADF;
+    return -1;
+  }
+  NativeDatagram &datagram = udp.inbox.front();
+  size_t copied = min(length, datagram.data.size());
+  memcpy(mem, datagram.data.data(), copied);
+  if (from && fromLength) {
+    socklen_t peerLength = min(*fromLength, (socklen_t)sizeof(datagram.peer));
+    memcpy(from, &datagram.peer, peerLength);
+    *fromLength = peerLength;
+  }
+  udp.inbox.pop_front();
+  return copied;
+}
+
+inline ssize_t lwip_sendto(int fd, const void *data, size_t length, int,
+                           const sockaddr *to, socklen_t) {
+  NativeUdp &udp = nativeUdp();
+  std::lock_guard<std::mutex> guard(udp.lock);
+  if (fd != NATIVE_UDP_FD || !udp.open) {
+    errno = EBADF;
+    return -1;
+  }
+  NativeDatagram datagram;
+  datagram.data.assign((const uint8_t *)data, (const uint8_t *)data + length);
+  datagram.peer = *(const sockaddr_in *)to;
+  udp.sent.push_back(datagram);
+  udp.changed.notify_all();
+  return length;
+}
+
+inline int lwip_close(int fd) {
+  NativeUdp &udp = nativeUdp();
+  std::lock_guard<std::mutex> guard(udp.lock);
+  if (fd != NATIVE_UDP_FD || !udp.open) {
+    errno = EBADF;
+    return -1;
+  }
+  udp.open = false;
+  udp.port = 0;
+  udp.changed.notify_all();
+  return 0;
+}
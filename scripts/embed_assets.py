@@ -0,0 +1,135 @@
+"""Embed the web interface (data/) into the firmware as gzipped byte arrays.
+
+Writes src/web_assets.h: one constexpr array per file in data/, gzipped
+(deterministic: no name, mtime 0), with a strong ETag from the SHA-256 of the
+gzipped bytes. References to other assets inside the HTML files get a
+"?v=<etag>" suffix, so those URLs change with their content and can be cached
+as immutable (see src/assets.h).
+
+Runs before every PlatformIO build (extra_scripts = pre:...) and only
+rewrites the header when its content changed. Can also be run directly:
+
+    python3 scripts/embed_assets.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".png": "image/png",
+    ".ico": "image/x-icon",
+}
+
+ETAG_HEX_DIGITS = 16
+
+
+def compress(raw):
+    return gzip.compress(raw, compresslevel=9, mtime=0)
+
+
+def etag_for(packed):
+    return hashlib.sha256(packed).hexdigest()[:ETAG_HEX_DIGITS]
+
+
+def version_references(html, etags):
+    """Append ?v=<etag> to href/src attributes naming an embedded asset."""
+
+    def replace(match):
+        name = match.group(2)
+        if name.lstrip("/") not in etags:
+            return match.group(0)
+        return '%s="%s?v=%s"' % (match.group(1), name, etags[name.lstrip("/")])
+
+    return re.sub(r'\b(href|src)="(/?[\w.-]+)"', replace, html)
+
+
+def c_identifier(name):
+    return "WEB_ASSET_" + re.sub(r"\W", "_", name).upper()
+
+
+def c_bytes(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def generate(project_dir):
+    data_dir = os.path.join(project_dir, "data")
+    names = sorted(
+        n for n in os.listdir(data_dir)
+        if os.path.isfile(os.path.join(data_dir, n)) and not n.startswith("."))
+
+    # Assets first, so the pages can reference their ETags
+    names.sort(key=lambda n: n.endswith(".html"))
+    assets = []
+    etags = {}
+    for name in names:
+        with open(os.path.join(data_dir, name), "rb") as f:
+            raw = f.read()
+        if name.endswith(".html"):
+            raw = version_references(raw.decode("utf-8"), etags).encode("utf-8")
+        packed = compress(raw)
+        etags[name] = etag_for(packed)
+        ext = os.path.splitext(name)[1]
+        assets.append((name, CONTENT_TYPES.get(ext, "application/octet-stream"),
+                       raw, packed, etags[name]))
+
+    out = [
+        "// Generated by scripts/embed_assets.py from data/ - do not edit.",
+        "#pragma once",
+        "#include <stdint.h>",
+        "",
+    ]
+    raw_total = sum(len(a[2]) for a in assets)
+    packed_total = sum(len(a[3]) for a in assets)
+    out.append("// %d assets, %d bytes raw, %d bytes gzipped" %
+               (len(assets), raw_total, packed_total))
+    for name, _, raw, packed, _ in assets:
+        out.append("")
+        out.append("// %s: %d -> %d bytes" % (name, len(raw), len(packed)))
+        out.append("constexpr uint8_t %s[] = {" % c_identifier(name))
+        out.append(c_bytes(packed))
+        out.append("};")
+    out.append("")
+    out.append("const WebAsset WEB_ASSETS[] = {")
+    for name, content_type, raw, packed, etag in assets:
+        out.append('    {"/%s", "%s", %s, sizeof(%s), %d, "\\"%s\\""},' %
+                   (name, content_type, c_identifier(name), c_identifier(name),
+                    len(raw), etag))
+    out.append("};")
+    out.append("")
+    out.append("const uint8_t WEB_ASSET_COUNT = %d;" % len(assets))
+    out.append("")
+    return "\n".join(out)
+
+
+def write_if_changed(path, content):
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == content:
+                return False
+    with open(path, "w") as f:
+        f.write(content)
+    return True
+
+
+def main(project_dir):
+    header = os.path.join(project_dir, "src", "web_assets.h")
+    if write_if_changed(header, generate(project_dir)):
+        print("embed_assets: wrote %s" % os.path.relpath(header, project_dir))
+
+
+try:
+    Import("env")  # noqa: F821 (PlatformIO extra script)
+    main(env["PROJECT_DIR"])  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        main(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
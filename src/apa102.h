@@ -0,0 +1,191 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+#include <driver/spi_master.h>
+#include <esp_attr.h>
+#include <esp_timer.h>
+
+#include "frame.h"
+
+// ============================================================================
+// APA102 Output Stage
+// ============================================================================
+// The strip's wire format is kept in persistent buffers:
+//
+//   [start frame: 4 × 0x00]
+//   [per LED: 0xE0 | brightness, B, G, R]   (colour-corrected)
+//   [end frame: (NUM_LEDS + 15) / 16 × 0xFF]
+//
+// The segment blend kernel writes each pixel straight into the render buffer
+// (see apa102SetPixel), so showing a frame is a single bulk SPI transfer of
+// bytes that are already encoded. Encoding matches FastLED's APA102
+// controller with TypicalLEDStrip correction, full brightness and no
+// dithering.
+//
+// Transfers are non-blocking DMA through ESP-IDF's spi_master and the two
+// buffers are double-buffered:
+//   - apa102Frame is the render buffer, owned by the CPU.
+//   - apa102Show() hands it to the DMA and makes the other buffer the render
+//     buffer (seeded with a copy, since only dirty segments are redrawn).
+//   - The in-flight buffer is not touched until its transfer has been reaped
+//     by apa102Poll(); the completion callback only timestamps the end.
+//   - A frame that is ready while the previous one is still on the wire is an
+//     overrun: it is not queued, but sent from apa102Poll() as soon as the bus
+//     is free (later changes are coalesced into it).
+// ============================================================================
+#define APA102_SPI_HZ 12000000
+#define APA102_SPI_HOST SPI2_HOST
+#define APA102_BRIGHTNESS 31 // 5-bit global brightness per LED
+
+const int APA102_START_BYTES = 4;
+const int APA102_END_BYTES = (NUM_LEDS + 15) / 16;
+const int APA102_FRAME_BYTES =
+    APA102_START_BYTES + NUM_LEDS * 4 + APA102_END_BYTES;
+
+// Colour correction (TypicalLEDStrip = 0xFFB0F0), scaled like FastLED's
+// computeAdjustment() at brightness 255
+#define APA102_CORRECTION 0xFFB0F0
+#define APA102_ADJUST(cc) ((uint8_t)((((uint32_t)(cc) + 1) * 256 * 255) >> 16))
+const uint8_t APA102_ADJUST_R =
+    APA102_ADJUST((APA102_CORRECTION >> 16) & 0xFF);
+const uint8_t APA102_ADJUST_G = APA102_ADJUST((APA102_CORRECTION >> 8) & 0xFF);
+const uint8_t APA102_ADJUST_B = APA102_ADJUST(APA102_CORRECTION & 0xFF);
+
+// Transmit statistics
+struct APA102Stats {
+  uint32_t frames;       // Frames handed to the DMA
+  uint32_t overruns;     // Frames ready before the previous one finished
+  uint32_t lastTxMicros; // Duration of the last transfer
+  uint32_t maxTxMicros;
+};
+
+// ============================================================================
+// Output State
+// ============================================================================
+WORD_ALIGNED_ATTR DRAM_ATTR uint8_t apa102Buffers[2][APA102_FRAME_BYTES];
+uint8_t *apa102Frame = apa102Buffers[0]; // Render buffer (CPU-owned)
+
+spi_device_handle_t apa102Spi = nullptr;
+spi_transaction_t apa102Tx;
+bool apa102Busy = false;    // apa102Tx is on the wire
+bool apa102Pending = false; // A frame is waiting for the bus
+int64_t apa102TxStartMicros = 0;
+volatile int64_t apa102TxDoneMicros = 0;
+APA102Stats apa102Stats = {0, 0, 0, 0};
+
+// Write one corrected pixel into the render buffer
+inline void apa102SetPixel(int index, const CRGB &color) {
+  uint8_t *p = &apa102Frame[APA102_START_BYTES + index * 4 + 1];
+  p[0] = scale8(color.b, APA102_ADJUST_B);
+  p[1] = scale8(color.g, APA102_ADJUST_G);
+  p[2] = scale8(color.r, APA102_ADJUST_R);
+}
+
+// Lay out start frame, LED headers and end frame (all pixels black)
+inline void apa102InitFrame(uint8_t *frame) {
+  memset(frame, 0, APA102_START_BYTES);
+  for (int i = 0; i < NUM_LEDS; i++) {
+    uint8_t *p = &frame[APA102_START_BYTES + i * 4];
+    p[0] = 0xE0 | APA102_BRIGHTNESS;
+    p[1] = p[2] = p[3] = 0;
+  }
+  memset(&frame[APA102_FRAME_BYTES - APA102_END_BYTES], 0xFF,
+         APA102_END_BYTES);
+}
+
+// Completion ISR: only timestamps, the buffer is released by apa102Poll()
+IRAM_ATTR void apa102OnTxDone(spi_transaction_t *) {
+  apa102TxDoneMicros = esp_timer_get_time();
+}
+
+// Queue the render buffer and continue rendering into the other one
+inline void apa102Transmit() {
+  uint8_t *ready = apa102Frame;
+  apa102Frame = (ready == apa102Buffers[0]) ? apa102Buffers[1]
+                                            : apa102Buffers[0];
+  memcpy(apa102Frame, ready, APA102_FRAME_BYTES);
+
+  memset(&apa102Tx, 0, sizeof(apa102Tx));
+  apa102Tx.length = APA102_FRAME_BYTES * 8;
+  apa102Tx.tx_buffer = ready;
+  apa102TxStartMicros = esp_timer_get_time();
+  if (spi_device_queue_trans(apa102Spi, &apa102Tx, 0) == ESP_OK) {
+    apa102Busy = true;
+    apa102Stats.frames++;
+  } else {
+    apa102Pending = true; // Retry from apa102Poll()
+  }
+}
+
+// Reap a finished transfer and send a frame that became ready meanwhile.
+// Call as often as possible (cheap when the bus is idle).
+inline void apa102Poll() {
+  if (apa102Busy) {
+    spi_transaction_t *done;
+    if (spi_device_get_trans_result(apa102Spi, &done, 0) != ESP_OK) {
+      return; // Still on the wire
+    }
+    apa102Busy = false;
+    uint32_t txMicros = apa102TxDoneMicros - apa102TxStartMicros;
+    apa102Stats.lastTxMicros = txMicros;
+    apa102Stats.maxTxMicros = max(apa102Stats.maxTxMicros, txMicros);
+  }
+  if (apa102Pending && apa102Spi) {
+    apa102Pending = false;
+    apa102Transmit();
+  }
+}
+
+// Send the render buffer without waiting for the wire
+inline void apa102Show() {
+  if (!apa102Spi) {
+    return; // SPI init failed
+  }
+  apa102Poll();
+  if (apa102Busy) {
+    apa102Stats.overruns++;
+    apa102Pending = true;
+    return;
+  }
+  apa102Transmit();
+}
+
+// Blank the strip. Pixel bytes are cleared, so callers must invalidateFrame()
+// to have the segments repaint them before the next apa102Show().
+inline void apa102ShowBlack() {
+  for (int i = 0; i < NUM_LEDS; i++) {
+    apa102SetPixel(i, CRGB::Black);
+  }
+  apa102Show();
+}
+
+inline void setupAPA102(int dataPin, int clockPin) {
+  apa102InitFrame(apa102Buffers[0]);
+  apa102InitFrame(apa102Buffers[1]);
+
+  spi_bus_config_t bus;
+  memset(&bus, 0, sizeof(bus));
+  bus.mosi_io_num = dataPin;
+  bus.miso_io_num = -1;
+  bus.sclk_io_num = clockPin;
+  bus.quadwp_io_num = -1;
+  bus.quadhd_io_num = -1;
+  bus.max_transfer_sz = APA102_FRAME_BYTES;
+
+  spi_device_interface_config_t dev;
+  memset(&dev, 0, sizeof(dev));
+  dev.mode = 0;
+  dev.clock_speed_hz = APA102_SPI_HZ;
+  dev.spics_io_num = -1;
+  dev.queue_size = 1;
+  dev.post_cb = apa102OnTxDone;
+
+  esp_err_t err = spi_bus_initialize(APA102_SPI_HOST, &bus, SPI_DMA_CH_AUTO);
+  if (err == ESP_OK) {
+    err = spi_bus_add_device(APA102_SPI_HOST, &dev, &apa102Spi);
+  }
+  if (err != ESP_OK) {
+    Serial.printf("  ERROR: SPI init failed (%s)\n", esp_err_to_name(err));
+    apa102Spi = nullptr;
+  }
+}
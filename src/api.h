@@ -0,0 +1,970 @@
+#pragma once
+#include <Arduino.h>
+#include <IPAddress.h>
+#include <RTClib.h>
+#include <WiFi.h>
+
+#include "assets.h"
+#include "boot.h"
+#include "commands.h"
+#include "dns.h"
+#include "portal.h"
+#include "preview.h"
+#include "settings.h"
+
+// RTC state from rtc.h (handlers read the published time, see rtc.h)
+extern bool usingInternalTime;
+extern TimeService timeService;
+
+// Network state from network.h
+extern IPAddress apIP;
+extern NetworkMode activeNetworkMode;
+extern NetworkState networkState;
+extern NetworkStats networkStats;
+
+// Render statistics from leds.h / apa102.h / power.h
+extern FrameStats frameStats;
+extern APA102Stats apa102Stats;
+extern PowerStats powerStats;
+
+// ============================================================================
+// JSON Responses
+// ============================================================================
+// The REST API bodies never touch the heap. JsonWriter writes the JSON
+// tokens into a shared fixed-size arena and flushes it into the outgoing
+// AsyncResponseStream (any Print) whenever it fills up, so there is no
+// document tree, no String and no copy of a finished response.
+//
+// All handlers run on the AsyncTCP task, one at a time, so one arena serves
+// them all. A writer that finds it taken (never expected) writes unbuffered.
+//
+// The writer opens the root object itself; finish() closes whatever is
+// still open and flushes. Keys are written as given (they are literals),
+// string values are escaped.
+// ============================================================================
+#define RESPONSE_ARENA_BYTES 256
+#define RESPONSE_STREAM_BYTES 256 // Initial AsyncResponseStream buffer
+
+char responseArena[RESPONSE_ARENA_BYTES];
+bool responseArenaBusy = false;
+
+class JsonWriter {
+public:
+  explicit JsonWriter(Print &out)
+      : out(out), arena(nullptr), used(0), depth(0), closers(0), comma(false),
+        finished(false), bytes(0) {
+    if (!responseArenaBusy) {
+      responseArenaBusy = true;
+      arena = responseArena;
+    }
+    put('{');
+  }
+
+  ~JsonWriter() { finish(); }
+
+  JsonWriter(const JsonWriter &) = delete;
+  JsonWriter &operator=(const JsonWriter &) = delete;
+
+  JsonWriter &field(const char *key, const char *value) {
+    writeKey(key);
+    writeString(value);
+    return *this;
+  }
+  JsonWriter &field(const char *key, bool value) {
+    writeKey(key);
+    put(value ? "true" : "false");
+    return *this;
+  }
+  JsonWriter &field(const char *key, int value) {
+    return field(key, (long long)value);
+  }
+  JsonWriter &field(const char *key, unsigned value) {
+    return field(key, (unsigned long long)value);
+  }
+  JsonWriter &field(const char *key, long value) {
+    return field(key, (long long)value);
+  }
+  JsonWriter &field(const char *key, unsigned long value) {
+    return field(key, (unsigned long long)value);
+  }
+  JsonWriter &field(const char *key, long long value) {
+    writeKey(key);
+    if (value < 0) {
+      put('-');
+      writeNumber(0ULL - (unsigned long long)value);
+    } else {
+      writeNumber((unsigned long long)value);
+    }
+    return *this;
+  }
+  JsonWriter &field(const char *key, unsigned long long value) {
+    writeKey(key);
+    writeNumber(value);
+    return *this;
+  }
+
+  // Open a nested object (key nullptr: an array element) or array
+  JsonWriter &beginObject(const char *key = nullptr) {
+    return open(key, '{');
+  }
+  JsonWriter &beginArray(const char *key) { return open(key, '['); }
+
+  JsonWriter &end() {
+    if (depth > 0) {
+      put((closers >> --depth) & 1 ? ']' : '}');
+      comma = true;
+    }
+    return *this;
+  }
+
+  // Close everything, flush and give the arena back. Returns the bytes
+  // written.
+  uint32_t finish() {
+    if (!finished) {
+      while (depth > 0) {
+        end();
+      }
+      put('}');
+      flush();
+      if (arena) {
+        responseArenaBusy = false;
+        arena = nullptr;
+      }
+      finished = true;
+    }
+    return bytes;
+  }
+
+private:
+  static const uint8_t MAX_DEPTH = 32; // Bits in closers
+
+  Print &out;
+  char *arena;
+  uint16_t used;
+  uint8_t depth;    // Open containers below the root
+  uint32_t closers; // Bit per depth: 1 = array
+  bool comma;       // The next member needs a separator
+  bool finished;
+  uint32_t bytes;
+
+  void flush() {
+    if (used > 0) {
+      out.write((const uint8_t *)arena, used);
+      used = 0;
+    }
+  }
+
+  void put(char c) {
+    bytes++;
+    if (!arena) {
+      out.write((uint8_t)c);
+      return;
+    }
+    if (used == RESPONSE_ARENA_BYTES) {
+      flush();
+    }
+    arena[used++] = c;
+  }
+
+  void put(const char *text) {
+    while (*text) {
+      put(*text++);
+    }
+  }
+
+  void writeKey(const char *key) {
+    if (comma) {
+      put(',');
+    }
+    comma = true;
+    if (key) {
+      put('"');
+      put(key);
+      put("\":");
+    }
+  }
+
+  JsonWriter &open(const char *key, char opener) {
+    writeKey(key);
+    put(opener);
+    if (depth < MAX_DEPTH) {
+      uint32_t bit = 1UL << depth++;
+      closers = opener == '[' ? closers | bit : closers & ~bit;
+    }
+    comma = false;
+    return *this;
+  }
+
+  void writeNumber(unsigned long long value) {
+    char digits[20];
+    uint8_t n = 0;
+    do {
+      digits[n++] = '0' + value % 10;
+      value /= 10;
+    } while (value);
+    while (n) {
+      put(digits[--n]);
+    }
+  }
+
+  void writeString(const char *value) {
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    put('"');
+    for (; value && *value; value++) {
+      uint8_t c = *value;
+      if (c == '"' || c == '\\') {
+        put('\\');
+        put((char)c);
+      } else if (c < 0x20) {
+        put("\\u00");
+        put(HEX_DIGITS[c >> 4]);
+        put(HEX_DIGITS[c & 15]);
+      } else {
+        put((char)c);
+      }
+    }
+    put('"');
+  }
+};
+
+// ============================================================================
+// Request Fields
+// ============================================================================
+// POST bodies are read into fixed buffers and parsed in place: RequestFields
+// only holds pointers to NUL-terminated keys and values inside the text, no
+// String is built for a key or a value.
+//
+// - parseForm(): a=1&b=x%20y (percent and '+' decoding)
+// - parseJson(): a flat object {"a":1,"b":"x y","c":true}. Numbers and
+//   literals are kept as their text, null counts as absent, nested objects
+//   and arrays are rejected.
+//
+// Both need text[length] to be writable (the NUL of the last value).
+//
+// A body arrives in chunks through the AsyncWebServer body callback and is
+// assembled in the shared requestBody (one request at a time, the AsyncTCP
+// task handles every callback). A body that is too large or arrives while
+// another one is being received is rejected. A claim whose request never
+// completes expires after REQUEST_BODY_TIMEOUT_MS.
+// ============================================================================
+#define REQUEST_FIELDS_MAX 64
+#define REQUEST_BODY_BYTES 1536
+#define REQUEST_BODY_TIMEOUT_MS 2000
+
+struct RequestField {
+  const char *key;
+  const char *value;
+};
+
+class RequestFields {
+public:
+  RequestFields() : count(0) {}
+
+  // False if all REQUEST_FIELDS_MAX slots are taken
+  bool add(const char *key, const char *value) {
+    if (count == REQUEST_FIELDS_MAX) {
+      return false;
+    }
+    fields[count].key = key;
+    fields[count].value = value;
+    count++;
+    return true;
+  }
+
+  bool parseForm(char *text, size_t length) {
+    char *p = text;
+    char *end = text + length;
+    *end = '\0';
+    while (p < end) {
+      char *pairEnd = (char *)memchr(p, '&', end - p);
+      if (!pairEnd) {
+        pairEnd = end;
+      }
+      char *eq = (char *)memchr(p, '=', pairEnd - p);
+      char *keyEnd = eq ? eq : pairEnd;
+      if (keyEnd > p) {
+        char *value = eq ? eq + 1 : pairEnd;
+        decodeForm(value, pairEnd);
+        if (!add(decodeForm(p, keyEnd), value)) {
+          return false;
+        }
+      }
+      p = pairEnd + 1;
+    }
+    return true;
+  }
+
+  bool parseJson(char *text, size_t length) {
+    char *p = text;
+    text[length] = '\0';
+    char c = nextToken(p);
+    if (c != '{') {
+      return false;
+    }
+    c = nextToken(p);
+    if (c == '}') {
+      return nextToken(p) == '\0';
+    }
+    for (;;) {
+      if (c != '"') {
+        return false;
+      }
+      char *key = readString(p);
+      if (!key || nextToken(p) != ':') {
+        return false;
+      }
+      char *value;
+      c = nextToken(p);
+      if (c == '"') {
+        value = readString(p);
+        c = nextToken(p);
+      } else {
+        value = readLiteral(--p, c);
+      }
+      if (!value) {
+        return false;
+      }
+      if (strcmp(value, "null") != 0 && !add(key, value)) {
+        return false;
+      }
+      if (c == '}') {
+        return nextToken(p) == '\0';
+      }
+      if (c != ',') {
+        return false;
+      }
+      c = nextToken(p);
+    }
+  }
+
+  const char *get(const char *key) const {
+    for (uint8_t i = 0; i < count; i++) {
+      if (strcmp(fields[i].key, key) == 0) {
+        return fields[i].value;
+      }
+    }
+    return nullptr;
+  }
+
+  bool has(const char *key) const { return get(key) != nullptr; }
+
+  long toInt(const char *key) const {
+    const char *value = get(key);
+    return value ? strtol(value, nullptr, 10) : 0;
+  }
+
+  // "true" or "1"
+  bool toBool(const char *key) const {
+    const char *value = get(key);
+    return value && (strcmp(value, "true") == 0 || strcmp(value, "1") == 0);
+  }
+
+  uint8_t size() const { return count; }
+
+private:
+  RequestField fields[REQUEST_FIELDS_MAX];
+  uint8_t count;
+
+  static int8_t hexValue(char c) {
+    if (c >= '0' && c <= '9') {
+      return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+      return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+      return c - 'A' + 10;
+    }
+    return -1;
+  }
+
+  // Decode [begin, end) in place, NUL-terminated
+  static char *decodeForm(char *begin, char *end) {
+    char *out = begin;
+    for (char *in = begin; in < end; in++) {
+      if (*in == '+') {
+        *out++ = ' ';
+      } else if (*in == '%' && end - in > 2 && hexValue(in[1]) >= 0 &&
+                 hexValue(in[2]) >= 0) {
+        *out++ = (char)(hexValue(in[1]) << 4 | hexValue(in[2]));
+        in += 2;
+      } else {
+        *out++ = *in;
+      }
+    }
+    *out = '\0';
+    return begin;
+  }
+
+  // The next non-space character (consumed), '\0' at the end
+  static char nextToken(char *&p) {
+    while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') {
+      p++;
+    }
+    return *p ? *p++ : '\0';
+  }
+
+  // p just after the opening quote: unescape in place up to the closing
+  // one, NUL-terminated. nullptr if unterminated.
+  static char *readString(char *&p) {
+    char *begin = p;
+    char *out = p;
+    while (*p != '"') {
+      char c = *p++;
+      if (c == '\0' || (uint8_t)c < 0x20) {
+        return nullptr;
+      }
+      if (c != '\\') {
+        *out++ = c;
+        continue;
+      }
+      c = *p++;
+      switch (c) {
+      case '"':
+      case '\\':
+      case '/':
+        *out++ = c;
+        break;
+      case 'b':
+        *out++ = '\b';
+        break;
+      case 'f':
+        *out++ = '\f';
+        break;
+      case 'n':
+        *out++ = '\n';
+        break;
+      case 'r':
+        *out++ = '\r';
+        break;
+      case 't':
+        *out++ = '\t';
+        break;
+      case 'u': {
+        uint16_t code = 0;
+        for (uint8_t i = 0; i < 4; i++) {
+          int8_t digit = hexValue(p[i]);
+          if (digit < 0) {
+            return nullptr;
+          }
+          code = code << 4 | digit;
+        }
+        p += 4;
+        // UTF-8, at most 3 bytes for the 6 escaped ones (no surrogates)
+        if (code < 0x80) {
+          *out++ = (char)code;
+        } else if (code < 0x800) {
+          *out++ = (char)(0xC0 | code >> 6);
+          *out++ = (char)(0x80 | (code & 0x3F));
+        } else {
+          *out++ = (char)(0xE0 | code >> 12);
+          *out++ = (char)(0x80 | (code >> 6 & 0x3F));
+          *out++ = (char)(0x80 | (code & 0x3F));
+        }
+        break;
+      }
+      default:
+        return nullptr;
+      }
+    }
+    p++;
+    *out = '\0';
+    return begin;
+  }
+
+  // A number or true/false/null at p, NUL-terminated. The structural
+  // character after it (',' or '}') is returned in next.
+  static char *readLiteral(char *&p, char &next) {
+    char *begin = p;
+    while (*p == '-' || *p == '+' || *p == '.' || (*p >= '0' && *p <= '9') ||
+           (*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z')) {
+      p++;
+    }
+    if (p == begin) {
+      return nullptr; // Nested object, array or garbage
+    }
+    char *end = p;
+    next = nextToken(p);
+    *end = '\0'; // Only now: it may have been the ',' or '}'
+    if (strcmp(begin, "true") == 0 || strcmp(begin, "false") == 0 ||
+        strcmp(begin, "null") == 0) {
+      return begin;
+    }
+    char *numberEnd;
+    strtod(begin, &numberEnd);
+    return *numberEnd == '\0' ? begin : nullptr;
+  }
+};
+
+struct RequestBody {
+  const void *owner;  // Request being received, nullptr = free
+  uint32_t claimedMs; // millis() of the first chunk
+  size_t length;      // Received so far
+  size_t total;       // Content-Length
+  bool overflow;      // Too large or out of order
+  uint32_t received;  // Complete bodies (statistics)
+  uint32_t rejected;  // Too large, or the buffer was busy
+  char text[REQUEST_BODY_BYTES + 1];
+};
+
+RequestBody requestBody;
+
+// A chunk of owner's body (AsyncWebServer body callback): index is its
+// offset, total the whole length
+inline void appendRequestBody(RequestBody &body, const void *owner,
+                              const uint8_t *data, size_t len, size_t index,
+                              size_t total, uint32_t now) {
+  if (index == 0) {
+    if (body.owner && body.owner != owner &&
+        now - body.claimedMs < REQUEST_BODY_TIMEOUT_MS) {
+      body.rejected++; // Busy: this request ends up without a body
+      return;
+    }
+    body.owner = owner;
+    body.claimedMs = now;
+    body.length = 0;
+    body.total = total;
+    body.overflow = total > REQUEST_BODY_BYTES;
+    body.rejected += body.overflow;
+  }
+  if (body.owner != owner || body.overflow) {
+    return;
+  }
+  if (index != body.length || index + len > REQUEST_BODY_BYTES) {
+    body.overflow = true;
+    body.rejected++;
+    return;
+  }
+  memcpy(body.text + index, data, len);
+  body.length += len;
+}
+
+// Parse owner's complete body into fields and release the buffer (the
+// fields stay valid until the next body arrives, i.e. for the rest of the
+// handler). False if it has no usable body.
+inline bool takeRequestBody(RequestBody &body, const void *owner,
+                            size_t contentLength, RequestFields &fields) {
+  if (body.owner != owner) {
+    return false;
+  }
+  body.owner = nullptr;
+  if (body.overflow || body.length != body.total ||
+      body.total != contentLength) {
+    return false;
+  }
+  body.received++;
+  size_t start = 0;
+  while (start < body.length && body.text[start] == ' ') {
+    start++;
+  }
+  char *text = body.text + start;
+  size_t length = body.length - start;
+  return text[0] == '{' ? fields.parseJson(text, length)
+                        : fields.parseForm(text, length);
+}
+
+// ============================================================================
+// State Bodies
+// ============================================================================
+// The parts of the device state, shared by /api/state and the single
+// endpoints: a writer per part, and a parser per settings group that turns
+// the request fields into one command.
+// ============================================================================
+struct StateStats {
+  uint32_t sent;        // 200 responses of GET /api/state
+  uint32_t notModified; // 304 responses
+  uint32_t batches;     // Batches queued by POST /api/state
+};
+
+StateStats stateStats = {0, 0, 0};
+
+enum ArgsResult : uint8_t {
+  ARGS_MISSING, // None of the group's arguments
+  ARGS_OK,      // Command filled in
+  ARGS_INVALID, // Present but unusable
+};
+
+typedef ArgsResult (*ArgsParser)(const RequestFields &fields,
+                                 Command &command);
+
+// Numeric patch field, COMMAND_UNCHANGED if the field is missing
+inline int8_t patchArg(const RequestFields &fields, const char *name,
+                       int maxValue) {
+  if (!fields.has(name)) {
+    return COMMAND_UNCHANGED;
+  }
+  return constrain(fields.toInt(name), 0L, (long)maxValue);
+}
+
+// Boolean patch field ("true" / "1"), COMMAND_UNCHANGED if missing
+inline int8_t patchBoolArg(const RequestFields &fields, const char *name) {
+  if (!fields.has(name)) {
+    return COMMAND_UNCHANGED;
+  }
+  return fields.toBool(name);
+}
+
+inline void addTimeState(JsonWriter &json, const DateTime &now) {
+  json.field("hours", now.hour());
+  json.field("minutes", now.minute());
+  json.field("day", now.day());
+  json.field("month", now.month());
+  json.field("year", now.year());
+  json.field("weekday", now.dayOfTheWeek());
+  json.field("usingInternalTime", usingInternalTime);
+}
+
+inline void addActiveHoursState(JsonWriter &json,
+                                const ClockSettings &settings) {
+  static const char *const dayNames[] = {"sun", "mon", "tue", "wed",
+                                         "thu", "fri", "sat"};
+  json.field("enabled", settings.useActiveHours);
+  json.beginArray("days");
+  for (int i = 0; i < 7; i++) {
+    json.beginObject();
+    json.field("name", dayNames[i]);
+    json.field("enabled", settings.days[i].enabled);
+    json.field("start", settings.days[i].startHour);
+    json.field("startMinute", settings.days[i].startMinute);
+    json.field("end", settings.days[i].endHour);
+    json.field("endMinute", settings.days[i].endMinute);
+    json.end();
+  }
+  json.end();
+}
+
+inline void addNetworkState(JsonWriter &json,
+                            const NetworkSettings &settings) {
+  bool connected =
+      activeNetworkMode == NETWORK_CLIENT && WiFi.status() == WL_CONNECTED;
+  json.field("mode", settings.mode);
+  json.field("ssid", settings.ssid);
+  // Don't send password for security
+  json.field("hasPassword", settings.password[0] != '\0');
+  json.field("fallback", settings.fallbackToCaptive);
+  json.field("activeMode", activeNetworkMode);
+  json.field("state", NETWORK_STATE_NAMES[networkState]);
+  json.field("attempts", networkStats.attempts);
+  json.field("linkLosses", networkStats.linkLosses);
+  json.field("connected", connected);
+  if (connected || activeNetworkMode == NETWORK_CAPTIVE) {
+    IPAddress ip = connected ? WiFi.localIP() : apIP;
+    char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+    json.field("ip", text);
+  }
+}
+
+// GET /api/state body (the ETag is the caller's)
+inline void writeStateJson(JsonWriter &json, uint32_t version,
+                           const DateTime &now) {
+  SettingsReader snapshot;
+  json.field("success", true);
+  json.field("version", version);
+  json.beginObject("time");
+  addTimeState(json, now);
+  json.end();
+  json.field("timezone", snapshot->clock.timezone);
+  json.beginObject("activeHours");
+  addActiveHoursState(json, snapshot->clock);
+  json.end();
+  json.field("interval", snapshot->clock.wakeupInterval);
+  json.beginObject("network");
+  addNetworkState(json, snapshot->network);
+  json.end();
+}
+
+inline void writeTimeJson(JsonWriter &json) {
+  DateTime now = getPublishedTime();
+  json.field("success", true);
+  addTimeState(json, now);
+  json.field("seconds", now.second());
+}
+
+inline void writeTimezoneJson(JsonWriter &json) {
+  SettingsReader snapshot;
+  json.field("success", true);
+  json.field("timezone", snapshot->clock.timezone);
+}
+
+inline void writeActiveHoursJson(JsonWriter &json) {
+  SettingsReader snapshot;
+  json.field("success", true);
+  addActiveHoursState(json, snapshot->clock);
+}
+
+inline void writeWakeupIntervalJson(JsonWriter &json) {
+  SettingsReader snapshot;
+  json.field("success", true);
+  json.field("interval", snapshot->clock.wakeupInterval);
+}
+
+inline void writeNetworkJson(JsonWriter &json) {
+  SettingsReader snapshot;
+  json.field("success", true);
+  addNetworkState(json, snapshot->network);
+}
+
+// hours, minutes, day, month, year: all or none
+inline ArgsResult parseTimeArgs(const RequestFields &fields,
+                                Command &command) {
+  static const char *const names[] = {"hours", "minutes", "day", "month",
+                                      "year"};
+  uint8_t present = 0;
+  for (const char *name : names) {
+    present += fields.has(name);
+  }
+  if (present == 0) {
+    return ARGS_MISSING;
+  }
+  if (present < 5) {
+    return ARGS_INVALID;
+  }
+  command = makeCommand(CMD_SET_TIME);
+  command.time.hours = fields.toInt("hours");
+  command.time.minutes = fields.toInt("minutes");
+  command.time.day = fields.toInt("day");
+  command.time.month = fields.toInt("month");
+  command.time.year = fields.toInt("year");
+  return ARGS_OK;
+}
+
+inline ArgsResult parseTimezoneArgs(const RequestFields &fields,
+                                    Command &command) {
+  const char *tz = fields.get("timezone");
+  if (!tz) {
+    return ARGS_MISSING;
+  }
+  command = makeCommand(CMD_SET_TIMEZONE);
+  size_t length = strlen(tz);
+  if (length == 0 || length >= sizeof(command.timezone)) {
+    return ARGS_INVALID;
+  }
+  memcpy(command.timezone, tz, length + 1);
+  return ARGS_OK;
+}
+
+// enabled, dayN_enabled / _start / _start_min / _end / _end_min (any subset)
+inline ArgsResult parseScheduleArgs(const RequestFields &fields,
+                                    Command &command) {
+  command = makeCommand(CMD_SET_SCHEDULE);
+
+  // Global enable/disable
+  command.schedule.useActiveHours = patchBoolArg(fields, "enabled");
+
+  // Per-day settings (only the fields that were sent)
+  char key[16];
+  for (int i = 0; i < 7; i++) {
+    DayPatch &day = command.schedule.days[i];
+    snprintf(key, sizeof(key), "day%d_enabled", i);
+    day.enabled = patchBoolArg(fields, key);
+    snprintf(key, sizeof(key), "day%d_start", i);
+    day.startHour = patchArg(fields, key, 23);
+    snprintf(key, sizeof(key), "day%d_end", i);
+    day.endHour = patchArg(fields, key, 23);
+    snprintf(key, sizeof(key), "day%d_start_min", i);
+    day.startMinute = patchArg(fields, key, 59);
+    snprintf(key, sizeof(key), "day%d_end_min", i);
+    day.endMinute = patchArg(fields, key, 59);
+  }
+
+  // A field that was sent is the only thing not COMMAND_UNCHANGED
+  const int8_t *patch = (const int8_t *)&command.schedule;
+  for (size_t i = 0; i < sizeof(command.schedule); i++) {
+    if (patch[i] != COMMAND_UNCHANGED) {
+      return ARGS_OK;
+    }
+  }
+  return ARGS_MISSING;
+}
+
+inline ArgsResult parseIntervalArgs(const RequestFields &fields,
+                                    Command &command) {
+  if (!fields.has("interval")) {
+    return ARGS_MISSING;
+  }
+  command = makeCommand(CMD_SET_INTERVAL);
+  command.interval = fields.toInt("interval");
+  return ARGS_OK;
+}
+
+// mode, ssid, password, fallback (any subset), apply
+inline ArgsResult parseNetworkArgs(const RequestFields &fields,
+                                   Command &command) {
+  command = makeCommand(CMD_SET_NETWORK);
+  bool changed = false;
+
+  if (fields.has("mode")) {
+    long mode = fields.toInt("mode");
+    if (mode == NETWORK_CAPTIVE || mode == NETWORK_CLIENT) {
+      command.network.mode = mode;
+      changed = true;
+    }
+  }
+
+  const char *ssid = fields.get("ssid");
+  if (ssid) {
+    strncpy(command.network.ssid, ssid, sizeof(command.network.ssid) - 1);
+    command.network.setSsid = true;
+    changed = true;
+  }
+
+  const char *password = fields.get("password");
+  if (password) {
+    // Only update password if provided (allow empty to clear)
+    strncpy(command.network.password, password,
+            sizeof(command.network.password) - 1);
+    command.network.setPassword = true;
+    changed = true;
+  }
+
+  if (fields.has("fallback")) {
+    command.network.fallbackToCaptive = patchBoolArg(fields, "fallback");
+    changed = true;
+  }
+
+  // Check if we should restart network now (deferred by the render loop and
+  // loopNetwork(), so the response still goes out)
+  command.network.apply = patchBoolArg(fields, "apply") == 1;
+  return changed ? ARGS_OK : ARGS_MISSING;
+}
+
+// The groups of a POST /api/state, in the order they are applied
+const ArgsParser STATE_ARGS_PARSERS[] = {parseTimeArgs, parseTimezoneArgs,
+                                         parseScheduleArgs, parseIntervalArgs,
+                                         parseNetworkArgs};
+const uint8_t STATE_ARGS_GROUPS =
+    sizeof(STATE_ARGS_PARSERS) / sizeof(STATE_ARGS_PARSERS[0]);
+
+// Every group present in fields as one command each (batch holds
+// STATE_ARGS_GROUPS). ARGS_INVALID if any group is.
+inline ArgsResult parseStateArgs(const RequestFields &fields, Command *batch,
+                                 uint8_t &count) {
+  count = 0;
+  for (ArgsParser parse : STATE_ARGS_PARSERS) {
+    ArgsResult result = parse(fields, batch[count]);
+    if (result == ARGS_INVALID) {
+      return ARGS_INVALID;
+    }
+    count += result == ARGS_OK;
+  }
+  return count > 0 ? ARGS_OK : ARGS_MISSING;
+}
+
+// ============================================================================
+// Statistics Body
+// ============================================================================
+
+// Pacing state of the preview clients of one endpoint
+inline void addPreviewClientStats(JsonWriter &json, const char *key,
+                                  const PreviewClientState *clients) {
+  json.beginArray(key);
+  for (uint8_t i = 0; i < PREVIEW_MAX_CLIENTS; i++) {
+    const PreviewClientState &state = clients[i];
+    if (state.id == 0) {
+      continue;
+    }
+    json.beginObject();
+    json.field("id", state.id);
+    json.field("intervalMs", state.intervalMs);
+    json.field("ackMs", state.ackMs);
+    json.field("queue", state.queueDepth);
+    json.field("maxQueue", state.maxQueueDepth);
+    json.field("sent", state.sent);
+    json.field("keyframes", state.keyframes);
+    json.field("skipped", state.skipped);
+    json.field("dropped", state.dropped);
+    json.field("bytes", state.bytes);
+    json.end();
+  }
+  json.end();
+}
+
+// GET /api/stats body
+inline void writeStatsJson(JsonWriter &json, const PreviewStats &preview,
+                           const PreviewClientState *segmentClients,
+                           const PreviewClientState *ledClients) {
+  json.field("success", true);
+  json.beginObject("frames");
+  json.field("pushed", frameStats.pushed);
+  json.field("skipped", frameStats.skipped);
+  json.end();
+  json.beginObject("spi");
+  json.field("frames", apa102Stats.frames);
+  json.field("overruns", apa102Stats.overruns);
+  json.field("txMicros", apa102Stats.lastTxMicros);
+  json.field("maxTxMicros", apa102Stats.maxTxMicros);
+  json.end();
+  json.beginObject("time");
+  json.field("rtcReads", timeService.syncs);
+  json.field("lastCorrection", timeService.lastCorrection);
+  json.end();
+  json.beginObject("power");
+  json.field("loopsPerSecond", powerStats.loopsPerSecond);
+  json.field("busyPercent", powerStats.busyPercent);
+  json.field("wakeLatencyMs", powerStats.lastWakeLatencyMs);
+  json.field("maxWakeLatencyMs", powerStats.maxWakeLatencyMs);
+  json.field("offCount", powerStats.offCount);
+  json.end();
+  json.beginObject("settings");
+  json.field("loadMicros", settingsStats.loadMicros);
+  json.field("saveRequests", settingsStats.requests);
+  json.field("commits", settingsStats.commits);
+  json.field("pending", (bool)settingsDirty);
+  json.field("generation", settingsCurrent.load()->generation);
+  json.end();
+  json.beginObject("state");
+  json.field("version", stateVersion.load());
+  json.field("sent", stateStats.sent);
+  json.field("notModified", stateStats.notModified);
+  json.field("batches", stateStats.batches);
+  json.end();
+  json.beginObject("http");
+  json.field("bodies", requestBody.received);
+  json.field("rejectedBodies", requestBody.rejected);
+  json.end();
+  json.beginObject("probes");
+  for (uint8_t os = 0; os < PROBE_OS_COUNT; os++) {
+    json.field(PROBE_OS_NAMES[os], probeStats.answered[os]);
+  }
+  json.field("serveMicros", probeStats.lastMicros);
+  json.field("maxServeMicros", probeStats.maxMicros);
+  json.field("bursts", probeStats.bursts);
+  json.field("portalMs", probeStats.lastPortalMs);
+  json.end();
+  json.beginObject("dns");
+  json.field("answered", dnsStats.answered);
+  json.field("empty", dnsStats.empty);
+  json.field("dropped", dnsStats.dropped);
+  json.field("sendErrors", dnsStats.sendErrors);
+  json.end();
+  json.beginObject("assets");
+  json.field("sent", webAssetStats.sent);
+  json.field("notModified", webAssetStats.notModified);
+  json.field("bytesSent", webAssetStats.bytesSent);
+  json.field("bytesSaved", webAssetStats.bytesSaved);
+  json.field("serveMicros", webAssetStats.lastMicros);
+  json.field("maxServeMicros", webAssetStats.maxMicros);
+  json.end();
+  json.beginObject("preview");
+  json.field("frames", preview.frames);
+  json.field("keyframes", preview.keyframes);
+  addPreviewClientStats(json, "clients", segmentClients);
+  addPreviewClientStats(json, "fullClients", ledClients);
+  json.end();
+  json.beginObject("commands");
+  json.field("applied", commandStats.applied);
+  json.field("rejected", commandStats.rejected);
+  json.field("latencyMicros", commandStats.lastLatencyMicros);
+  json.field("maxLatencyMicros", commandStats.maxLatencyMicros);
+  json.end();
+  json.beginObject("bootMicros");
+  for (int i = 0; i < BOOT_STAGES; i++) {
+    if (bootStageDone((BootStage)i)) {
+      json.field(BOOT_STAGE_NAMES[i], (uint32_t)bootStageMicros[i]);
+    }
+  }
+  json.end();
+  json.field("uptime", millis() / 1000);
+  json.field("freeHeap", ESP.getFreeHeap());
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+// ============================================================================
+// Embedded Web Assets
+// ============================================================================
+// The web interface (data/) is compiled into the firmware: a pre-build step
+// (scripts/embed_assets.py) gzips every file into web_assets.h together with
+// a strong ETag (hash of the gzipped bytes). Pages are sent straight from
+// flash as Content-Encoding: gzip, no filesystem is mounted or opened.
+//
+// Caching:
+// - A request whose If-None-Match carries the asset's ETag gets a bodyless
+//   304.
+// - The pages reference their assets as "style.css?v=<etag>". A request with
+//   the current version is cached as immutable for a year, a new firmware
+//   changes the URL.
+// - Pages (and assets without the current version) must be revalidated on
+//   every use, which costs a 304.
+// ============================================================================
+#define ASSET_CACHE_IMMUTABLE "public, max-age=31536000, immutable"
+#define ASSET_CACHE_REVALIDATE "no-cache"
+#define ASSET_ETAG_LENGTH 18 // 16 hex digits in quotes
+
+struct WebAsset {
+  const char *path; // "/style.css"
+  const char *contentType;
+  const uint8_t *data; // Gzipped
+  uint32_t length;     // Gzipped bytes
+  uint32_t rawLength;  // Before compression (statistics)
+  const char *etag;    // Quoted, e.g. "\"0123456789abcdef\""
+};
+
+#include "web_assets.h"
+
+// Page aliases: URL -> embedded file
+struct WebAssetAlias {
+  const char *url;
+  const char *path;
+};
+
+const WebAssetAlias WEB_ASSET_ALIASES[] = {{"/", "/index.html"},
+                                           {"/settings", "/settings.html"}};
+
+struct WebAssetStats {
+  uint32_t sent;        // 200 responses
+  uint32_t notModified; // 304 responses
+  uint32_t bytesSent;   // Body bytes of the 200 responses (gzipped)
+  uint32_t bytesSaved;  // Raw size of the same bodies minus bytesSent
+  uint32_t lastMicros;  // Request -> response queued (last asset request)
+  uint32_t maxMicros;
+};
+
+WebAssetStats webAssetStats = {0, 0, 0, 0, 0, 0};
+
+// The embedded file for a URL path (aliases included), nullptr if none
+inline const WebAsset *findWebAsset(const char *url) {
+  for (const WebAssetAlias &alias : WEB_ASSET_ALIASES) {
+    if (strcmp(url, alias.url) == 0) {
+      url = alias.path;
+      break;
+    }
+  }
+  for (uint8_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    if (strcmp(url, WEB_ASSETS[i].path) == 0) {
+      return &WEB_ASSETS[i];
+    }
+  }
+  return nullptr;
+}
+
+// If-None-Match matches a (quoted) ETag: "*" or a list containing it (weak
+// comparison, so W/"..." from a proxy counts too)
+inline bool etagListMatches(const char *ifNoneMatch, const char *etag) {
+  if (ifNoneMatch == nullptr) {
+    return false;
+  }
+  if (strcmp(ifNoneMatch, "*") == 0) {
+    return true;
+  }
+  return strstr(ifNoneMatch, etag) != nullptr;
+}
+
+inline bool etagMatches(const char *ifNoneMatch, const WebAsset &asset) {
+  return etagListMatches(ifNoneMatch, asset.etag);
+}
+
+// ?v= of the request names the current content (the URL is immutable)
+inline bool assetVersionCurrent(const char *version, const WebAsset &asset) {
+  if (version == nullptr) {
+    return false;
+  }
+  // The ETag without its quotes
+  return strlen(version) == ASSET_ETAG_LENGTH - 2 &&
+         strncmp(version, asset.etag + 1, ASSET_ETAG_LENGTH - 2) == 0;
+}
+
+inline const char *assetCacheControl(const char *version,
+                                     const WebAsset &asset) {
+  return assetVersionCurrent(version, asset) ? ASSET_CACHE_IMMUTABLE
+                                             : ASSET_CACHE_REVALIDATE;
+}
@@ -0,0 +1,2463 @@
+// ============================================================================
+// Headless Frame Benchmark (env:native)
+// ============================================================================
+// Runs the real render path (loopLEDs -> updateMode -> Segment::draw) on the
+// host against the NativeStubs library and a virtual millis() clock.
+//
+// For every DisplayMode it reports:
+//   - fps          achieved render rate in simulated time (per-mode policy)
+//   - ns/frame     host time per rendered frame (loopLEDs calls that drew)
+//   - allocs/frame heap allocations per rendered frame
+//   - shows        frames actually pushed to the strip (SPI transfers)
+//   - skipped      frames not pushed because nothing changed
+//   - hash         FNV-1a of leds[] after the last frame (determinism check)
+//   - overrun      frames ready while the previous DMA transfer was running
+//   - wire         last SPI frame == FastLED's APA102 encoding of leds[]
+//                  (OWNED if the CPU wrote a buffer the DMA still owned)
+//
+// The boot table times the foreground stages of setup() (see boot.h).
+// The network table replays scripted WiFi sessions (network.h) and checks
+// that no loop iteration waits. Web commands (commands.h) are timed from
+// push to apply per mode, and the SPSC ring is stressed by a producer thread.
+// The REST API bodies (api.h) are written and parsed per endpoint, counting
+// heap allocations per request, and captive portal probes (portal.h) are
+// looked up in their route table. A capture of DNS queries is replayed
+// through the captive DNS responder (dns.h).
+//
+// The scenarios run twice: at the real SPI speed and with transfers slowed
+// down 100x (dma stress), which forces the double-buffer overrun path.
+//
+// The time service (rtc.h) is then run for a simulated day against a DS1307
+// with injected drift, and the compiled schedule (schedule.h) is checked
+// against a direct evaluation of the settings for every minute of the week.
+// The settings blob (settings.h) is compared with the per-field NVS keys it
+// replaced: load time, NVS reads per load, writes and allocations per save.
+//
+// The dream word choreography (choreography.h) is checked against the fade
+// it replaced, and its keyframe tweens (segment.h) against re-targeting
+// every lit segment every frame.
+//
+// Further tables compare the fixed-point gradient engine (gradient.h)
+// against the FastLED CHSV fill_gradient() path it replaced, and the
+// preformatted APA102 buffer (apa102.h) against FastLED's encoder.
+//
+// Usage: .pio/build/native/program [frames]
+// ============================================================================
+#include <Arduino.h>
+
+#include <chrono>
+#include <deque>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "../assets.h"
+#include "../settings.h"
+
+bool wakeup = false;
+bool timeWasSet = false;
+
+#include "../leds.h"
+#include "../network.h"
+#include "../preview.h"
+#include "../rtc.h"
+
+#include "../api.h"
+
+// ============================================================================
+// Allocation Counter
+// ============================================================================
+static bool countAllocs = false;
+static uint32_t allocCount = 0;
+
+void *operator new(size_t size) {
+  if (countAllocs)
+    allocCount++;
+  if (void *p = malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+// ============================================================================
+// Helpers
+// ============================================================================
+static uint32_t hashLeds() {
+  uint32_t h = 2166136261u;
+  for (int i = 0; i < NUM_LEDS; i++) {
+    for (int c = 0; c < 3; c++) {
+      h ^= leds[i].raw[c];
+      h *= 16777619u;
+    }
+  }
+  return h;
+}
+
+// Wednesday 10:00 is inside the default schedule, Saturday is not
+static const DateTime ACTIVE_TIME(2025, 1, 15, 10, 0, 0);
+static const DateTime INACTIVE_TIME(2025, 1, 18, 10, 0, 0);
+
+static void resetState(const DateTime &now, bool timeSet) {
+  randomSeed(1);
+  random16_set_seed(1337);
+  scheduler = Scheduler();
+  setRTCTime(now.hour(), now.minute(), now.second(), now.day(), now.month(),
+             now.year());
+  timeWasSet = timeSet;
+  wakeup = false;
+  enterDreamMode();
+}
+
+static void prepareDream() { resetState(ACTIVE_TIME, true); }
+static void prepareWakeup() {
+  resetState(ACTIVE_TIME, true);
+  wakeup = true;
+}
+static void prepareTimeNotSet() { resetState(ACTIVE_TIME, false); }
+static void prepareOff() { resetState(INACTIVE_TIME, true); }
+
+// ============================================================================
+// Gradient Micro-Benchmark
+// ============================================================================
+
+// The pre-gradient.h path: CHSV buffer, two fill_gradient() passes, hsv2rgb
+static void legacyGradient(CRGB *out, int numToFill, CHSV start, CHSV mid,
+                           CHSV end) {
+  CHSV hsv[SEGMENT_LENGTH];
+  fill_gradient(hsv, 0, start, (numToFill / 2 - 1), mid);
+  fill_gradient(hsv, numToFill / 2, mid, numToFill - 1, end);
+  for (int i = 0; i < numToFill; i++) {
+    out[i] = hsv[i];
+  }
+}
+
+static void fixedGradient(CRGB *out, int numToFill, CHSV start, CHSV mid,
+                          CHSV end) {
+  fillGradientRGB(out, 0, {start.hue, start.val}, (numToFill / 2 - 1),
+                  {mid.hue, mid.val});
+  fillGradientRGB(out, numToFill / 2, {mid.hue, mid.val}, numToFill - 1,
+                  {end.hue, end.val});
+}
+
+typedef void (*GradientFn)(CRGB *, int, CHSV, CHSV, CHSV);
+
+static CHSV randomStop() {
+  // Bias towards the value extremes the segments actually use
+  uint8_t val = random8() < 64 ? (random8() < 128 ? 0 : 255) : random8();
+  return CHSV(random8(), 255, val);
+}
+
+static double timeGradient(GradientFn fn, uint32_t calls) {
+  CRGB out[SEGMENT_LENGTH];
+  random16_set_seed(42);
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < calls; i++) {
+    fn(out, (i & 7) ? SEGMENT_LENGTH : 2, randomStop(), randomStop(),
+       randomStop());
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  volatile uint8_t sink = out[0].r;
+  (void)sink;
+  return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+             .count() /
+         calls;
+}
+
+static void benchGradient(uint32_t calls) {
+  // Accuracy: max per-channel difference over the same random stops
+  int maxDiff = 0;
+  random16_set_seed(7);
+  for (uint32_t i = 0; i < calls; i++) {
+    int n = (i & 7) ? SEGMENT_LENGTH : 2;
+    CHSV a = randomStop(), b = randomStop(), c = randomStop();
+    CRGB ref[SEGMENT_LENGTH], got[SEGMENT_LENGTH];
+    legacyGradient(ref, n, a, b, c);
+    fixedGradient(got, n, a, b, c);
+    for (int p = 0; p < n; p++) {
+      for (int ch = 0; ch < 3; ch++) {
+        maxDiff = max(maxDiff, abs(ref[p].raw[ch] - got[p].raw[ch]));
+      }
+    }
+  }
+
+  printf("\n%-14s %10s %12s\n", "gradient", "ns/call", "max diff");
+  printf("%-14s %10.1f %12s\n", "fill_gradient",
+         timeGradient(legacyGradient, calls), "-");
+  printf("%-14s %10.1f %12d\n", "fixed-point",
+         timeGradient(fixedGradient, calls), maxDiff);
+}
+
+// ============================================================================
+// APA102 Encoder Check
+// ============================================================================
+
+// Does the pixel part of a wire frame match FastLED's encoding of leds[]?
+static bool wireMatchesLeds(const uint8_t *wire) {
+  std::vector<uint8_t> ref = FastLED.controller.encodeAPA102();
+  return memcmp(wire + APA102_START_BYTES, ref.data(), ref.size()) == 0;
+}
+
+static bool wireFramingValid(const uint8_t *wire) {
+  for (int i = 0; i < APA102_START_BYTES; i++) {
+    if (wire[i] != 0x00)
+      return false;
+  }
+  for (int i = APA102_FRAME_BYTES - APA102_END_BYTES; i < APA102_FRAME_BYTES;
+       i++) {
+    if (wire[i] != 0xFF)
+      return false;
+  }
+  return true;
+}
+
+static void benchAPA102(uint32_t frames) {
+  uint32_t mismatches = 0;
+  uint64_t ns = 0;
+  random16_set_seed(99);
+  for (uint32_t f = 0; f < frames; f++) {
+    for (int i = 0; i < NUM_LEDS; i++) {
+      leds[i] = CRGB(random8(), random8(), random8());
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < NUM_LEDS; i++) {
+      apa102SetPixel(i, leds[i]);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    ns += std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+              .count();
+    if (!wireMatchesLeds(apa102Frame) || !wireFramingValid(apa102Frame)) {
+      mismatches++;
+    }
+  }
+
+  printf("\n%-14s %10s %12s %10s\n", "apa102", "ns/frame", "mismatches",
+         "bytes");
+  printf("%-14s %10.1f %12u %10d\n", "encode", (double)ns / frames,
+         mismatches, APA102_FRAME_BYTES);
+}
+
+// ============================================================================
+// Time Service Check
+// ============================================================================
+
+// One simulated day against a DS1307 that drifts by driftPpm. Served time
+// must stay within a second of the chip, never step back, and raise one
+// event per minute and hour boundary crossed (a slow chip crosses fewer).
+// The time published for the web handlers must be the served time after
+// every updateTime().
+static void benchTimeService(int32_t driftPpm) {
+  rtc.driftPpm = driftPpm;
+  rtc.adjust(ACTIVE_TIME);
+  setupRTC();
+  uint32_t readsBefore = rtc.nowReads;
+
+  const uint32_t stepMs = 250;
+  const uint32_t steps = 24UL * 3600 * 1000 / stepMs;
+  uint32_t minutes = 0, hours = 0, backwards = 0, stale = 0;
+  int32_t maxError = 0;
+  uint32_t lastUnix = getCurrentTime().unixtime();
+  for (uint32_t i = 0; i < steps; i++) {
+    nativeAdvanceMillis(stepMs);
+    updateTime();
+    minutes += minuteChanged();
+    hours += hourChanged();
+
+    uint32_t unixTime = getCurrentTime().unixtime();
+    stale += getPublishedTime().unixtime() != unixTime;
+    backwards += (int32_t)(unixTime - lastUnix) < 0;
+    lastUnix = unixTime;
+    int32_t error = (int32_t)(unixTime - rtc.peek().unixtime());
+    maxError = max(maxError, abs(error));
+  }
+
+  printf("%+11d %8u %8u %8u %10d %10u %10u\n", driftPpm,
+         rtc.nowReads - readsBefore, minutes, hours, maxError, backwards,
+         stale);
+  rtc.driftPpm = 0;
+}
+
+// ============================================================================
+// Schedule Check
+// ============================================================================
+
+// Straight evaluation of the settings, the reference for the bitmap
+static bool referenceActive(uint16_t minute) {
+  const ClockSettings &settings = currentSettings()->clock;
+  if (!settings.useActiveHours)
+    return true;
+  for (int d = 0; d < 7; d++) {
+    const DaySchedule &day = settings.days[d];
+    if (!day.enabled)
+      continue;
+    int start = day.startHour * 60 + day.startMinute;
+    int end = day.endHour * 60 + day.endMinute;
+    int length = end >= start ? end - start : MINUTES_PER_DAY - start + end;
+    int offset = (minute - (d * MINUTES_PER_DAY + start) + MINUTES_PER_WEEK) %
+                 MINUTES_PER_WEEK;
+    if (offset < length)
+      return true;
+  }
+  return false;
+}
+
+static uint16_t referenceTransition(uint16_t minute) {
+  bool state = referenceActive(minute);
+  for (uint16_t i = 1; i < MINUTES_PER_WEEK; i++) {
+    if (referenceActive((minute + i) % MINUTES_PER_WEEK) != state)
+      return i;
+  }
+  return SCHEDULE_NO_TRANSITION;
+}
+
+// The open settings draft, in a new frame so a buffer is always free
+static SettingsSnapshot &benchDraft() {
+  settingsFrameBoundary();
+  return *editSettings();
+}
+
+static void setDay(int d, bool enabled, int sh, int sm, int eh, int em) {
+  benchDraft().clock.days[d] = {enabled, (uint8_t)sh, (uint8_t)sm,
+                                (uint8_t)eh, (uint8_t)em};
+}
+
+static void benchScheduleCase(const char *name) {
+  publishSettings(); // Recompiles the schedule if the draft changed it
+  uint32_t mismatches = 0;
+  uint64_t lookupNs = 0, transitionNs = 0;
+  volatile uint32_t sink = 0;
+  for (uint16_t m = 0; m < MINUTES_PER_WEEK; m++) {
+    auto t0 = std::chrono::steady_clock::now();
+    bool active = isScheduleActive(*activeSchedule, m);
+    auto t1 = std::chrono::steady_clock::now();
+    uint16_t edge = nextScheduleTransition(*activeSchedule, m);
+    auto t2 = std::chrono::steady_clock::now();
+    sink += active + edge;
+    lookupNs +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+    transitionNs +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
+    if (active != referenceActive(m) || edge != referenceTransition(m))
+      mismatches++;
+  }
+  printf("%-14s %10.1f %12.1f %10u\n", name,
+         (double)lookupNs / MINUTES_PER_WEEK,
+         (double)transitionNs / MINUTES_PER_WEEK, mismatches);
+}
+
+// Every minute of the week against the reference, for a few schedules
+static void benchSchedule() {
+  ClockSettings saved = currentSettings()->clock;
+  printf("\n%-14s %10s %12s %10s\n", "schedule", "ns/lookup", "ns/next edge",
+         "mismatches");
+  benchScheduleCase("default");
+
+  setDay(5, true, 22, 30, 2, 15); // Fri 22:30 -> Sat 02:15
+  setDay(6, true, 23, 45, 0, 10); // Sat 23:45 -> Sun 00:10 (week wrap)
+  setDay(0, true, 7, 5, 7, 6);    // One minute
+  benchScheduleCase("overnight");
+
+  for (int d = 0; d < 7; d++)
+    setDay(d, false, 0, 0, 0, 0);
+  benchScheduleCase("never");
+
+  benchDraft().clock.useActiveHours = false;
+  benchScheduleCase("always");
+
+  benchDraft().clock = saved;
+  publishSettings();
+}
+
+// ============================================================================
+// Settings Storage Check
+// ============================================================================
+// The previous per-field scheme, kept here as the baseline: what the
+// settings page's three POSTs (active hours, wakeup interval, timezone) and
+// the network form used to write.
+static void legacySave() {
+  const ClockSettings &clockSettings = currentSettings()->clock;
+  const NetworkSettings &networkSettings = currentSettings()->network;
+  preferences.putBool("useActiveHrs", clockSettings.useActiveHours);
+  for (int i = 0; i < 7; i++) {
+    String prefix = "day" + String(i);
+    preferences.putBool((prefix + "en").c_str(), clockSettings.days[i].enabled);
+    preferences.putUChar((prefix + "st").c_str(),
+                         clockSettings.days[i].startHour);
+    preferences.putUChar((prefix + "ed").c_str(),
+                         clockSettings.days[i].endHour);
+    preferences.putUChar((prefix + "sm").c_str(),
+                         clockSettings.days[i].startMinute);
+    preferences.putUChar((prefix + "em").c_str(),
+                         clockSettings.days[i].endMinute);
+  }
+  preferences.putUShort("wakeupInt", clockSettings.wakeupInterval);
+  preferences.putString("timezone", clockSettings.timezone);
+  preferences.putUChar("netMode", networkSettings.mode);
+  preferences.putString("netSSID", networkSettings.ssid);
+  preferences.putString("netPass", networkSettings.password);
+  preferences.putBool("netFallback", networkSettings.fallbackToCaptive);
+}
+
+static void newSave() {
+  for (int i = 0; i < 4; i++) {
+    requestSettingsSave();
+  }
+}
+
+static bool settingsEqual(const SettingsSnapshot &s, const ClockSettings &c,
+                          const NetworkSettings &n) {
+  return memcmp(&c, &s.clock, sizeof(c)) == 0 &&
+         memcmp(&n, &s.network, sizeof(n)) == 0;
+}
+
+// Load target for the loops below, zeroed padding like the expected values
+static SettingsSnapshot scratchSettings;
+
+static void printSettingsRow(const char *name, uint64_t ns, uint32_t loads,
+                             uint32_t reads, uint32_t writes, uint32_t allocs) {
+  printf("%-14s %10.1f %11.1f %12u %12u\n", name, (double)ns / loads,
+         (double)reads / loads, writes, allocs);
+}
+
+static void benchSettings(uint32_t loads) {
+  Preferences saved = preferences;
+
+  // Non-default values, zeroed padding so memcmp compares fields only
+  ClockSettings clock;
+  NetworkSettings network;
+  memset(&clock, 0, sizeof(clock));
+  memset(&network, 0, sizeof(network));
+  for (int d = 0; d < 7; d++) {
+    clock.days[d] = {d != 3, (uint8_t)(7 + d), (uint8_t)(5 * d),
+                     (uint8_t)(22 - d), 30};
+  }
+  clock.wakeupInterval = WAKEUP_30MIN;
+  clock.useActiveHours = true;
+  strcpy(clock.timezone, "America/Argentina/Buenos_Aires");
+  network.mode = NETWORK_CLIENT;
+  strcpy(network.ssid, "dreaming-test");
+  strcpy(network.password, "correct horse battery staple");
+  network.fallbackToCaptive = false;
+
+  printf("\n%-14s %10s %11s %12s %12s\n", "settings", "ns/load",
+         "reads/load", "writes/save", "allocs/save");
+
+  // Legacy: one key per field
+  preferences = Preferences();
+  SettingsSnapshot &draft = benchDraft();
+  draft.clock = clock;
+  draft.network = network;
+  publishSettings();
+  allocCount = 0;
+  countAllocs = true;
+  legacySave();
+  countAllocs = false;
+  uint32_t legacyWrites = preferences.writes;
+  uint32_t legacyAllocs = allocCount;
+  uint32_t readsBefore = preferences.reads;
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loads; i++) {
+    loadLegacySettings(scratchSettings);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  printSettingsRow(
+      "legacy keys",
+      std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count(),
+      loads, preferences.reads - readsBefore, legacyWrites, legacyAllocs);
+  bool legacyOk = settingsEqual(scratchSettings, clock, network);
+
+  // Migration: boot on the legacy keys
+  memset(&benchDraft().clock, 0, sizeof(ClockSettings));
+  publishSettings();
+  settingsFrameBoundary();
+  setupSettings();
+  bool migrateOk = settingsEqual(*currentSettings(), clock, network) &&
+                   settingsStats.migrated &&
+                   !preferences.isKey("day3sm") && !preferences.isKey("netSSID");
+
+  // Blob: the same save as a burst of requests, committed once
+  uint32_t writesBefore = preferences.writes;
+  allocCount = 0;
+  countAllocs = true;
+  newSave();
+  countAllocs = false;
+  uint32_t blobAllocs = allocCount;
+  for (int ms = 0; ms < SETTINGS_COMMIT_DELAY_MS * 2; ms++) {
+    nativeAdvanceMillis(1);
+    loopSettings();
+  }
+  uint32_t blobWrites = preferences.writes - writesBefore;
+  readsBefore = preferences.reads;
+  t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loads; i++) {
+    loadSettingsBlob(scratchSettings);
+  }
+  t1 = std::chrono::steady_clock::now();
+  printSettingsRow(
+      "blob",
+      std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count(),
+      loads, preferences.reads - readsBefore, blobWrites, blobAllocs);
+  bool blobOk = settingsEqual(scratchSettings, clock, network);
+
+  // A save request every 500 ms never settles: the cap still commits
+  writesBefore = preferences.writes;
+  uint32_t firstCommitMs = 0;
+  for (int ms = 1; ms <= 15000; ms++) {
+    nativeAdvanceMillis(1);
+    if (ms % 500 == 0) {
+      requestSettingsSave();
+    }
+    loopSettings();
+    if (!firstCommitMs && preferences.writes != writesBefore) {
+      firstCommitMs = ms;
+    }
+  }
+  uint32_t capMs = firstCommitMs - 500; // From the first request
+  bool capOk = firstCommitMs > 0 && capMs <= SETTINGS_COMMIT_MAX_MS;
+
+  // A damaged blob must be rejected (defaults are loaded instead)
+  SettingsBlob blob;
+  preferences.getBytes(SETTINGS_BLOB_KEY, &blob, sizeof(blob));
+  blob.clock.timezone[0] ^= 0x20;
+  preferences.putBytes(SETTINGS_BLOB_KEY, &blob, sizeof(blob));
+  bool crcOk = !loadSettingsBlob(scratchSettings);
+
+  printf("%-14s legacy %s, migration %s, blob %s, commit cap %s (%u ms), "
+         "crc %s\n",
+         "checks", legacyOk ? "ok" : "BAD", migrateOk ? "ok" : "BAD",
+         blobOk ? "ok" : "BAD", capOk ? "ok" : "BAD", capMs,
+         crcOk ? "ok" : "BAD");
+
+  preferences = saved;
+  settingsFrameBoundary();
+  setupSettings();
+}
+
+// ============================================================================
+// Settings Snapshot Check
+// ============================================================================
+// Read and publish cost on the loop task, then a reader thread (the web
+// handlers) against the loop publishing a frame at a time. Every field of a
+// published snapshot carries the same sequence number: a reader that sees two
+// different ones saw a torn snapshot, one that sees the numbers go backwards
+// saw a reused buffer.
+static void writeSnapshotSequence(SettingsSnapshot &draft, uint32_t seq) {
+  snprintf(draft.clock.timezone, sizeof(draft.clock.timezone), "tz-%u", seq);
+  snprintf(draft.network.ssid, sizeof(draft.network.ssid), "ssid-%u", seq);
+  snprintf(draft.network.password, sizeof(draft.network.password), "pw-%u",
+           seq);
+}
+
+// Sequence numbers continue from `first`
+static void benchSnapshotStress(uint32_t first, uint32_t publishes) {
+  std::atomic<bool> done(false);
+  std::atomic<uint32_t> torn(0), backwards(0), reads(0);
+
+  std::thread reader([&]() {
+    uint32_t last = 0;
+    while (!done.load(std::memory_order_relaxed)) {
+      SettingsReader snapshot;
+      uint32_t tz = 0, ssid = 0, pw = 0;
+      sscanf(snapshot->clock.timezone, "tz-%u", &tz);
+      sscanf(snapshot->network.ssid, "ssid-%u", &ssid);
+      sscanf(snapshot->network.password, "pw-%u", &pw);
+      if (tz != ssid || tz != pw) {
+        torn.fetch_add(1, std::memory_order_relaxed);
+      }
+      if (tz < last) {
+        backwards.fetch_add(1, std::memory_order_relaxed);
+      }
+      last = tz;
+      reads.fetch_add(1, std::memory_order_relaxed);
+    }
+  });
+
+  uint32_t published = 0, deferred = 0;
+  while (published < publishes) {
+    settingsFrameBoundary();
+    SettingsSnapshot *draft = editSettings();
+    if (!draft) {
+      deferred++; // The reader pins every spare buffer: next frame
+      std::this_thread::yield();
+      continue;
+    }
+    writeSnapshotSequence(*draft, first + ++published);
+    publishSettings();
+  }
+  done = true;
+  reader.join();
+
+  printf("%-14s %10u %10u %10u %10u %10u %6s\n", "2 threads", published,
+         deferred, reads.load(), torn.load(), backwards.load(),
+         (torn == 0 && backwards == 0) ? "ok" : "BAD");
+}
+
+static void benchSnapshots(uint32_t count) {
+  SettingsSnapshot saved;
+  saved.clock = currentSettings()->clock;
+  saved.network = currentSettings()->network;
+
+  volatile uint32_t sink = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < count; i++) {
+    sink += currentSettings()->clock.wakeupInterval;
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < count; i++) {
+    SettingsReader snapshot;
+    sink += snapshot->clock.wakeupInterval;
+  }
+  auto t2 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < count; i++) {
+    settingsFrameBoundary();
+    writeSnapshotSequence(*editSettings(), i);
+    publishSettings();
+  }
+  auto t3 = std::chrono::steady_clock::now();
+  auto ns = [count](std::chrono::steady_clock::duration d) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count() /
+           (double)count;
+  };
+  printf("\n%-14s %10s %10s %10s\n", "snapshots", "ns/read", "ns/pinned",
+         "ns/publish");
+  printf("%-14s %10.1f %10.1f %10.1f\n", "loop task", ns(t1 - t0),
+         ns(t2 - t1), ns(t3 - t2));
+
+  printf("\n%-14s %10s %10s %10s %10s %10s %6s\n", "snapshot stress",
+         "publishes", "deferred", "reads", "torn", "backwards", "check");
+  benchSnapshotStress(count, count / 10);
+
+  SettingsSnapshot &draft = benchDraft();
+  draft.clock = saved.clock;
+  draft.network = saved.network;
+  publishSettings();
+}
+
+// ============================================================================
+// Web Asset Check
+// ============================================================================
+// Body bytes and requests of a browsing session against the old scheme
+// (files from LittleFS, uncompressed, max-age=600, no validators) and the
+// embedded assets (gzip, ETag + 304 for pages, immutable versioned CSS). Both
+// pages load style.css. Server time is the host cost of picking the response.
+struct AssetVisit {
+  uint32_t second;
+  const char *page;
+};
+
+static const AssetVisit assetVisits[] = {
+    {0, "/"},       {60, "/settings"}, {120, "/"},
+    {1800, "/"},    {1860, "/settings"}, {86400, "/"},
+};
+
+struct AssetCacheEntry {
+  const WebAsset *asset; // nullptr: free
+  uint32_t fetchedAt;
+  bool immutable;
+};
+
+// The browser cache entry for an asset (a free one if it is not cached)
+static AssetCacheEntry &cacheEntry(AssetCacheEntry *cache,
+                                   const WebAsset *asset) {
+  AssetCacheEntry *free = nullptr;
+  for (uint8_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    if (cache[i].asset == asset) {
+      return cache[i];
+    }
+    if (!free && !cache[i].asset) {
+      free = &cache[i];
+    }
+  }
+  return *free;
+}
+
+static void benchAssets() {
+  printf("\n%-14s %10s %10s %8s\n", "web assets", "raw", "gzip", "ratio");
+  uint32_t rawTotal = 0, gzipTotal = 0;
+  bool gzipOk = true, etagsOk = true;
+  for (uint8_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    const WebAsset &asset = WEB_ASSETS[i];
+    printf("%-14s %10u %10u %7.1f%%\n", asset.path, asset.rawLength,
+           asset.length,
+           asset.rawLength ? 100.0 * asset.length / asset.rawLength : 0.0);
+    rawTotal += asset.rawLength;
+    gzipTotal += asset.length;
+    gzipOk &= asset.length > 2 && asset.data[0] == 0x1f && asset.data[1] == 0x8b;
+    etagsOk &= strlen(asset.etag) == ASSET_ETAG_LENGTH;
+    for (uint8_t j = 0; j < i; j++) {
+      etagsOk &= strcmp(asset.etag, WEB_ASSETS[j].etag) != 0;
+    }
+  }
+  printf("%-14s %10u %10u %7.1f%%\n", "total", rawTotal, gzipTotal,
+         100.0 * gzipTotal / rawTotal);
+
+  const WebAsset *style = findWebAsset("/style.css");
+  char styleVersion[ASSET_ETAG_LENGTH];
+  memcpy(styleVersion, style->etag + 1, ASSET_ETAG_LENGTH - 2);
+  styleVersion[ASSET_ETAG_LENGTH - 2] = '\0';
+
+  AssetCacheEntry before[WEB_ASSET_COUNT] = {};
+  AssetCacheEntry after[WEB_ASSET_COUNT] = {};
+  uint32_t beforeRequests = 0, beforeBytes = 0;
+  uint32_t afterRequests = 0, afterBytes = 0, notModified = 0;
+  uint64_t ns = 0;
+  for (const AssetVisit &visit : assetVisits) {
+    const WebAsset *files[2] = {findWebAsset(visit.page), style};
+    for (int f = 0; f < 2; f++) {
+      // Before: whatever is older than max-age is fetched again in full
+      AssetCacheEntry &old = cacheEntry(before, files[f]);
+      if (!old.asset || visit.second - old.fetchedAt >= 600) {
+        old.asset = files[f];
+        old.fetchedAt = visit.second;
+        beforeRequests++;
+        beforeBytes += files[f]->rawLength;
+      }
+
+      // After: pages revalidate, the versioned stylesheet never expires
+      AssetCacheEntry &entry = cacheEntry(after, files[f]);
+      if (entry.asset && entry.immutable) {
+        continue;
+      }
+      const char *ifNoneMatch = entry.asset ? entry.asset->etag : nullptr;
+      const char *version = files[f] == style ? styleVersion : nullptr;
+      auto t0 = std::chrono::steady_clock::now();
+      const WebAsset *asset = findWebAsset(files[f]->path);
+      bool cached = etagMatches(ifNoneMatch, *asset);
+      const char *cacheControl = assetCacheControl(version, *asset);
+      auto t1 = std::chrono::steady_clock::now();
+      ns += std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+                .count();
+      afterRequests++;
+      if (cached) {
+        notModified++;
+      } else {
+        afterBytes += asset->length;
+      }
+      entry.asset = asset;
+      entry.fetchedAt = visit.second;
+      entry.immutable = strcmp(cacheControl, ASSET_CACHE_IMMUTABLE) == 0;
+    }
+  }
+
+  printf("\n%-14s %10s %10s %10s %10s\n", "web session", "requests",
+         "body bytes", "304s", "ns/request");
+  printf("%-14s %10u %10u %10s %10s\n", "littlefs", beforeRequests,
+         beforeBytes, "-", "-");
+  printf("%-14s %10u %10u %10u %10.1f\n", "embedded", afterRequests,
+         afterBytes, notModified, (double)ns / afterRequests);
+  printf("%-14s gzip %s, etags %s\n", "checks", gzipOk ? "ok" : "BAD",
+         etagsOk ? "ok" : "BAD");
+}
+
+// ============================================================================
+// Network Check
+// ============================================================================
+// Scripted WiFi sessions against the stand-in access point (WiFi.h): the
+// network and render path run every virtual millisecond while the script
+// takes the AP away, brings it back or restarts the network. The worst loop
+// iteration in virtual time (anything that waits) must stay below 1 ms.
+struct NetScript {
+  const char *name;
+  bool apInRange;
+  bool fallback;
+  uint32_t seconds;
+  void (*event)(uint32_t ms); // Called every ms with the script time
+  NetworkState expect;        // NET_BACKOFF: still retrying
+};
+
+static void flapEvent(uint32_t ms) {
+  if (ms == 20000) {
+    WiFi.apInRange = false;
+    WiFi.nativeDropLink();
+  } else if (ms == 80000) {
+    WiFi.apInRange = true;
+  }
+}
+
+static void restartEvent(uint32_t ms) {
+  if (ms == 30000) {
+    benchDraft().network.mode = NETWORK_CAPTIVE;
+    publishSettings();
+    restartNetwork();
+  }
+}
+
+static const NetScript netScripts[] = {
+    {"connect", true, true, 60, nullptr, NET_CONNECTED},
+    {"flap", true, false, 180, flapEvent, NET_CONNECTED},
+    {"no AP+fallback", false, true, 60, nullptr, NET_CAPTIVE},
+    {"no AP", false, false, 600, nullptr, NET_BACKOFF},
+    {"restart", true, true, 60, restartEvent, NET_CAPTIVE},
+};
+
+// Milliseconds until the captive DNS task (dns.h) has ended, 0xFFFFFFFF on
+// timeout
+static uint32_t waitDnsIdle() {
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t waited = 0; waited < 2000;) {
+    if (dnsState == DNS_IDLE) {
+      return waited;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    waited = std::chrono::duration_cast<std::chrono::milliseconds>(
+                 std::chrono::steady_clock::now() - t0)
+                 .count();
+  }
+  return 0xFFFFFFFF;
+}
+
+static void benchNetwork() {
+  NetworkSettings saved = currentSettings()->network;
+  printf("\n%-14s %8s %8s %10s %11s %11s %11s %6s\n", "network", "attempts",
+         "losses", "online s", "state", "worst us", "ns/loop", "check");
+
+  for (const NetScript &script : netScripts) {
+    resetState(ACTIVE_TIME, true);
+    WiFi.nativeReset();
+    WiFi.apInRange = script.apInRange;
+    NetworkSettings &network = benchDraft().network;
+    network = saved;
+    network.mode = NETWORK_CLIENT;
+    strcpy(network.ssid, "dreaming-test");
+    network.fallbackToCaptive = script.fallback;
+    publishSettings();
+    networkStats = NetworkStats();
+    networkRestartRequested = false;
+    setupNetwork();
+
+    uint32_t onlineMs = 0;
+    uint64_t worstMicros = 0, ns = 0;
+    for (uint32_t ms = 1; ms <= script.seconds * 1000; ms++) {
+      nativeAdvanceMillis(1);
+      WiFi.nativePoll();
+      if (script.event) {
+        script.event(ms);
+      }
+      uint64_t before = nativeClockMicros;
+      auto t0 = std::chrono::steady_clock::now();
+      loopNetwork();
+      loopLEDs();
+      auto t1 = std::chrono::steady_clock::now();
+      worstMicros = max(worstMicros, nativeClockMicros - before);
+      ns += std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+                .count();
+      if (!onlineMs &&
+          (networkState == NET_CONNECTED || networkState == NET_CAPTIVE)) {
+        onlineMs = ms;
+      }
+    }
+
+    bool retrying =
+        networkState == NET_BACKOFF || networkState == NET_CONNECTING;
+    bool stateOk = (script.expect == NET_BACKOFF)
+                       ? retrying
+                       : networkState == script.expect;
+    bool ok = stateOk && worstMicros < 1000;
+    printf("%-14s %8u %8u %10.1f %11s %11llu %11.1f %6s\n", script.name,
+           networkStats.attempts, networkStats.linkLosses, onlineMs / 1000.0,
+           NETWORK_STATE_NAMES[networkState], (unsigned long long)worstMicros,
+           (double)ns / (script.seconds * 1000), ok ? "ok" : "BAD");
+  }
+  stopCaptiveDns(); // Let the task of the captive scripts end
+  waitDnsIdle();
+  benchDraft().network = saved;
+  publishSettings();
+}
+
+// ============================================================================
+// Dream Word Check
+// ============================================================================
+// The dream word choreography (modes.h, choreography.h) against the fade it
+// replaced, which recomputed the opacity with map() every frame. Three
+// cycles are played millisecond by millisecond: the word must show and hide
+// on time, and at every resume the opacity and the one its keyframe heads
+// for must match the old fade. Then the real updateDreamWord() runs at the
+// dream frame rates, timing the frames that only check the deadline and
+// those that resume.
+static uint8_t dreamSkips = 0; // Words the picker skips before showing one
+
+static const char *benchPickWord() {
+  if (dreamSkips > 0) {
+    dreamSkips--;
+    return nullptr;
+  }
+  return "DREA";
+}
+
+// Opacity of the old updateDreamWord() this far into a word
+static int legacyDreamOpacity(unsigned long elapsed) {
+  unsigned long fadeTime = DREAM_WORD_DISPLAY_MS / 4;
+  if (elapsed < fadeTime) {
+    return map(elapsed, 0, fadeTime, DREAM_WORD_MIN_OPACITY,
+               DREAM_WORD_MAX_OPACITY);
+  } else if (elapsed > DREAM_WORD_DISPLAY_MS - fadeTime) {
+    unsigned long fadeElapsed = elapsed - (DREAM_WORD_DISPLAY_MS - fadeTime);
+    return map(fadeElapsed, 0, fadeTime, DREAM_WORD_MAX_OPACITY,
+               DREAM_WORD_MIN_OPACITY);
+  }
+  return DREAM_WORD_MAX_OPACITY;
+}
+
+// Play `cycles` cycles from start (the first word after `skips` skips);
+// true if every millisecond matched
+static bool playDreamCycles(uint32_t start, uint8_t skips, uint8_t cycles,
+                            uint32_t &resumes) {
+  const uint32_t cycle = DREAM_WORD_PAUSE_MS + DREAM_WORD_DISPLAY_MS;
+  uint32_t firstWord =
+      start + DREAM_WORD_PAUSE_MS + skips * (DREAM_WORD_PAUSE_MS / 2);
+  Choreographer player;
+  dreamSkips = skips;
+  player.start(DREAM_WORD_CHOREOGRAPHY, benchPickWord, DREAM_WORD_KEYFRAME_MS,
+               start);
+  bool ok = true;
+  for (uint32_t t = start; t != firstWord + cycles * cycle; t++) {
+    uint32_t since = t - firstWord;
+    bool shown = (int32_t)since >= 0 && since % cycle < DREAM_WORD_DISPLAY_MS;
+    if (player.due(t)) {
+      player.resume(t);
+      if (shown) {
+        // Where the word is and where its tween is heading
+        uint32_t next = player.nextResume() - firstWord;
+        ok &= player.opacity == legacyDreamOpacity(since % cycle) &&
+              next - since <= DREAM_WORD_KEYFRAME_MS &&
+              player.opacityAt(player.nextResume()) ==
+                  legacyDreamOpacity(next - since + since % cycle);
+      }
+    }
+    ok &= player.showing() == shown;
+  }
+  resumes = player.resumes;
+  return ok;
+}
+
+// One dream word frame: the word update, then the 28 digit segments drawn.
+// legacy re-targets every lit segment every frame like the old
+// updateDreamWord() (fillColor() with the new hue and opacity, speed 20),
+// otherwise updateDreamWord() tweens between keyframes. Returns the blends
+// that were restarted.
+static uint32_t dreamWordFrame(bool legacy, const char *word, uint32_t since,
+                               uint32_t frameMicros) {
+  uint16_t pos[7 * 4];
+  for (int i = 0; i < 7 * 4; i++) {
+    pos[i] = frameArena.blendPos[i];
+  }
+  if (legacy) {
+    int opacity = legacyDreamOpacity(since);
+    setDreamWord(word, opacity);
+    for (int i = 0; i < 7 * 4; i++) {
+      if (segments[i].opacity() > 0) {
+        CHSV dreamColor = CHSV((millis() / 100) % 255, 180, opacity);
+        segments[i].fillColor(dreamColor, 20);
+      }
+    }
+  } else {
+    updateDreamWord();
+  }
+  uint32_t restarts = 0;
+  for (int i = 0; i < 7 * 4; i++) {
+    restarts += frameArena.blendPos[i] < pos[i];
+  }
+  advanceFrameClock(frameMicros);
+  for (int i = 0; i < 7 * 4; i++) {
+    segments[i].draw();
+  }
+  return restarts;
+}
+
+// Frame cost while one word is shown, before and after keyframes (best of
+// DREAM_FRAME_ROUNDS words, each from the same state)
+#define DREAM_FRAME_ROUNDS 5
+static bool benchDreamWordFrames() {
+  const uint32_t frameMs = 1000 / framesPerSecondFor(MODE_DREAM);
+  const char *word = nullptr;
+  uint32_t frames = 0;
+  uint64_t ns[2] = {UINT64_MAX, UINT64_MAX};
+  uint32_t restarts[2] = {0, 0}, allocs[2] = {0, 0};
+  bool ok = true;
+  for (int round = 0; round < 2 * DREAM_FRAME_ROUNDS; round++) {
+    int legacy = round % 2;
+    // Dream mode until the word comes up
+    prepareDream();
+    uint32_t waited = 0;
+    while (!dreamWord.showing() && waited < 4 * DREAM_WORD_PAUSE_MS) {
+      nativeAdvanceMillis(frameMs);
+      waited += frameMs;
+      dreamWordFrame(false, nullptr, 0, frameMs * 1000);
+    }
+    ok &= dreamWord.showing();
+    if (!legacy) {
+      word = dreamWord.word;
+    }
+    allocCount = 0;
+    countAllocs = true;
+    uint64_t roundNs = 0;
+    frames = 0;
+    restarts[legacy] = 0;
+    for (uint32_t since = 0; since < DREAM_WORD_DISPLAY_MS; since += frameMs) {
+      nativeAdvanceMillis(frameMs);
+      auto t0 = std::chrono::steady_clock::now();
+      restarts[legacy] += dreamWordFrame(legacy, word, since, frameMs * 1000);
+      auto t1 = std::chrono::steady_clock::now();
+      roundNs +=
+          std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+              .count();
+      frames++;
+    }
+    countAllocs = false;
+    allocs[legacy] = max(allocs[legacy], allocCount);
+    ns[legacy] = min(ns[legacy], roundNs);
+  }
+  dreamWord.stop();
+
+  printf("\n%-14s %8s %10s %12s %8s\n", "word frames", "frames",
+         "ns/frame", "restarts/fr", "allocs");
+  const char *names[2] = {"keyframes", "every frame"};
+  for (int legacy = 1; legacy >= 0; legacy--) {
+    printf("%-14s %8u %10.1f %12.2f %8u\n", names[legacy], frames,
+           (double)ns[legacy] / frames, (double)restarts[legacy] / frames,
+           allocs[legacy]);
+  }
+  return ok && word && allocs[0] == 0 && restarts[0] < restarts[1];
+}
+
+// After a word hides, its segments must start their next random gradients
+// spread over the following seconds like the rest of the dream, not all in
+// the frame after the hide. Returns the most restarts in one frame.
+static uint32_t benchDreamWordHide(uint32_t &restarts) {
+  prepareDream();
+  bool hidden = false, shown = false;
+  uint32_t worst = 0, afterHideMs = 0;
+  restarts = 0;
+  for (uint32_t ms = 0; ms < 4 * DREAM_WORD_PAUSE_MS;) {
+    uint32_t frameMs = 1000 / framesPerSecondFor(MODE_DREAM);
+    nativeAdvanceMillis(frameMs);
+    ms += frameMs;
+    uint16_t pos[7 * 4];
+    for (int i = 0; i < 7 * 4; i++) {
+      pos[i] = frameArena.blendPos[i];
+    }
+    dreamWordFrame(false, nullptr, 0, frameMs * 1000);
+    shown |= dreamWord.showing();
+    hidden |= shown && !dreamWord.showing();
+    if (!hidden) {
+      continue;
+    }
+    // New random sequences (newSequence() rewinds the blend)
+    uint32_t frameRestarts = 0;
+    for (int i = 0; i < 7 * 4; i++) {
+      frameRestarts += frameArena.blendPos[i] < pos[i];
+    }
+    restarts += frameRestarts;
+    worst = max(worst, frameRestarts);
+    afterHideMs += frameMs;
+    if (afterHideMs >= 12000) {
+      break;
+    }
+  }
+  dreamWord.stop();
+  return hidden ? worst : 7 * 4;
+}
+
+static void benchDreamWords() {
+  const uint32_t cycle = DREAM_WORD_PAUSE_MS + DREAM_WORD_DISPLAY_MS;
+  uint32_t resumes = 0, skipResumes = 0;
+  bool traceOk = playDreamCycles(1000, 0, 3, resumes);
+  // Two skips (half a pause each), and across the millis() wraparound
+  traceOk &= playDreamCycles(0xFFFFFFFF - 40000, 2, 2, skipResumes);
+
+  // A table without a timed step must stop instead of spinning
+  static const ChoreoStep broken[] = {
+      {CHOREO_SHOW, 0, 255, 1000}, {CHOREO_HIDE, 0, 0, 0},
+      {CHOREO_LOOP, 0, 0, 0}};
+  Choreographer player;
+  player.start(broken, benchPickWord, 0, 0);
+  player.resume(0);
+  traceOk &= !player.playing();
+
+  // A skip resumed late must not push the next pick back
+  dreamSkips = 1;
+  player.start(DREAM_WORD_CHOREOGRAPHY, benchPickWord, 0, 0);
+  player.resume(0);
+  player.resume(DREAM_WORD_PAUSE_MS + 40);
+  traceOk &= player.nextResume() == DREAM_WORD_PAUSE_MS * 3 / 2;
+
+  // The real thing, at the dream frame rates
+  prepareDream();
+  uint32_t frames = 0, idleFrames = 0, shownFrames = 0, slowTweens = 0;
+  uint64_t idleNs = 0, resumeNs = 0;
+  uint32_t before = dreamWord.resumes;
+  allocCount = 0;
+  countAllocs = true;
+  for (uint32_t ms = 0; ms < 3 * cycle;) {
+    uint32_t frameMs = 1000 / framesPerSecondFor(MODE_DREAM);
+    nativeAdvanceMillis(frameMs);
+    ms += frameMs;
+    uint32_t resumed = dreamWord.resumes;
+    auto t0 = std::chrono::steady_clock::now();
+    updateDreamWord();
+    auto t1 = std::chrono::steady_clock::now();
+    uint64_t ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+    if (dreamWord.resumes == resumed) {
+      idleNs += ns;
+      idleFrames++;
+    } else {
+      resumeNs += ns;
+      // No keyframe may take longer than the interval to the next resume
+      for (int i = 0; i < 7 * 4; i++) {
+        slowTweens += segments[i].mode() == TWEEN &&
+                      frameArena.tweenRate[i] <
+                          tweenRateFor(DREAM_WORD_KEYFRAME_MS);
+      }
+    }
+    shownFrames += dreamWord.showing();
+    frames++;
+  }
+  countAllocs = false;
+  uint32_t frameResumes = dreamWord.resumes - before;
+
+  printf("\n%-14s %8s %8s %9s %10s %10s %8s %6s\n", "dream words", "frames",
+         "resumes", "per cycle", "idle ns", "resume ns", "allocs", "check");
+  printf("%-14s %8s %8u %9.1f %10s %10s %8s %6s\n", "trace", "-", resumes,
+         resumes / 3.0, "-", "-", "-", traceOk ? "ok" : "BAD");
+  printf("%-14s %8u %8u %9.1f %10.1f %10.1f %8u %6s\n", "updateDreamWord",
+         frames, frameResumes, frameResumes / 3.0,
+         (double)idleNs / max(idleFrames, 1u),
+         (double)resumeNs / max(frameResumes, 1u), allocCount,
+         (shownFrames > 0 && idleFrames > 0 && slowTweens == 0 &&
+          allocCount == 0)
+             ? "ok"
+             : "BAD");
+  if (!benchDreamWordFrames()) {
+    printf("word frames: BAD\n");
+  }
+  uint32_t hideRestarts = 0;
+  uint32_t hideWorst = benchDreamWordHide(hideRestarts);
+  printf("%-14s %8u restarts in 12 s, at most %u in one frame %6s\n",
+         "after hide", hideRestarts, hideWorst,
+         (hideRestarts > 7 && hideWorst <= 4) ? "ok" : "BAD");
+}
+
+// ============================================================================
+// Low-Power Check
+// ============================================================================
+
+// The main loop (1 ms of work per iteration) from Sunday 23:00, outside the
+// default schedule, across the Monday 08:00 edge
+static void benchPower() {
+  resetState(DateTime(2025, 1, 19, 23, 0, 0), true);
+  const DateTime edge(2025, 1, 20, 8, 0, 0);
+  const uint64_t endMicros =
+      nativeClockMicros + ((edge - getCurrentTime()).totalseconds() + 30) *
+                              1000000ULL;
+  uint32_t offLoops = 0, offShows = 0;
+  uint64_t offMicros = 0;
+  uint32_t offMhz = 0;
+  uint8_t busyPercent = 100;
+
+  while (nativeClockMicros < endMicros) {
+    uint64_t t0 = nativeClockMicros;
+    bool off = (currentMode == MODE_OFF);
+    uint32_t queuedBefore = nativeSpi.queued;
+    nativeAdvanceMillis(1);
+    loopLEDs();
+    loopPower();
+    if (off && currentMode == MODE_OFF) {
+      offLoops++;
+      offShows += nativeSpi.queued - queuedBefore;
+      offMicros += nativeClockMicros - t0;
+      offMhz = getCpuFrequencyMhz();
+      busyPercent = powerStats.busyPercent;
+    }
+  }
+
+  printf("\n%-14s %10s %8s %8s %10s %10s %8s\n", "power", "loops/s", "busy %",
+         "cpu MHz", "off shows", "wake ms", "mode");
+  printf("%-14s %10.1f %8u %8u %10u %10u %8s\n", "MODE_OFF",
+         offLoops * 1e6 / offMicros, busyPercent, offMhz, offShows,
+         powerStats.lastWakeLatencyMs,
+         currentMode == MODE_DREAM ? "DREAM" : "BAD");
+}
+
+// ============================================================================
+// Scheduler Check
+// ============================================================================
+// A separate wheel driven across the 49-day millis() wraparound. Each timer
+// re-arms itself with a random delay; it must fire in the first update at or
+// after its deadline, never before.
+const int WHEEL_TEST_TIMERS = 6;
+static Scheduler *testWheel;
+static TimerHandle testHandles[WHEEL_TEST_TIMERS];
+static uint64_t testDeadline[WHEEL_TEST_TIMERS]; // Virtual ms
+static uint64_t testPrevUpdate;
+static uint32_t testFires, testEarly, testLate;
+static uint64_t insertNs, inserts;
+
+template <int N> static void testFire();
+
+template <int N> static void testArm() {
+  // Mostly short delays, the odd long one (up to 3 days)
+  uint32_t delay = random8() == 0 ? random(1, 3L * 86400000)
+                                  : random(1, 600000);
+  testDeadline[N] = nativeClockMicros / 1000 + delay;
+  auto t0 = std::chrono::steady_clock::now();
+  testHandles[N] = testWheel->after(delay, testFire<N>);
+  auto t1 = std::chrono::steady_clock::now();
+  insertNs +=
+      std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+  inserts++;
+}
+
+template <int N> static void testFire() {
+  uint64_t now = nativeClockMicros / 1000;
+  testFires++;
+  testEarly += now < testDeadline[N];
+  testLate += testPrevUpdate >= testDeadline[N]; // An earlier update missed it
+  testArm<N>();
+}
+
+typedef void (*ArmFn)();
+static const ArmFn testArmFns[WHEEL_TEST_TIMERS] = {
+    testArm<0>, testArm<1>, testArm<2>, testArm<3>, testArm<4>, testArm<5>};
+
+static bool wallFired;
+static void wallFire() { wallFired = true; }
+
+static void benchScheduler() {
+  // Start one day before millis() wraps, run for four days
+  uint64_t wrapMs = 1ULL << 32;
+  nativeSetMillis(wrapMs - 86400000ULL);
+  uint64_t endMs = wrapMs + 3 * 86400000ULL;
+  Scheduler wheel;
+  testWheel = &wheel;
+  testFires = testEarly = testLate = 0;
+  insertNs = inserts = 0;
+  randomSeed(11);
+  random16_set_seed(11);
+  for (int i = 0; i < WHEEL_TEST_TIMERS; i++)
+    testArmFns[i]();
+
+  uint64_t updateNs = 0, updates = 0, cancels = 0, cancelNs = 0;
+  while (nativeClockMicros / 1000 < endMs) {
+    testPrevUpdate = nativeClockMicros / 1000;
+    // Frame-sized steps with the odd multi-hour stall
+    nativeAdvanceMillis(random16() < 4 ? random(0, 4 * 3600000L)
+                                        : random(1, 300));
+    auto t0 = std::chrono::steady_clock::now();
+    wheel.update();
+    auto t1 = std::chrono::steady_clock::now();
+    updateNs +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+    updates++;
+
+    // Cancel and re-arm now and then
+    if (random16() < 64) {
+      int n = random(0, WHEEL_TEST_TIMERS);
+      auto c0 = std::chrono::steady_clock::now();
+      wheel.cancel(testHandles[n]);
+      auto c1 = std::chrono::steady_clock::now();
+      cancelNs +=
+          std::chrono::duration_cast<std::chrono::nanoseconds>(c1 - c0)
+              .count();
+      cancels++;
+      testArmFns[n]();
+    }
+  }
+  bool leak = wheel.activeCount() != WHEEL_TEST_TIMERS;
+
+  // Stale handle: cancelling a fired timer must not touch the slot's new
+  // occupant
+  TimerHandle stale = wheel.after(10, wallFire);
+  TimerHandle copy = stale;
+  nativeAdvanceMillis(20);
+  wheel.update();
+  TimerHandle reused = wheel.after(1000, wallFire);
+  wheel.cancel(copy);
+  bool staleOk = wheel.pending(reused);
+  wheel.cancel(reused);
+
+  // Wall clock: 1 h ahead, then the clock is set 30 min forward
+  setRTCTime(10, 0, 0, 15, 1, 2025);
+  wallFired = false;
+  wheel.atUnix(DateTime(2025, 1, 15, 11, 0, 0).unixtime(), wallFire);
+  nativeAdvanceMillis(60000);
+  wheel.update();
+  setRTCTime(10, 31, 0, 15, 1, 2025);
+  wheel.clockChanged(); // setRTCTime() only re-places the global scheduler
+  uint32_t wallMs = 0;
+  while (!wallFired && wallMs < 7200000) {
+    nativeAdvanceMillis(100);
+    wallMs += 100;
+    wheel.update();
+  }
+  bool wallOk = wallFired && wallMs >= 29 * 60000 && wallMs <= 29 * 60000 + 100;
+  testWheel = nullptr;
+
+  printf("\n%-14s %8s %6s %6s %10s %10s %10s %6s %6s %6s\n", "scheduler",
+         "fires", "early", "late", "ns/insert", "ns/cancel", "ns/update",
+         "leak", "stale", "wall");
+  printf("%-14s %8u %6u %6u %10.1f %10.1f %10.1f %6s %6s %6s\n",
+         "wrap +-49d", testFires, testEarly, testLate,
+         (double)insertNs / inserts, (double)cancelNs / cancels,
+         (double)updateNs / updates, leak ? "BAD" : "ok",
+         staleOk ? "ok" : "BAD", wallOk ? "ok" : "BAD");
+}
+
+// ============================================================================
+// Boot Check
+// ============================================================================
+// The foreground stages of setup() (host time per stage), then virtual time
+// from "display ready" to the first frame on the strip
+static void benchBoot() {
+  rtc.adjust(ACTIVE_TIME); // A clock that was set, inside active hours
+  typedef void (*StageFn)();
+  const StageFn stages[] = {setupRTC, setupSettings, setupLEDs};
+  const BootStage marks[] = {BOOT_RTC, BOOT_SETTINGS, BOOT_LEDS};
+  double stageUs[3];
+  for (int i = 0; i < 3; i++) {
+    auto t0 = std::chrono::steady_clock::now();
+    stages[i]();
+    auto t1 = std::chrono::steady_clock::now();
+    markBootStage(marks[i]);
+    stageUs[i] =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() /
+        1000.0;
+  }
+  while (!bootStageDone(BOOT_FIRST_FRAME)) {
+    nativeAdvanceMillis(1);
+    loopLEDs();
+  }
+  printf("%-14s %10s %12s %10s %16s\n", "boot", "rtc us", "settings us",
+         "leds us", "first frame ms");
+  printf("%-14s %10.1f %12.1f %10.1f %16.1f\n", "foreground", stageUs[0],
+         stageUs[1], stageUs[2],
+         (bootStageMicros[BOOT_FIRST_FRAME] - bootStageMicros[BOOT_LEDS]) /
+             1000.0);
+}
+
+// ============================================================================
+// Command Queue Check
+// ============================================================================
+// Push-to-apply latency of web commands in virtual time, for a command every
+// 37 ms while the main loop (1 ms of work per iteration) runs in each mode.
+// Commands arriving during an idle wait are stamped with their arrival time.
+static void benchCommandLatency(const char *name, void (*prepare)()) {
+  prepare();
+  commandStats = CommandStats();
+  commandsRejected = 0;
+  const uint64_t endMicros = nativeClockMicros + 10000000ULL;
+  uint64_t nextPush = nativeClockMicros;
+  while (nativeClockMicros < endMicros) {
+    while (nativeClockMicros >= nextPush) {
+      Command command = makeCommand(CMD_SET_TIMEZONE);
+      strcpy(command.timezone, "Europe/Vienna");
+      command.enqueuedMicros = nextPush;
+      if (!commandQueue.push(command)) {
+        commandsRejected++;
+      }
+      nextPush += 37000;
+    }
+    nativeAdvanceMillis(1);
+    loopLEDs();
+    loopPower();
+  }
+  printf("%-14s %8u %8u %10.1f %10u\n", name, commandStats.applied,
+         commandStats.rejected,
+         (double)commandStats.totalLatencyMicros / commandStats.applied,
+         commandStats.maxLatencyMicros);
+}
+
+// A producer thread against the consumer on this one, through a ring of the
+// firmware's size: every command must arrive once, in order
+static void benchCommandStress(uint32_t count) {
+  static SpscQueue<Command, COMMAND_QUEUE_SIZE> ring;
+  std::atomic<uint32_t> fullSpins(0);
+
+  auto t0 = std::chrono::steady_clock::now();
+  std::thread producer([count, &fullSpins]() {
+    Command command = makeCommand(CMD_SET_INTERVAL);
+    for (uint32_t seq = 0; seq < count; seq++) {
+      command.enqueuedMicros = seq;
+      command.interval = seq & 0xFFFF;
+      while (!ring.push(command)) {
+        fullSpins.fetch_add(1, std::memory_order_relaxed);
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  uint32_t received = 0, misordered = 0, emptySpins = 0;
+  Command command;
+  while (received < count) {
+    if (!ring.pop(command)) {
+      emptySpins++;
+      std::this_thread::yield();
+      continue;
+    }
+    if (command.enqueuedMicros != received ||
+        command.interval != (received & 0xFFFF)) {
+      misordered++;
+    }
+    received++;
+  }
+  producer.join();
+  auto t1 = std::chrono::steady_clock::now();
+
+  double ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+  printf("%-14s %10u %10u %10u %10.1f %8s\n", "2 threads", received,
+         fullSpins.load(), emptySpins, ns / count,
+         (misordered == 0 && ring.empty()) ? "ok" : "BAD");
+}
+
+// Batches of 1-5 commands through pushAll() against a consumer that drains
+// the ring like applyCommands(): a drain (one frame) must never end inside a
+// batch, and every command must arrive once, in order
+static void benchBatchStress(uint32_t batches) {
+  static SpscQueue<Command, COMMAND_QUEUE_SIZE> ring;
+  std::atomic<bool> done(false);
+
+  std::thread producer([batches, &done]() {
+    Command batch[5];
+    uint32_t seq = 0;
+    for (uint32_t b = 0; b < batches; b++) {
+      uint8_t size = b % 5 + 1;
+      for (uint8_t i = 0; i < size; i++) {
+        batch[i] = makeCommand(CMD_SET_INTERVAL);
+        batch[i].enqueuedMicros = seq++;
+        batch[i].interval = size << 8 | i;
+      }
+      while (!ring.pushAll(batch, size)) {
+        std::this_thread::yield();
+      }
+    }
+    done = true;
+  });
+
+  uint32_t received = 0, drains = 0, split = 0, misordered = 0;
+  Command command;
+  bool inBatch = false;
+  while (!done || !ring.empty()) {
+    if (ring.empty()) {
+      std::this_thread::yield();
+      continue;
+    }
+    drains++;
+    while (ring.pop(command)) {
+      misordered += command.enqueuedMicros != received;
+      received++;
+      uint8_t size = command.interval >> 8, index = command.interval & 0xFF;
+      inBatch = index + 1 < size;
+    }
+    split += inBatch; // The frame would publish half a batch
+  }
+  producer.join();
+  printf("%-14s %10u %10u %10u %8s\n", "batches", batches, drains, split,
+         (split == 0 && misordered == 0) ? "ok" : "BAD");
+}
+
+// The /api/state ETag follows every change it reports and nothing else
+static void benchStateVersion() {
+  char before[STATE_ETAG_SIZE], after[STATE_ETAG_SIZE];
+  uint32_t minute = 29000000;
+  formatStateEtag(before, stateVersion.load(), minute);
+  bool unchanged = etagListMatches(before, before);
+
+  SettingsSnapshot &draft = benchDraft();
+  draft.clock.wakeupInterval = draft.clock.wakeupInterval == 15 ? 30 : 15;
+  publishSettings();
+  formatStateEtag(after, stateVersion.load(), minute);
+  bool settingsBump = !etagListMatches(after, before);
+
+  setNetworkState(networkState);
+  char network[STATE_ETAG_SIZE];
+  formatStateEtag(network, stateVersion.load(), minute);
+  bool networkBump = !etagListMatches(network, after);
+
+  formatStateEtag(after, stateVersion.load(), minute + 1);
+  bool minuteBump = !etagListMatches(after, network);
+
+  char list[3 * STATE_ETAG_SIZE];
+  snprintf(list, sizeof(list), "\"x\", W/%s", network);
+  bool weakList = etagListMatches(list, network) &&
+                  !etagListMatches("\"11-29000000\"", "\"1-29000000\"");
+
+  bool ok = unchanged && settingsBump && networkBump && minuteBump && weakList;
+  printf("%-14s %s -> %s -> %s %s\n", "state etag", before, network, after,
+         ok ? "ok" : "BAD");
+}
+
+static void benchCommands(uint32_t count) {
+  printf("\n%-14s %8s %8s %10s %10s\n", "commands", "applied", "rejected",
+         "avg us", "max us");
+  benchCommandLatency("DREAM", prepareDream);
+  benchCommandLatency("WAKEUP", prepareWakeup);
+  benchCommandLatency("OFF", prepareOff);
+
+  printf("\n%-14s %10s %10s %10s %10s %8s\n", "spsc stress", "commands",
+         "full", "empty", "ns/cmd", "order");
+  benchCommandStress(count);
+
+  printf("\n%-14s %10s %10s %10s %8s\n", "batch stress", "batches", "drains",
+         "split", "atomic");
+  benchBatchStress(count / 3);
+  benchStateVersion();
+}
+
+// ============================================================================
+// REST API Check
+// ============================================================================
+// Every GET body is written through JsonWriter into a capture stream (the
+// AsyncResponseStream on the device) and every POST body is assembled in
+// two chunks and parsed, per endpoint: heap allocations and ns per request.
+// The JSON must be well formed, and a POST sent as JSON and as a form must
+// give the same commands.
+struct CapturePrint : Print {
+  char data[4096];
+  size_t length = 0;
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buffer, size_t size) override {
+    size_t n = std::min(size, sizeof(data) - 1 - length);
+    memcpy(data + length, buffer, n);
+    length += n;
+    data[length] = '\0';
+    return n;
+  }
+};
+
+// Minimal JSON grammar check (objects, arrays, strings, literals)
+static bool skipJsonValue(const char *&p) {
+  while (*p == ' ')
+    p++;
+  if (*p == '"') {
+    for (p++; *p != '"'; p++) {
+      if (*p == '\0' || (uint8_t)*p < 0x20)
+        return false;
+      if (*p == '\\')
+        p++;
+    }
+    p++;
+    return true;
+  }
+  if (*p == '{' || *p == '[') {
+    char close = *p == '{' ? '}' : ']';
+    p++;
+    if (*p == close) {
+      p++;
+      return true;
+    }
+    for (;;) {
+      if (close == '}') {
+        if (*p != '"' || !skipJsonValue(p) || *p++ != ':')
+          return false;
+      }
+      if (!skipJsonValue(p))
+        return false;
+      if (*p == close) {
+        p++;
+        return true;
+      }
+      if (*p++ != ',')
+        return false;
+    }
+  }
+  const char *begin = p;
+  while (*p == '-' || *p == '.' || isalnum((uint8_t)*p))
+    p++;
+  return p > begin;
+}
+
+static bool validJson(const char *text) {
+  const char *p = text;
+  return skipJsonValue(p) && *p == '\0';
+}
+
+static void printApiRow(const char *name, uint32_t requests, uint32_t allocs,
+                        uint64_t ns, size_t bytes, bool ok) {
+  printf("%-25s %8zu %10.2f %10.1f %8s\n", name, bytes,
+         (double)allocs / requests, (double)ns / requests, ok ? "ok" : "BAD");
+}
+
+static void benchApiGet(const char *name, void (*write)(JsonWriter &),
+                        uint32_t requests) {
+  static CapturePrint capture;
+  allocCount = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < requests; i++) {
+    capture.length = 0;
+    countAllocs = true;
+    JsonWriter json(capture);
+    write(json);
+    json.finish();
+    countAllocs = false;
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  uint64_t ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+  printApiRow(name, requests, allocCount, ns, capture.length,
+              validJson(capture.data) && !responseArenaBusy);
+}
+
+static void writeBenchState(JsonWriter &json) {
+  writeStateJson(json, stateVersion.load(), getPublishedTime());
+}
+
+static void writeBenchStats(JsonWriter &json) {
+  static PreviewClientState clients[PREVIEW_MAX_CLIENTS];
+  static const PreviewStats preview = {120, 3};
+  clients[0].id = 1;
+  clients[0].intervalMs = 50;
+  clients[1].id = 2;
+  clients[1].intervalMs = 400;
+  writeStatsJson(json, preview, clients, clients);
+}
+
+// Assemble body in two chunks and parse it with parser; the resulting
+// commands go to out (count of them in count)
+static bool benchApiPostOnce(const char *body, ArgsParser parser,
+                             Command *out, uint8_t &count) {
+  static int owner;
+  static char chunk[REQUEST_BODY_BYTES];
+  size_t length = strlen(body), half = length / 2;
+  memcpy(chunk, body, length); // The TCP buffer
+  appendRequestBody(requestBody, &owner, (const uint8_t *)chunk, half, 0,
+                    length, millis());
+  appendRequestBody(requestBody, &owner, (const uint8_t *)chunk + half,
+                    length - half, half, length, millis());
+  RequestFields fields;
+  if (!takeRequestBody(requestBody, &owner, length, fields)) {
+    return false;
+  }
+  if (parser) {
+    count = parser(fields, out[0]) == ARGS_OK;
+    return count == 1;
+  }
+  return parseStateArgs(fields, out, count) == ARGS_OK;
+}
+
+static bool benchApiPost(const char *name, const char *body,
+                         ArgsParser parser, uint32_t requests, Command *out,
+                         uint8_t &count) {
+  bool ok = true;
+  allocCount = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < requests; i++) {
+    countAllocs = true;
+    ok &= benchApiPostOnce(body, parser, out, count);
+    countAllocs = false;
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  uint64_t ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+  printApiRow(name, requests, allocCount, ns, strlen(body), ok);
+  return ok;
+}
+
+// Commands equal apart from their timestamps
+static bool sameCommands(const Command *a, const Command *b, uint8_t count) {
+  for (uint8_t i = 0; i < count; i++) {
+    Command x = a[i], y = b[i];
+    x.enqueuedMicros = y.enqueuedMicros = 0;
+    if (memcmp(&x, &y, sizeof(x)) != 0)
+      return false;
+  }
+  return true;
+}
+
+static void benchApi(uint32_t requests) {
+  prepareDream();
+  printf("\n%-25s %8s %10s %10s %8s\n", "api request", "bytes",
+         "allocs/req", "ns/req", "check");
+  benchApiGet("GET /api/state", writeBenchState, requests);
+  benchApiGet("GET /api/time", writeTimeJson, requests);
+  benchApiGet("GET /api/timezone", writeTimezoneJson, requests);
+  benchApiGet("GET /api/active-hours", writeActiveHoursJson, requests);
+  benchApiGet("GET /api/wakeup-interval", writeWakeupIntervalJson, requests);
+  benchApiGet("GET /api/network", writeNetworkJson, requests);
+  benchApiGet("GET /api/stats", writeBenchStats, requests);
+
+  Command single[STATE_ARGS_GROUPS];
+  uint8_t count = 0;
+  benchApiPost("POST /api/time",
+               "hours=14&minutes=30&day=19&month=12&year=2024", parseTimeArgs,
+               requests, single, count);
+  benchApiPost("POST /api/timezone", "timezone=America%2FNew_York",
+               parseTimezoneArgs, requests, single, count);
+  bool timezoneOk = strcmp(single[0].timezone, "America/New_York") == 0;
+  benchApiPost("POST /api/active-hours",
+               "enabled=true&day1_enabled=1&day1_start=7&day1_start_min=30",
+               parseScheduleArgs, requests, single, count);
+  benchApiPost("POST /api/wakeup-interval", "interval=30", parseIntervalArgs,
+               requests, single, count);
+  benchApiPost("POST /api/network",
+               "mode=1&ssid=My+Wifi&password=p%26ss&fallback=true",
+               parseNetworkArgs, requests, single, count);
+  bool networkOk = strcmp(single[0].network.ssid, "My Wifi") == 0 &&
+                   strcmp(single[0].network.password, "p&ss") == 0;
+
+  // The whole settings page in one batch, as JSON (like settings.html) and
+  // as a form
+  static char json[REQUEST_BODY_BYTES], form[REQUEST_BODY_BYTES];
+  int j = snprintf(json, sizeof(json),
+                   "{\"hours\":\"14\",\"minutes\":\"30\",\"day\":\"19\","
+                   "\"month\":\"12\",\"year\":\"2024\",\"timezone\":"
+                   "\"Europe\\/Vienna\",\"enabled\":true");
+  int f = snprintf(form, sizeof(form),
+                   "hours=14&minutes=30&day=19&month=12&year=2024&timezone="
+                   "Europe%%2FVienna&enabled=true");
+  for (int d = 0; d < 7; d++) {
+    j += snprintf(json + j, sizeof(json) - j,
+                  ",\"day%d_enabled\":\"true\",\"day%d_start\":8,"
+                  "\"day%d_start_min\":15,\"day%d_end\":22,"
+                  "\"day%d_end_min\":45",
+                  d, d, d, d, d);
+    f += snprintf(form + f, sizeof(form) - f,
+                  "&day%d_enabled=true&day%d_start=8&day%d_start_min=15"
+                  "&day%d_end=22&day%d_end_min=45",
+                  d, d, d, d, d);
+  }
+  snprintf(json + j, sizeof(json) - j,
+           ",\"interval\":\"60\",\"mode\":\"1\",\"ssid\":\"Caf\\u00e9\","
+           "\"password\":\"\",\"fallback\":\"true\",\"apply\":\"false\"}");
+  snprintf(form + f, sizeof(form) - f,
+           "&interval=60&mode=1&ssid=Caf%%C3%%A9&password=&fallback=true"
+           "&apply=false");
+
+  Command fromJson[STATE_ARGS_GROUPS], fromForm[STATE_ARGS_GROUPS];
+  uint8_t jsonCount = 0, formCount = 0;
+  benchApiPost("POST /api/state (json)", json, nullptr, requests, fromJson,
+               jsonCount);
+  benchApiPost("POST /api/state (form)", form, nullptr, requests, fromForm,
+               formCount);
+
+  // Rejections: nested JSON, unterminated string, a body too large
+  RequestFields fields;
+  char nested[] = "{\"a\":{\"b\":1}}", open[] = "{\"a\":\"b}";
+  bool rejects = !fields.parseJson(nested, strlen(nested)) &&
+                 !fields.parseJson(open, strlen(open));
+  static int owner;
+  uint8_t big[64] = {0};
+  appendRequestBody(requestBody, &owner, big, sizeof(big), 0,
+                    REQUEST_BODY_BYTES + 1, millis());
+  rejects &= !takeRequestBody(requestBody, &owner, REQUEST_BODY_BYTES + 1,
+                              fields);
+
+  bool same = jsonCount == STATE_ARGS_GROUPS && formCount == jsonCount &&
+              sameCommands(fromJson, fromForm, jsonCount) &&
+              strcmp(fromJson[1].timezone, "Europe/Vienna") == 0 &&
+              fromJson[2].schedule.days[6].endMinute == 45 &&
+              strcmp(fromJson[4].network.ssid, "Caf\xc3\xa9") == 0;
+  printf("%-25s %8s %10s %10s %8s\n", "json == form", "", "", "",
+         (same && timezoneOk && networkOk && rejects) ? "ok" : "BAD");
+}
+
+// GET /api/time on a second thread (the AsyncTCP task) while the loop runs
+// updateTime() for a simulated day against a slow DS1307, so resyncs move
+// the base back and forth. The handler only reads the published time: every
+// body must be well formed and the time it saw must never go back. Run
+// under -fsanitize=thread to check that nothing else is shared.
+static void benchWebTime() {
+  rtc.driftPpm = -500;
+  rtc.adjust(ACTIVE_TIME);
+  setupRTC();
+  std::atomic<bool> done(false);
+  std::atomic<uint32_t> requests(0), broken(0), backwards(0);
+
+  std::thread web([&]() {
+    static CapturePrint capture;
+    uint32_t last = 0;
+    while (!done.load(std::memory_order_acquire)) {
+      capture.length = 0;
+      JsonWriter json(capture);
+      writeTimeJson(json);
+      json.finish();
+      uint32_t unixTime = getPublishedTime().unixtime();
+      if (!validJson(capture.data)) {
+        broken.fetch_add(1, std::memory_order_relaxed);
+      }
+      if ((int32_t)(unixTime - last) < 0) {
+        backwards.fetch_add(1, std::memory_order_relaxed);
+      }
+      last = unixTime;
+      requests.fetch_add(1, std::memory_order_relaxed);
+    }
+  });
+
+  const uint32_t stepMs = 250;
+  uint32_t syncsBefore = timeService.syncs;
+  for (uint32_t i = 0; i < 24UL * 3600 * 1000 / stepMs; i++) {
+    nativeAdvanceMillis(stepMs);
+    updateTime();
+  }
+  done.store(true, std::memory_order_release);
+  web.join();
+  rtc.driftPpm = 0;
+
+  printf("\n%-25s %10s %10s %10s %8s\n", "web time", "requests", "resyncs",
+         "backwards", "check");
+  printf("%-25s %10u %10u %10u %8s\n", "GET /api/time vs loop",
+         requests.load(), timeService.syncs - syncsBefore, backwards.load(),
+         (requests > 0 && broken == 0 && backwards == 0) ? "ok" : "BAD");
+}
+
+// ============================================================================
+// Captive Probe Check
+// ============================================================================
+// Route lookup for every probe URL and for ordinary requests (which must
+// miss), and the probe -> portal time of scripted bursts
+static_assert(probeHash("a") == 0xe40c292cu, "FNV-1a at compile time");
+
+static void benchProbes(uint32_t lookups) {
+  static const char *const misses[] = {"/", "/settings", "/api/state",
+                                       "/style.css", "/favicon.ico",
+                                       "/generate_2040", ""};
+  const uint8_t routes = sizeof(PROBE_ROUTES) / sizeof(PROBE_ROUTES[0]);
+  bool routesOk = true;
+  for (const ProbeRoute &route : PROBE_ROUTES) {
+    char path[64];
+    strcpy(path, route.path); // Not the table's own pointer
+    routesOk &= findProbeRoute(path) == &route;
+  }
+  for (const char *miss : misses) {
+    routesOk &= findProbeRoute(miss) == nullptr;
+  }
+
+  const char *urls[routes + 7];
+  uint8_t count = 0;
+  for (const ProbeRoute &route : PROBE_ROUTES) {
+    urls[count++] = route.path;
+  }
+  for (const char *miss : misses) {
+    urls[count++] = miss;
+  }
+  uint32_t hits = 0;
+  allocCount = 0;
+  countAllocs = true;
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < lookups; i++) {
+    hits += findProbeRoute(urls[i % count]) != nullptr;
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  countAllocs = false;
+  double ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+
+  // A phone joins: three probes, the sign-in page opens 1.5 s later, it
+  // keeps probing; an hour later a laptop joins
+  ProbeStats stats = ProbeStats();
+  const ProbeRoute &android = *findProbeRoute("/generate_204");
+  const ProbeRoute &windows = *findProbeRoute("/connecttest.txt");
+  uint32_t t = 5000;
+  noteProbe(stats, android, t, 40);
+  noteProbe(stats, android, t + 20, 35);
+  noteProbe(stats, android, t + 40, 38);
+  notePortalOpened(stats, t + 1500);
+  noteProbe(stats, android, t + 5000, 30);
+  notePortalOpened(stats, t + 9000); // Page reload, not a new burst
+  bool burstsOk = stats.bursts == 1 && stats.lastPortalMs == 1500;
+  t += 3600000;
+  noteProbe(stats, windows, t, 50);
+  notePortalOpened(stats, t + 800);
+  burstsOk &= stats.bursts == 2 && stats.lastPortalMs == 800 &&
+              stats.answered[PROBE_ANDROID] == 4 &&
+              stats.answered[PROBE_WINDOWS] == 1 && stats.maxMicros == 50;
+
+  printf("\n%-14s %8s %10s %10s %8s %8s\n", "probe routes", "routes",
+         "ns/lookup", "allocs", "bursts", "check");
+  printf("%-14s %8u %10.1f %10u %8u %8s\n", "lookup", routes, ns / lookups,
+         allocCount, stats.bursts,
+         (routesOk && burstsOk && hits > 0) ? "ok" : "BAD");
+}
+
+// ============================================================================
+// Captive DNS Check
+// ============================================================================
+// A capture of what phones and laptops ask right after joining the access
+// point, plus malformed packets, is replayed twice: straight through
+// answerDnsQuery() for the per-query cost, then through the responder task
+// and the stand-in socket (lwip/sockets.h) for the round trip. Every reply
+// is checked byte by byte against the expected answer.
+enum DnsExpect { DNS_EXPECT_ADDRESS, DNS_EXPECT_EMPTY, DNS_EXPECT_DROP };
+
+enum DnsMangle {
+  DNS_AS_IS,
+  DNS_EDNS,          // OPT additional record (dig, Firefox, iOS)
+  DNS_RESPONSE,      // QR set
+  DNS_STATUS,        // Opcode 2
+  DNS_TWO_QUESTIONS, // QDCOUNT 2
+  DNS_POINTER,       // Compressed question name
+  DNS_CUT_NAME,      // Ends inside the name
+  DNS_CUT_CLASS,     // Ends before the class
+  DNS_SHORT,         // Ends inside the header
+};
+
+struct DnsCapture {
+  const char *name;
+  uint16_t type;
+  uint8_t flags; // Header byte 2 (0x01: recursion desired)
+  DnsMangle mangle;
+  DnsExpect expect;
+};
+
+static const DnsCapture dnsCaptures[] = {
+    {"connectivitycheck.gstatic.com", 1, 0x01, DNS_AS_IS, DNS_EXPECT_ADDRESS},
+    {"connectivitycheck.gstatic.com", 28, 0x01, DNS_AS_IS, DNS_EXPECT_EMPTY},
+    {"_dns.resolver.arpa", 64, 0x01, DNS_AS_IS, DNS_EXPECT_EMPTY},
+    {"www.google.com", 1, 0x01, DNS_AS_IS, DNS_EXPECT_ADDRESS},
+    {"captive.apple.com", 1, 0x01, DNS_EDNS, DNS_EXPECT_ADDRESS},
+    {"captive.apple.com", 65, 0x01, DNS_EDNS, DNS_EXPECT_EMPTY},
+    {"cApTiVe.ApPlE.cOm", 1, 0x00, DNS_AS_IS, DNS_EXPECT_ADDRESS},
+    {"www.msftconnecttest.com", 1, 0x01, DNS_AS_IS, DNS_EXPECT_ADDRESS},
+    {"dns.msftncsi.com", 28, 0x01, DNS_AS_IS, DNS_EXPECT_EMPTY},
+    {"detectportal.firefox.com", 1, 0x01, DNS_EDNS, DNS_EXPECT_ADDRESS},
+    {"dreaming-clock.local", 255, 0x01, DNS_AS_IS, DNS_EXPECT_ADDRESS},
+    {"captive.apple.com", 1, 0x81, DNS_RESPONSE, DNS_EXPECT_DROP},
+    {"captive.apple.com", 1, 0x10, DNS_STATUS, DNS_EXPECT_DROP},
+    {"captive.apple.com", 1, 0x01, DNS_TWO_QUESTIONS, DNS_EXPECT_DROP},
+    {"captive.apple.com", 1, 0x01, DNS_POINTER, DNS_EXPECT_DROP},
+    {"captive.apple.com", 1, 0x01, DNS_CUT_NAME, DNS_EXPECT_DROP},
+    {"captive.apple.com", 1, 0x01, DNS_CUT_CLASS, DNS_EXPECT_DROP},
+    {"captive.apple.com", 1, 0x01, DNS_SHORT, DNS_EXPECT_DROP},
+};
+static const uint8_t DNS_CAPTURES =
+    sizeof(dnsCaptures) / sizeof(dnsCaptures[0]);
+
+struct DnsPacket {
+  uint8_t data[DNS_MAX_PACKET];
+  uint16_t length;
+  uint16_t questionBytes; // Name, type and class
+};
+
+static void buildDnsPacket(const DnsCapture &capture, uint16_t id,
+                           DnsPacket &packet) {
+  uint8_t *p = packet.data;
+  const uint8_t header[DNS_HEADER_BYTES] = {
+      (uint8_t)(id >> 8), (uint8_t)id, capture.flags, 0, 0,
+      (uint8_t)(capture.mangle == DNS_TWO_QUESTIONS ? 2 : 1), 0, 0, 0, 0, 0,
+      (uint8_t)(capture.mangle == DNS_EDNS ? 1 : 0)};
+  memcpy(p, header, sizeof(header));
+  p += sizeof(header);
+  if (capture.mangle == DNS_POINTER) {
+    *p++ = 0xC0;
+    *p++ = DNS_HEADER_BYTES;
+  } else {
+    for (const char *label = capture.name; *label;) {
+      const char *dot = strchr(label, '.');
+      uint8_t length = dot ? dot - label : strlen(label);
+      *p++ = length;
+      memcpy(p, label, length);
+      p += length;
+      label += length + (dot ? 1 : 0);
+    }
+    *p++ = 0;
+  }
+  *p++ = capture.type >> 8;
+  *p++ = capture.type;
+  *p++ = 0;
+  *p++ = 1; // IN
+  packet.questionBytes = p - packet.data - DNS_HEADER_BYTES;
+  if (capture.mangle == DNS_EDNS) {
+    static const uint8_t opt[] = {0, 0, 41, 0x10, 0, 0, 0, 0, 0, 0, 0};
+    memcpy(p, opt, sizeof(opt));
+    p += sizeof(opt);
+  }
+  packet.length = p - packet.data;
+  if (capture.mangle == DNS_CUT_NAME) {
+    packet.length = DNS_HEADER_BYTES + 4;
+  } else if (capture.mangle == DNS_CUT_CLASS) {
+    packet.length -= 2;
+  } else if (capture.mangle == DNS_SHORT) {
+    packet.length = 8;
+  }
+}
+
+// The reply the capture must get, written out independently of dns.h
+static bool dnsReplyOk(const DnsCapture &capture, const DnsPacket &query,
+                       const uint8_t *reply, uint16_t length) {
+  static const uint8_t answer[DNS_ANSWER_BYTES] = {
+      0xC0, 12, 0, 1, 0, 1, 0, 0, 0, 60, 0, 4, 192, 168, 4, 1};
+  if (capture.expect == DNS_EXPECT_DROP) {
+    return length == 0;
+  }
+  bool address = capture.expect == DNS_EXPECT_ADDRESS;
+  const uint8_t header[DNS_HEADER_BYTES] = {
+      query.data[0], query.data[1], (uint8_t)(0x84 | (capture.flags & 0x01)),
+      0, 0, 1, 0, (uint8_t)address, 0, 0, 0, 0};
+  return length == DNS_HEADER_BYTES + query.questionBytes +
+                       (address ? DNS_ANSWER_BYTES : 0) &&
+         memcmp(reply, header, sizeof(header)) == 0 &&
+         memcmp(reply + DNS_HEADER_BYTES, query.data + DNS_HEADER_BYTES,
+                query.questionBytes) == 0 &&
+         (!address || memcmp(reply + DNS_HEADER_BYTES + query.questionBytes,
+                             answer, sizeof(answer)) == 0);
+}
+
+// One capture through the task: reply received (or none, if dropped) and
+// correct. Replies add their round trip to micros.
+static bool replayDnsQuery(const DnsCapture &capture, uint16_t id,
+                           uint64_t &micros, uint32_t &replies) {
+  DnsPacket packet;
+  buildDnsPacket(capture, id, packet);
+  for (uint16_t ms = 0; ms < 1000 && nativeUdp().boundPort() != DNS_PORT;
+       ms++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1)); // Task start
+  }
+  NativeDatagram reply;
+  auto t0 = std::chrono::steady_clock::now();
+  if (!nativeUdp().deliver(packet.data, packet.length, 40000 + id)) {
+    return false;
+  }
+  bool dropped = capture.expect == DNS_EXPECT_DROP;
+  if (!nativeUdp().takeSent(reply, dropped ? 20 : 1000)) {
+    return dropped;
+  }
+  micros += std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - t0)
+                .count();
+  replies++;
+  return !dropped && ntohs(reply.peer.sin_port) == 40000 + id &&
+         dnsReplyOk(capture, packet, reply.data.data(), reply.data.size());
+}
+
+static void benchDns(uint32_t queries) {
+  // Straight through the reply builder
+  DnsTemplate dns;
+  DnsStats stats = DnsStats();
+  prepareDnsTemplate(dns, apIP);
+  DnsPacket packets[DNS_CAPTURES];
+  bool replayOk = true;
+  for (uint8_t i = 0; i < DNS_CAPTURES; i++) {
+    buildDnsPacket(dnsCaptures[i], 0x1000 + i, packets[i]);
+    uint16_t length =
+        answerDnsQuery(dns, packets[i].data, packets[i].length, stats);
+    replayOk &= dnsReplyOk(dnsCaptures[i], packets[i], dns.reply, length);
+  }
+  stats = DnsStats();
+  uint32_t replyBytes = 0;
+  allocCount = 0;
+  countAllocs = true;
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < queries; i++) {
+    const DnsPacket &packet = packets[i % DNS_CAPTURES];
+    replyBytes += answerDnsQuery(dns, packet.data, packet.length, stats);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  countAllocs = false;
+  double ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+  replayOk &= replyBytes > 0 &&
+              stats.answered + stats.empty + stats.dropped == queries;
+
+  // Through the task: the capture, a restart while the task is still up
+  // (it must keep its socket) and a restart after it ended
+  bool taskOk = waitDnsIdle() == 0 && startCaptiveDns(apIP);
+  uint64_t micros = 0;
+  uint32_t replies = 0;
+  for (uint8_t i = 0; i < DNS_CAPTURES; i++) {
+    taskOk &= replayDnsQuery(dnsCaptures[i], i, micros, replies);
+  }
+  uint32_t opens = nativeUdp().opens;
+  stopCaptiveDns();
+  startCaptiveDns(apIP);
+  taskOk &= replayDnsQuery(dnsCaptures[0], 100, micros, replies);
+  taskOk &= nativeUdp().opens == opens;
+  stopCaptiveDns();
+  uint32_t stopMs = waitDnsIdle();
+  taskOk &= nativeUdp().boundPort() == 0 && stopMs <= DNS_RECV_TIMEOUT_MS + 100;
+  startCaptiveDns(apIP);
+  taskOk &= replayDnsQuery(dnsCaptures[4], 101, micros, replies);
+  taskOk &= nativeUdp().opens == opens + 1;
+  stopCaptiveDns();
+  taskOk &= waitDnsIdle() != 0xFFFFFFFF && dnsStats.sendErrors == 0;
+
+  printf("\n%-14s %8s %10s %8s %8s %8s %6s\n", "captive dns", "queries",
+         "ns/query", "allocs", "rtt us", "stop ms", "check");
+  printf("%-14s %8u %10.1f %8u %8s %8s %6s\n", "replay", queries,
+         ns / queries, allocCount, "-", "-", replayOk ? "ok" : "BAD");
+  printf("%-14s %8u %10s %8s %8.1f %8u %6s\n", "task", DNS_CAPTURES + 2, "-",
+         "-", (double)micros / max(replies, 1u), stopMs,
+         taskOk ? "ok" : "BAD");
+}
+
+// ============================================================================
+// LED Preview Check
+// ============================================================================
+// Bytes per second a preview client receives, sampled like loopWebSocket()
+// while the main loop runs 10 s in a mode: the old full 87 byte frame every
+// sample against the delta streams. Every message is applied by a client
+// model (as in data/index.html), which must end up showing the live frame.
+template <uint16_t UNITS> struct PreviewViewer {
+  uint8_t rgb[UNITS * 3];
+  int sequence = -1;
+  uint32_t gaps = 0;
+
+  void apply(const uint8_t *message, uint16_t length) {
+    if (message[1] == PREVIEW_KEYFRAME) {
+      memcpy(rgb, message + PREVIEW_HEADER_BYTES, sizeof(rgb));
+      sequence = message[2];
+      return;
+    }
+    if (sequence < 0 || message[2] != ((sequence + 1) & 0xFF)) {
+      gaps++;
+      return;
+    }
+    sequence = message[2];
+    const uint8_t *bitmap = message + PREVIEW_HEADER_BYTES;
+    const uint8_t *p = bitmap + PreviewEncoder<UNITS>::BITMAP_BYTES;
+    for (uint16_t u = 0; u < UNITS; u++) {
+      if (bitmap[u >> 3] & (1 << (u & 7))) {
+        memcpy(rgb + u * 3, p, 3);
+        p += 3;
+      }
+    }
+    gaps += p != message + length;
+  }
+};
+
+static void benchPreviewMode(const char *name, void (*prepare)()) {
+  prepare();
+  static PreviewEncoder<NUM_SEGMENTS> segments;
+  static PreviewEncoder<NUM_LEDS> full;
+  static PreviewViewer<NUM_SEGMENTS> segmentClient;
+  static PreviewViewer<NUM_LEDS> fullClient;
+  static uint8_t message[PreviewEncoder<NUM_LEDS>::MESSAGE_BYTES];
+  segments = PreviewEncoder<NUM_SEGMENTS>();
+  full = PreviewEncoder<NUM_LEDS>();
+
+  // A client connects: keyframe first
+  uint8_t rgb[NUM_SEGMENTS * 3];
+  previewSegments(leds, rgb);
+  segments.encode(rgb, message);
+  segmentClient.apply(message, segments.keyframe(message));
+  full.encode((const uint8_t *)leds, message);
+  fullClient.apply(message, full.keyframe(message));
+  uint32_t segmentBytes = 0, fullBytes = 0;
+
+  uint64_t startMicros = nativeClockMicros;
+  uint32_t samples = 0, lastSample = millis();
+  uint64_t ns = 0;
+  while (nativeClockMicros - startMicros < 10000000ULL) {
+    nativeAdvanceMillis(1);
+    loopLEDs();
+    if (millis() - lastSample >= PREVIEW_INTERVAL_MS) {
+      lastSample = millis();
+      samples++;
+      auto t0 = std::chrono::steady_clock::now();
+      previewSegments(leds, rgb);
+      uint16_t length = segments.encode(rgb, message);
+      auto t1 = std::chrono::steady_clock::now();
+      ns += std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+                .count();
+      if (length) {
+        segmentClient.apply(message, length);
+        segmentBytes += length;
+      }
+      length = full.encode((const uint8_t *)leds, message);
+      if (length) {
+        fullClient.apply(message, length);
+        fullBytes += length;
+      }
+    }
+    loopPower();
+  }
+  double seconds = (nativeClockMicros - startMicros) / 1e6;
+
+  previewSegments(leds, rgb);
+  bool ok = segmentClient.gaps == 0 && fullClient.gaps == 0 &&
+            memcmp(segmentClient.rgb, rgb, sizeof(rgb)) == 0 &&
+            memcmp(fullClient.rgb, leds, sizeof(fullClient.rgb)) == 0;
+  printf("%-14s %8u %10.0f %10.0f %10.0f %10.0f %10.1f %6s\n", name, samples,
+         samples * 87.0 / seconds,
+         segmentBytes / seconds,
+         samples * (double)PreviewEncoder<NUM_LEDS>::KEYFRAME_BYTES / seconds,
+         fullBytes / seconds,
+         samples ? (double)ns / samples : 0.0, ok ? "ok" : "BAD");
+}
+
+// Per-client pacing: three consumers of the segment stream while the
+// display dreams for 20 s. Each link sends its queue at its own speed and
+// acks a message 10 ms after its last byte; the stalled one sends nothing
+// from 5 s to 12 s. The queue must stay within its budget and every message
+// must turn the client into exactly the frame it was encoded from.
+struct PreviewLink {
+  const char *name;
+  uint32_t bytesPerSecond;
+  uint32_t stallFromMs, stallUntilMs;
+};
+
+static const PreviewLink previewLinks[] = {
+    {"fast", 200000, 0, 0},
+    {"slow", 400, 0, 0},
+    {"stalled", 200000, 5000, 12000},
+};
+
+struct QueuedPreview {
+  std::vector<uint8_t> message;
+  uint32_t remaining; // Bytes not sent yet
+  uint32_t ackAt;     // Once sent
+  uint32_t sampledAt;
+  uint32_t frameHash;
+};
+
+static uint32_t previewHash(const uint8_t *rgb, size_t length) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ rgb[i]) * 16777619u;
+  }
+  return hash;
+}
+
+static void benchPreviewPacing() {
+  prepareDream();
+  const int links = sizeof(previewLinks) / sizeof(previewLinks[0]);
+  PreviewEncoder<NUM_SEGMENTS> encoder;
+  PreviewClientState clients[PREVIEW_MAX_CLIENTS] = {};
+  PreviewViewer<NUM_SEGMENTS> viewers[links];
+  std::deque<QueuedPreview> queues[links];
+  double credit[links] = {};
+  uint32_t applied[links] = {}, mismatches[links] = {}, maxLagMs[links] = {};
+  static uint8_t message[PreviewEncoder<NUM_SEGMENTS>::MESSAGE_BYTES];
+  static uint8_t keyframe[PreviewEncoder<NUM_SEGMENTS>::KEYFRAME_BYTES];
+
+  const uint32_t durationMs = 20000;
+  uint32_t start = millis(), lastSample = start;
+  for (uint32_t ms = 1; ms <= durationMs; ms++) {
+    nativeAdvanceMillis(1);
+    loopLEDs();
+    uint32_t now = millis();
+
+    // The links: send, ack, deliver in order
+    for (int l = 0; l < links; l++) {
+      const PreviewLink &link = previewLinks[l];
+      bool stalled = ms >= link.stallFromMs && ms < link.stallUntilMs;
+      if (!stalled) {
+        credit[l] += link.bytesPerSecond / 1000.0;
+      }
+      for (QueuedPreview &queued : queues[l]) {
+        if (queued.remaining == 0) {
+          continue;
+        }
+        uint32_t sent = min((double)queued.remaining, credit[l]);
+        queued.remaining -= sent;
+        credit[l] -= sent;
+        if (queued.remaining > 0) {
+          break;
+        }
+        queued.ackAt = now + 10;
+      }
+      if (queues[l].empty()) {
+        credit[l] = 0; // An idle link does not save up
+      }
+      while (!queues[l].empty() && queues[l].front().remaining == 0 &&
+             now >= queues[l].front().ackAt) {
+        QueuedPreview &done = queues[l].front();
+        viewers[l].apply(done.message.data(), done.message.size());
+        mismatches[l] += previewHash(viewers[l].rgb, sizeof(viewers[l].rgb)) !=
+                         done.frameHash;
+        maxLagMs[l] = max(maxLagMs[l], now - done.sampledAt);
+        applied[l]++;
+        queues[l].pop_front();
+      }
+    }
+
+    if (now - lastSample < PREVIEW_INTERVAL_MS) {
+      continue;
+    }
+    lastSample = now;
+    uint8_t rgb[NUM_SEGMENTS * 3];
+    previewSegments(leds, rgb);
+    uint16_t length = encoder.encode(rgb, message);
+    uint16_t keyframeLength = 0;
+    uint32_t hash = previewHash(rgb, sizeof(rgb));
+    for (int l = 0; l < links; l++) {
+      PreviewClientState *state = previewClient(clients, l + 1);
+      PreviewAction action =
+          pacePreviewClient(*state, queues[l].size(), now, length > 0);
+      if (action == PREVIEW_SKIP) {
+        continue;
+      }
+      const uint8_t *data = message;
+      uint16_t size = length;
+      if (action == PREVIEW_SEND_KEYFRAME) {
+        if (!keyframeLength) {
+          keyframeLength = encoder.keyframe(keyframe); // Once per sample
+        }
+        data = keyframe;
+        size = keyframeLength;
+      }
+      state->bytes += size;
+      queues[l].push_back(
+          {std::vector<uint8_t>(data, data + size), size, 0, now, hash});
+    }
+    releasePreviewClients(clients);
+  }
+
+  printf("\n%-14s %8s %8s %8s %6s %8s %8s %8s %9s %8s %6s\n",
+         "preview pacing", "link B/s", "fps", "B/s", "queue", "skipped",
+         "dropped", "keyfr.", "max lag", "interval", "check");
+  double seconds = durationMs / 1000.0;
+  for (int l = 0; l < links; l++) {
+    const PreviewClientState &state = clients[l];
+    bool ok = state.maxQueueDepth <= PREVIEW_QUEUE_BUDGET &&
+              mismatches[l] == 0 && viewers[l].gaps == 0;
+    printf("%-14s %8u %8.1f %8.0f %6u %8u %8u %8u %7u ms %5u ms %6s\n",
+           previewLinks[l].name, previewLinks[l].bytesPerSecond,
+           applied[l] / seconds, state.bytes / seconds, state.maxQueueDepth,
+           state.skipped, state.dropped, state.keyframes, maxLagMs[l],
+           state.intervalMs, ok ? "ok" : "BAD");
+  }
+}
+
+static void benchPreview() {
+  printf("\n%-14s %8s %10s %10s %10s %10s %10s %6s\n", "preview B/s",
+         "samples", "old segs", "delta segs", "raw leds", "delta leds",
+         "ns/sample", "client");
+  benchPreviewMode("DREAM", prepareDream);
+  benchPreviewMode("WAKEUP", prepareWakeup);
+  benchPreviewMode("OFF", prepareOff);
+  benchPreviewPacing();
+}
+
+struct Scenario {
+  const char *name;
+  DisplayMode mode;
+  void (*prepare)();
+};
+
+static const Scenario scenarios[] = {
+    {"DREAM", MODE_DREAM, prepareDream},
+    {"WAKEUP", MODE_WAKEUP, prepareWakeup},
+    {"TIME_NOT_SET", MODE_TIME_NOT_SET, prepareTimeNotSet},
+    {"OFF", MODE_OFF, prepareOff},
+};
+
+// ============================================================================
+// Mode Scenarios
+// ============================================================================
+static void printModeHeader(const char *title) {
+  printf("\n%-14s %6s %10s %12s %8s %8s %8s %8s %10s %6s\n", title, "fps",
+         "ns/frame", "allocs/frame", "shows", "skipped", "overrun", "i2c",
+         "hash", "wire");
+}
+
+// Let the DMA finish and send anything still pending
+static void flushOutput() {
+  for (int i = 0; i < 3; i++) {
+    nativeAdvanceMillis(1000);
+    apa102Poll();
+  }
+}
+
+static void runScenario(const Scenario &s, uint32_t frames) {
+  s.prepare();
+  uint32_t showsBefore = nativeSpi.queued;
+  uint32_t readsBefore = rtc.nowReads;
+  uint32_t skippedBefore = frameStats.skipped;
+  uint32_t overrunsBefore = apa102Stats.overruns;
+  uint32_t violationsBefore = nativeSpi.ownershipViolations;
+  allocCount = 0;
+
+  uint32_t rendered = 0;
+  uint64_t startMicros = nativeClockMicros;
+  bool modeReached = false;
+  uint64_t ns = 0;
+  while (rendered < frames) {
+    nativeAdvanceMillis(1);
+    unsigned long before = lastMillis;
+
+    countAllocs = true;
+    auto t0 = std::chrono::steady_clock::now();
+    loopLEDs();
+    auto t1 = std::chrono::steady_clock::now();
+    countAllocs = false;
+
+    if (lastMillis != before) {
+      ns += std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+                .count();
+      rendered++;
+      modeReached |= (currentMode == s.mode);
+    }
+    loopPower(); // Main loop order, may idle while off
+  }
+  double simulatedMs = (nativeClockMicros - startMicros) / 1000.0;
+  flushOutput();
+
+  // The strip is blank while off, otherwise it must show leds[]. Writes to
+  // a buffer the DMA still owned also fail the check.
+  const char *wire = "-";
+  if (nativeSpi.ownershipViolations != violationsBefore) {
+    wire = "OWNED";
+  } else if (currentMode != MODE_OFF) {
+    wire = wireMatchesLeds(nativeSpi.lastTransfer.data()) &&
+                   wireFramingValid(nativeSpi.lastTransfer.data())
+               ? "ok"
+               : "BAD";
+  }
+
+  printf("%-14s %6.1f %10.0f %12.2f %8u %8u %8u %8u %08x %6s%s\n", s.name,
+         rendered * 1000.0 / simulatedMs, (double)ns / rendered,
+         (double)allocCount / rendered, nativeSpi.queued - showsBefore,
+         frameStats.skipped - skippedBefore,
+         apa102Stats.overruns - overrunsBefore, rtc.nowReads - readsBefore,
+         hashLeds(), wire, modeReached ? "" : "  (mode not reached)");
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+int main(int argc, char **argv) {
+  uint32_t frames = argc > 1 ? strtoul(argv[1], nullptr, 10) : 600;
+  if (frames == 0)
+    frames = 1;
+
+  Serial.muted = true;
+  nativeSetMillis(1000);
+  benchBoot();
+
+  // Reference encoder only, nothing is shown through FastLED
+  FastLED.addLeds<APA102, DATA_PIN, CLOCK_PIN, BGR>(leds, NUM_LEDS)
+      .setCorrection(TypicalLEDStrip);
+
+  printf("\nframes per mode: %u (adaptive, max %d FPS)\n", frames,
+         FRAMES_PER_SECOND);
+  printModeHeader("mode");
+  for (const Scenario &s : scenarios) {
+    runScenario(s, frames);
+  }
+
+  // Same scenarios with every SPI transfer taking 100x longer than a frame
+  // budget allows, to exercise the double-buffer overrun path
+  nativeSpi.slowdown = 100;
+  printModeHeader("dma stress");
+  for (const Scenario &s : scenarios) {
+    runScenario(s, frames);
+  }
+  nativeSpi.slowdown = 1;
+
+  printf("\n%-11s %8s %8s %8s %10s %10s %10s\n", "drift ppm", "i2c/day",
+         "minutes", "hours", "max err s", "backwards", "stale pub");
+  benchTimeService(0);
+  benchTimeService(500);
+  benchTimeService(-500);
+
+  benchSchedule();
+  benchSettings(frames * 10);
+  benchSnapshots(frames * 1000);
+  benchAssets();
+  benchPower();
+  benchNetwork();
+  benchCommands(frames * 1000);
+  benchApi(frames * 10);
+  benchWebTime();
+  benchProbes(frames * 1000);
+  benchDns(frames * 1000);
+  benchPreview();
+  benchScheduler();
+  benchDreamWords();
+  benchGradient(frames * 100);
+  benchAPA102(frames);
+  return 0;
+}
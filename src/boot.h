@@ -0,0 +1,95 @@
+#pragma once
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// Background stages from network.h / ota.h / web.h
+void setupNetwork();
+void setupOTA();
+void setupWeb();
+
+// ============================================================================
+// Staged Boot
+// ============================================================================
+// setup() only brings up what the display needs (RTC, settings, LEDs), so
+// dream mode starts right after power-on. Network, OTA and the web server
+// come up afterwards in a separate task (starting the servers takes a while)
+// and the render loop keeps running meanwhile.
+// loop() only services a subsystem once its stage is done. "online" is the
+// first usable link: station got an IP, or the access point is up.
+//
+// Every stage records the esp_timer time (µs since the app started) at which
+// it finished. The timeline is printed once the last stage is done and is
+// part of /api/stats.
+// ============================================================================
+#define BOOT_TASK_STACK 8192
+#define BOOT_TASK_PRIORITY 1 // Same as loop(): time-sliced with rendering
+
+enum BootStage {
+  BOOT_RTC,
+  BOOT_SETTINGS,
+  BOOT_LEDS,
+  BOOT_FIRST_FRAME, // First frame pushed by loopLEDs()
+  BOOT_NETWORK,
+  BOOT_OTA,
+  BOOT_WEB,
+  BOOT_ONLINE, // First link up (network.h)
+  BOOT_STAGES
+};
+
+const char *const BOOT_STAGE_NAMES[BOOT_STAGES] = {
+    "rtc", "settings", "leds", "firstFrame", "network", "ota", "web", "online"};
+
+// Written by the boot task, read by loop() (0 = not reached yet)
+volatile uint32_t bootStageMicros[BOOT_STAGES] = {0};
+
+// Only the first time counts
+inline void markBootStage(BootStage stage) {
+  if (bootStageMicros[stage]) {
+    return;
+  }
+  uint32_t now = esp_timer_get_time();
+  bootStageMicros[stage] = now ? now : 1;
+}
+
+inline bool bootStageDone(BootStage stage) {
+  return bootStageMicros[stage] != 0;
+}
+
+inline void printBootTimeline() {
+  Serial.println("=== Boot Timeline ===");
+  for (int i = 0; i < BOOT_STAGES; i++) {
+    if (bootStageDone((BootStage)i)) {
+      Serial.printf("  %-11s %7.1f ms\n", BOOT_STAGE_NAMES[i],
+                    bootStageMicros[i] / 1000.0f);
+    } else {
+      Serial.printf("  %-11s       -\n", BOOT_STAGE_NAMES[i]);
+    }
+  }
+  Serial.println("=====================\n");
+}
+
+inline void runBackgroundStages() {
+  setupNetwork();
+  markBootStage(BOOT_NETWORK);
+  setupOTA();
+  markBootStage(BOOT_OTA);
+  setupWeb();
+  markBootStage(BOOT_WEB);
+  printBootTimeline();
+}
+
+inline void bootTask(void *) {
+  runBackgroundStages();
+  vTaskDelete(nullptr);
+}
+
+// Bring up network, OTA and web server without holding up the display
+inline void startBackgroundBoot() {
+  if (xTaskCreate(bootTask, "boot", BOOT_TASK_STACK, nullptr,
+                  BOOT_TASK_PRIORITY, nullptr) != pdPASS) {
+    Serial.println("[BOOT] ERROR: no boot task, starting network inline");
+    runBackgroundStages();
+  }
+}
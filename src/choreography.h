@@ -0,0 +1,205 @@
+#pragma once
+#include <Arduino.h>
+
+// ============================================================================
+// Choreographies
+// ============================================================================
+// A choreography is a short script of timed steps (wait, show a word, fade,
+// hide, start over) in a const table. A Choreographer plays one as a
+// stackless resumable: its whole state is the step index, the time the step
+// began and the deadline of its next resume. resume() only runs once that
+// deadline has come and reports what changed; in between, a frame costs one
+// comparison (due()).
+//
+// Without a tick, fades resume when the opacity reaches its next level (the
+// values map() gives over the step), not every frame. With a tick the player
+// resumes every tickMs while a word is shown, fades included, and the caller
+// tweens towards opacityAt(nextResume()) in between (see modes.h).
+//
+// Steps start when the previous one was due, not when it was resumed, so a
+// late frame does not stretch the choreography. Every loop through the
+// table needs a WAIT or FADE with a duration.
+// ============================================================================
+#define CHOREO_MAX_UNTIMED_STEPS 16 // In a row, more is a broken table
+
+enum ChoreoOp : uint8_t {
+  CHOREO_WAIT, // Nothing changes for durationMs
+  CHOREO_SHOW, // Pick a word, shown at opacity `to`. No word: wait
+               // durationMs and pick again
+  CHOREO_FADE, // Opacity from `from` to `to` over durationMs (< 4.6 h)
+  CHOREO_HIDE, // Take the word off the display
+  CHOREO_LOOP, // Start over at the first step
+};
+
+struct ChoreoStep {
+  ChoreoOp op;
+  uint8_t from;
+  uint8_t to;
+  uint32_t durationMs;
+};
+
+// What resume() changed (bit mask)
+enum ChoreoEvent : uint8_t {
+  CHOREO_SHOWN = 1,   // A word was picked
+  CHOREO_SKIPPED = 2, // No word this time (CHOREO_SHOW waits)
+  CHOREO_OPACITY = 4, // Opacity changed
+  CHOREO_TICK = 8,    // A word is shown (resumed for tickMs or a step)
+  CHOREO_HIDDEN = 16, // The word was taken off
+};
+
+typedef const char *(*ChoreoPicker)(); // nullptr: skip
+
+class Choreographer {
+public:
+  const char *word = nullptr; // Shown word, nullptr while none
+  uint8_t opacity = 0;
+  uint32_t resumes = 0;
+
+  void start(const ChoreoStep *script, ChoreoPicker picker, uint32_t tick,
+             uint32_t now) {
+    steps = script;
+    pick = picker;
+    tickMs = tick;
+    index = 0;
+    word = nullptr;
+    opacity = 0;
+    stepStart = now;
+    wakeAt = now;
+  }
+
+  void stop() {
+    steps = nullptr;
+    word = nullptr;
+  }
+
+  bool playing() const { return steps != nullptr; }
+  bool showing() const { return word != nullptr; }
+  bool due(uint32_t now) const {
+    return steps && (int32_t)(now - wakeAt) >= 0;
+  }
+  uint32_t nextResume() const { return wakeAt; }
+
+  // The opacity the current step reaches by time t (up to its end)
+  uint8_t opacityAt(uint32_t t) const {
+    if (!steps || steps[index].op != CHOREO_FADE) {
+      return opacity;
+    }
+    const ChoreoStep &step = steps[index];
+    uint32_t elapsed = t - stepStart;
+    if ((int32_t)elapsed < 0) {
+      return step.from;
+    }
+    if (elapsed >= step.durationMs) {
+      return step.to;
+    }
+    bool rising = step.to >= step.from;
+    uint32_t span = rising ? step.to - step.from : step.from - step.to;
+    uint32_t level = span * elapsed / step.durationMs;
+    return rising ? step.from + level : step.from - level;
+  }
+
+  // Run the steps that are due and set the next deadline; returns the
+  // ChoreoEvent bits of what changed
+  uint8_t resume(uint32_t now) {
+    uint8_t events = 0;
+    uint8_t untimed = 0; // Steps in a row that took no time
+    resumes++;
+    while (steps) {
+      if (untimed++ == CHOREO_MAX_UNTIMED_STEPS) {
+        Serial.println("[CHOREO] ERROR: no timed step, stopped");
+        stop();
+        break;
+      }
+      const ChoreoStep &step = steps[index];
+      uint32_t elapsed = now - stepStart;
+      switch (step.op) {
+      case CHOREO_WAIT:
+        if (elapsed < step.durationMs) {
+          return finish(events, stepStart + step.durationMs, now);
+        }
+        untimed = step.durationMs > 0 ? 0 : untimed;
+        next(stepStart + step.durationMs);
+        break;
+      case CHOREO_SHOW: {
+        const char *picked = pick();
+        if (!picked) {
+          stepStart += step.durationMs; // Try again from then
+          return finish(events | CHOREO_SKIPPED, stepStart, now);
+        }
+        word = picked;
+        events |= CHOREO_SHOWN | CHOREO_OPACITY;
+        opacity = step.to;
+        next(stepStart);
+        break;
+      }
+      case CHOREO_FADE:
+        if (elapsed < step.durationMs) {
+          return fade(step, elapsed, events, now);
+        }
+        events |= setOpacity(step.to);
+        untimed = step.durationMs > 0 ? 0 : untimed;
+        next(stepStart + step.durationMs);
+        break;
+      case CHOREO_HIDE:
+        if (word) {
+          events |= CHOREO_HIDDEN;
+        }
+        word = nullptr;
+        next(stepStart);
+        break;
+      case CHOREO_LOOP:
+        index = 0;
+        break;
+      }
+    }
+    return events;
+  }
+
+private:
+  const ChoreoStep *steps = nullptr;
+  ChoreoPicker pick = nullptr;
+  uint32_t tickMs = 0;
+  uint8_t index = 0;
+  uint32_t stepStart = 0; // When the current step began (was due)
+  uint32_t wakeAt = 0;    // Next resume
+
+  void next(uint32_t start) {
+    index++;
+    stepStart = start;
+  }
+
+  uint8_t setOpacity(uint8_t value) {
+    if (opacity == value) {
+      return 0;
+    }
+    opacity = value;
+    return CHOREO_OPACITY;
+  }
+
+  // Opacity at this point of the fade; resume at the next level (or tick)
+  uint8_t fade(const ChoreoStep &step, uint32_t elapsed, uint8_t events,
+               uint32_t now) {
+    events |= setOpacity(opacityAt(now));
+    bool rising = step.to >= step.from;
+    uint32_t span = rising ? step.to - step.from : step.from - step.to;
+    if (span == 0 || tickMs > 0) {
+      return finish(events, stepStart + step.durationMs, now);
+    }
+    uint32_t level = span * elapsed / step.durationMs;
+    uint32_t untilNext = ((level + 1) * step.durationMs + span - 1) / span;
+    return finish(events, stepStart + untilNext, now);
+  }
+
+  // Sleep until the step deadline, or the next tick while a word is shown
+  uint8_t finish(uint8_t events, uint32_t deadline, uint32_t now) {
+    wakeAt = deadline;
+    if (word && tickMs > 0) {
+      uint32_t tick = now - now % tickMs + tickMs;
+      if ((int32_t)(tick - deadline) < 0) {
+        wakeAt = tick;
+      }
+      events |= CHOREO_TICK;
+    }
+    return events;
+  }
+};
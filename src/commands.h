@@ -0,0 +1,294 @@
+#pragma once
+#include <Arduino.h>
+#include <esp_timer.h>
+
+#include <atomic>
+
+#include "settings.h"
+
+// Render-side functions from rtc.h / modes.h / schedule.h / network.h
+void setRTCTime(int hours, int minutes, int seconds, int day, int month,
+                int year);
+void scheduleAutoWakeup();
+void restartNetwork();
+
+// ============================================================================
+// Command Queue (web server -> render loop)
+// ============================================================================
+// The web handlers run on the AsyncTCP task, the clock state belongs to the
+// loop task. Handlers never write that state: they parse a request into a
+// typed Command and push it into a bounded lock-free ring, and loopLEDs()
+// applies all queued commands at the start of its next frame.
+//
+// The ring is single-producer/single-consumer: the producer is the AsyncTCP
+// task (all handlers run there), the consumer is the loop task. Head and tail
+// are only written by their own side, with release/acquire ordering, so a
+// command is completely written before the consumer can see it. A full ring
+// rejects the command and the handler answers with an error.
+//
+// A queued command bypasses the frame rate limit, so it is applied in the
+// next loop iteration. While the display is off that can be up to
+// OFF_IDLE_MAX_MS later (see power.h).
+//
+// Partial updates (active hours, network) carry "unchanged" markers instead
+// of a copy of the current settings, so the web side never reads them either.
+// The changes of one frame go into one settings draft, published together.
+// A batch (POST /api/state) is pushed with a single tail store, so the loop
+// sees all of its commands or none and applies them in the same frame: one
+// snapshot, one save.
+// ============================================================================
+#define COMMAND_QUEUE_SIZE 16 // Power of two
+#define COMMAND_UNCHANGED -1  // Patch field: keep the current value
+
+static_assert((COMMAND_QUEUE_SIZE & (COMMAND_QUEUE_SIZE - 1)) == 0,
+              "queue size must be a power of two");
+
+enum CommandType : uint8_t {
+  CMD_WAKEUP,
+  CMD_SET_TIME,
+  CMD_SET_SCHEDULE,
+  CMD_SET_INTERVAL,
+  CMD_SET_TIMEZONE,
+  CMD_SET_NETWORK,
+};
+
+// One day of an active-hours patch, COMMAND_UNCHANGED per field to keep
+struct DayPatch {
+  int8_t enabled;
+  int8_t startHour;
+  int8_t startMinute;
+  int8_t endHour;
+  int8_t endMinute;
+};
+
+struct Command {
+  CommandType type;
+  int64_t enqueuedMicros; // esp_timer time of the push
+  union {
+    struct {
+      uint16_t year;
+      uint8_t month, day, hours, minutes, seconds;
+    } time;
+    struct {
+      int8_t useActiveHours;
+      DayPatch days[7];
+    } schedule;
+    uint16_t interval;
+    char timezone[sizeof(ClockSettings::timezone)];
+    struct {
+      int8_t mode;
+      int8_t fallbackToCaptive;
+      bool setSsid;
+      bool setPassword;
+      bool apply; // Restart the network afterwards
+      char ssid[sizeof(NetworkSettings::ssid)];
+      char password[sizeof(NetworkSettings::password)];
+    } network;
+  };
+};
+
+struct CommandStats {
+  uint32_t applied;
+  uint32_t rejected;          // Queue was full
+  uint32_t lastLatencyMicros; // Push -> applied
+  uint32_t maxLatencyMicros;
+  uint64_t totalLatencyMicros;
+};
+
+// Bounded SPSC ring: push() from one task, pop() from one other task
+template <typename T, uint16_t N> class SpscQueue {
+public:
+  SpscQueue() : head(0), tail(0) {}
+
+  bool push(const T &item) {
+    uint16_t t = tail.load(std::memory_order_relaxed);
+    if ((uint16_t)(t - head.load(std::memory_order_acquire)) == N) {
+      return false; // Full
+    }
+    slots[t & (N - 1)] = item;
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  // All items or none, made visible to the consumer together
+  bool pushAll(const T *items, uint16_t count) {
+    uint16_t t = tail.load(std::memory_order_relaxed);
+    if ((uint16_t)(N - (uint16_t)(t - head.load(std::memory_order_acquire))) <
+        count) {
+      return false; // Not enough room
+    }
+    for (uint16_t i = 0; i < count; i++) {
+      slots[(uint16_t)(t + i) & (N - 1)] = items[i];
+    }
+    tail.store(t + count, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &item) {
+    uint16_t h = head.load(std::memory_order_relaxed);
+    if (h == tail.load(std::memory_order_acquire)) {
+      return false; // Empty
+    }
+    item = slots[h & (N - 1)];
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool empty() const {
+    return head.load(std::memory_order_acquire) ==
+           tail.load(std::memory_order_acquire);
+  }
+
+private:
+  T slots[N];
+  std::atomic<uint16_t> head; // Next slot to pop (consumer)
+  std::atomic<uint16_t> tail; // Next slot to push (producer)
+};
+
+SpscQueue<Command, COMMAND_QUEUE_SIZE> commandQueue;
+CommandStats commandStats = {0, 0, 0, 0, 0};
+std::atomic<uint32_t> commandsRejected(0); // Counted by the producer
+
+// ============================================================================
+// Producer Side (AsyncTCP task)
+// ============================================================================
+
+// A command of the given type with every patch field unchanged
+inline Command makeCommand(CommandType type) {
+  Command command;
+  memset(&command, 0, sizeof(command));
+  command.type = type;
+  if (type == CMD_SET_SCHEDULE) {
+    memset(&command.schedule, COMMAND_UNCHANGED, sizeof(command.schedule));
+  } else if (type == CMD_SET_NETWORK) {
+    command.network.mode = COMMAND_UNCHANGED;
+    command.network.fallbackToCaptive = COMMAND_UNCHANGED;
+  }
+  return command;
+}
+
+// Queue a command for the render loop, false if the queue is full
+inline bool sendCommand(Command &command) {
+  command.enqueuedMicros = esp_timer_get_time();
+  if (!commandQueue.push(command)) {
+    commandsRejected.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+// Queue commands as one batch, applied in the same frame. False (nothing
+// queued) if the queue has no room for all of them.
+inline bool sendCommands(Command *commands, uint8_t count) {
+  int64_t now = esp_timer_get_time();
+  for (uint8_t i = 0; i < count; i++) {
+    commands[i].enqueuedMicros = now;
+  }
+  if (!commandQueue.pushAll(commands, count)) {
+    commandsRejected.fetch_add(count, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+// ============================================================================
+// Consumer Side (loop task)
+// ============================================================================
+
+// Copy a patch field unless it is COMMAND_UNCHANGED
+template <typename T> inline void patchField(T &field, int8_t value) {
+  if (value != COMMAND_UNCHANGED) {
+    field = (T)value;
+  }
+}
+
+// Apply one command, changed settings go into the draft. True if the draft
+// changed.
+inline bool applyCommand(const Command &command, SettingsSnapshot &draft) {
+  ClockSettings &clock = draft.clock;
+  NetworkSettings &network = draft.network;
+  switch (command.type) {
+  case CMD_WAKEUP:
+    wakeup = true;
+    return false;
+
+  case CMD_SET_TIME:
+    setRTCTime(command.time.hours, command.time.minutes, command.time.seconds,
+               command.time.day, command.time.month, command.time.year);
+    bumpStateVersion(); // Even within the same minute
+    scheduleAutoWakeup();
+    wakeup = true;
+    return false;
+
+  case CMD_SET_SCHEDULE:
+    patchField(clock.useActiveHours, command.schedule.useActiveHours);
+    for (int i = 0; i < 7; i++) {
+      const DayPatch &patch = command.schedule.days[i];
+      DaySchedule &day = clock.days[i];
+      patchField(day.enabled, patch.enabled);
+      patchField(day.startHour, patch.startHour);
+      patchField(day.startMinute, patch.startMinute);
+      patchField(day.endHour, patch.endHour);
+      patchField(day.endMinute, patch.endMinute);
+    }
+    Serial.println("[COMMAND] Active hours set");
+    return true;
+
+  case CMD_SET_INTERVAL:
+    clock.wakeupInterval = command.interval;
+    Serial.printf("[COMMAND] Wakeup interval: %d minutes\n",
+                  clock.wakeupInterval);
+    return true;
+
+  case CMD_SET_TIMEZONE:
+    memcpy(clock.timezone, command.timezone, sizeof(clock.timezone));
+    clock.timezone[sizeof(clock.timezone) - 1] = '\0';
+    Serial.printf("[COMMAND] Timezone: %s\n", clock.timezone);
+    return true;
+
+  case CMD_SET_NETWORK:
+    patchField(network.mode, command.network.mode);
+    patchField(network.fallbackToCaptive, command.network.fallbackToCaptive);
+    if (command.network.setSsid) {
+      memcpy(network.ssid, command.network.ssid, sizeof(network.ssid));
+    }
+    if (command.network.setPassword) {
+      memcpy(network.password, command.network.password,
+             sizeof(network.password));
+    }
+    Serial.println("[COMMAND] Network settings set");
+    if (command.network.apply) {
+      restartNetwork(); // Runs later, after the publish below
+    }
+    return true;
+  }
+  return false;
+}
+
+// Apply everything queued so far (call once per frame). All settings
+// changes of one frame are published as one snapshot and saved once.
+inline void applyCommands() {
+  commandStats.rejected = commandsRejected.load(std::memory_order_relaxed);
+  if (commandQueue.empty()) {
+    return;
+  }
+  SettingsSnapshot *draft = editSettings();
+  if (!draft) {
+    return; // Every buffer still pinned: the commands wait a frame
+  }
+
+  bool changed = false;
+  Command command;
+  while (commandQueue.pop(command)) {
+    changed |= applyCommand(command, *draft);
+    uint32_t latency = esp_timer_get_time() - command.enqueuedMicros;
+    commandStats.applied++;
+    commandStats.lastLatencyMicros = latency;
+    commandStats.maxLatencyMicros = max(commandStats.maxLatencyMicros, latency);
+    commandStats.totalLatencyMicros += latency;
+  }
+  if (changed) {
+    publishSettings();
+    requestSettingsSave();
+  }
+}
@@ -20,7 +20,7 @@ inline void setChar(int position, char c, int opacity) {
   if (patternIndex < 0) {
     // Unknown character - turn off all segments
     for (int segPos = 0; segPos < 7; segPos++) {
-      segments[start + segPos].opacity = 0;
+      segments[start + segPos].setOpacity(0);
     }
     return;
   }
@@ -28,9 +28,9 @@ inline void setChar(int position, char c, int opacity) {
   uint8_t pattern = segmentPatterns[patternIndex];
   for (int segPos = 0; segPos < 7; segPos++) {
     if ((pattern >> segPos) & 0x01) {
-      segments[start + segPos].opacity = opacity;
+      segments[start + segPos].setOpacity(opacity);
     } else {
-      segments[start + segPos].opacity = 0;
+      segments[start + segPos].setOpacity(0);
     }
   }
 }
@@ -60,11 +60,11 @@ inline void showCurrentTime() {
 
   // // Apply color to all digit segments that are on
   for (int i = 0; i < 7 * 4; i++) {
-    segments[i].mode = SegmentMode::COLOR;
+    segments[i].setMode(SegmentMode::COLOR);
   }
 
   // Blinking colon
   bool colonOn = ((millis() % 2000) > 1000);
-  segments[COLON_INDEX].opacity = colonOn ? 255 : 0;
+  segments[COLON_INDEX].setOpacity(colonOn ? 255 : 0);
   segments[COLON_INDEX].fillColor(mainColor, 255);
 }
@@ -0,0 +1,229 @@
+#pragma once
+#include <Arduino.h>
+#include <IPAddress.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <lwip/sockets.h>
+
+#include <atomic>
+
+// ============================================================================
+// Captive DNS Responder
+// ============================================================================
+// In captive mode every name resolves to the access point, so the
+// connectivity probe of a joining device lands on the web server (portal.h).
+// The responder has its own task, blocked in recvfrom() until a query
+// arrives: DNS latency does not depend on the render loop any more, and the
+// loop no longer polls UDP.
+//
+// Replies are built in one buffer. The header and the answer record (pointer
+// to the question name, A, IN, TTL, the AP address) are prebuilt when the
+// responder starts; per query only the ID, the RD flag and the question are
+// copied in. Nothing is allocated or formatted per query.
+//
+// A and ANY questions get the address. Other types (AAAA, HTTPS, ...) get an
+// empty NOERROR answer, so the client falls back to IPv4 at once. Responses,
+// malformed packets and anything but a single standard query are dropped.
+//
+// startCaptiveDns() and stopCaptiveDns() only switch dnsState and return.
+// After a stop the task closes its socket within DNS_RECV_TIMEOUT_MS and
+// ends; a start before that keeps it (and its socket) running.
+// ============================================================================
+#define DNS_PORT 53
+#define DNS_TTL_SECONDS 60
+#define DNS_MAX_PACKET 512 // Plain UDP DNS, longer queries are cut
+#define DNS_HEADER_BYTES 12
+#define DNS_ANSWER_BYTES 16
+#define DNS_RECV_TIMEOUT_MS 250 // How long a stop may take
+#define DNS_TASK_STACK 3072
+#define DNS_TASK_PRIORITY 2 // Above loop(): a query preempts rendering
+
+#define DNS_TYPE_A 1
+#define DNS_TYPE_ANY 255
+#define DNS_CLASS_IN 1
+#define DNS_CLASS_ANY 255
+
+struct DnsTemplate {
+  uint8_t reply[DNS_MAX_PACKET];    // Header template, then per query
+  uint8_t answer[DNS_ANSWER_BYTES]; // Prebuilt A record
+};
+
+struct DnsStats {
+  uint32_t answered;   // A/ANY questions, answered with the address
+  uint32_t empty;      // Other types, NOERROR without records
+  uint32_t dropped;    // Not a single well-formed standard query
+  uint32_t sendErrors; // sendto() failed
+};
+
+enum DnsState : uint8_t {
+  DNS_IDLE,     // No task
+  DNS_RUNNING,  // Task answering queries
+  DNS_STOPPING, // Task closing its socket, about to end
+};
+
+DnsTemplate dnsTemplate;
+DnsStats dnsStats = {0, 0, 0, 0};
+std::atomic<uint8_t> dnsState(DNS_IDLE);
+
+// Once per start: the parts of every reply that do not depend on the query
+inline void prepareDnsTemplate(DnsTemplate &dns, const IPAddress &ip) {
+  static const uint8_t header[DNS_HEADER_BYTES] = {
+      0, 0,    // ID (from the query)
+      0x84, 0, // QR, AA (RD from the query), NOERROR
+      0, 1,    // One question
+      0, 0,    // Answers (0 or 1)
+      0, 0,    // Authority records
+      0, 0,    // Additional records
+  };
+  memcpy(dns.reply, header, sizeof(header));
+  const uint8_t answer[DNS_ANSWER_BYTES] = {
+      0xC0, DNS_HEADER_BYTES, // Name: the question's
+      0, DNS_TYPE_A,
+      0, DNS_CLASS_IN,
+      (uint8_t)(DNS_TTL_SECONDS >> 24), (uint8_t)(DNS_TTL_SECONDS >> 16),
+      (uint8_t)(DNS_TTL_SECONDS >> 8), (uint8_t)DNS_TTL_SECONDS,
+      0, 4, // Address length
+      ip[0], ip[1], ip[2], ip[3],
+  };
+  memcpy(dns.answer, answer, sizeof(answer));
+}
+
+// Build the reply to one query in dns.reply; returns its length, 0 if the
+// query is dropped
+inline uint16_t answerDnsQuery(DnsTemplate &dns, const uint8_t *query,
+                               uint16_t length, DnsStats &stats) {
+  // A standard query (QR 0, opcode 0) with one question, no answers and no
+  // authority records (additional records such as EDNS are ignored)
+  if (length < DNS_HEADER_BYTES || (query[2] & 0xF8) != 0 || query[4] != 0 ||
+      query[5] != 1 || query[6] != 0 || query[7] != 0 || query[8] != 0 ||
+      query[9] != 0) {
+    stats.dropped++;
+    return 0;
+  }
+
+  // Question: uncompressed labels, then type and class
+  uint16_t end = DNS_HEADER_BYTES;
+  while (end < length && query[end] != 0) {
+    if (query[end] > 63) { // Compression pointer or reserved
+      stats.dropped++;
+      return 0;
+    }
+    end += query[end] + 1;
+  }
+  if (end + 5 > length || end - DNS_HEADER_BYTES + 1 > 255) {
+    stats.dropped++;
+    return 0;
+  }
+  end += 5;
+  uint16_t type = (query[end - 4] << 8) | query[end - 3];
+  uint16_t qclass = (query[end - 2] << 8) | query[end - 1];
+  bool address = (type == DNS_TYPE_A || type == DNS_TYPE_ANY) &&
+                 (qclass == DNS_CLASS_IN || qclass == DNS_CLASS_ANY);
+
+  uint8_t *reply = dns.reply;
+  reply[0] = query[0];
+  reply[1] = query[1];
+  reply[2] = 0x84 | (query[2] & 0x01);
+  reply[7] = address;
+  memcpy(reply + DNS_HEADER_BYTES, query + DNS_HEADER_BYTES,
+         end - DNS_HEADER_BYTES);
+  if (!address) {
+    stats.empty++;
+    return end;
+  }
+  memcpy(reply + end, dns.answer, DNS_ANSWER_BYTES);
+  stats.answered++;
+  return end + DNS_ANSWER_BYTES;
+}
+
+// The responder's UDP socket, -1 if it cannot be bound
+inline int openDnsSocket() {
+  int fd = lwip_socket(AF_INET, SOCK_DGRAM, 0);
+  if (fd < 0) {
+    return -1;
+  }
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(DNS_PORT);
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  timeval timeout = {0, DNS_RECV_TIMEOUT_MS * 1000};
+  if (lwip_bind(fd, (sockaddr *)&address, sizeof(address)) < 0 ||
+      lwip_setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout,
+                      sizeof(timeout)) < 0) {
+    lwip_close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+// Wait up to DNS_RECV_TIMEOUT_MS for one query and answer it
+inline void serveDnsQuery(int fd) {
+  static uint8_t query[DNS_MAX_PACKET];
+  sockaddr_in peer;
+  socklen_t peerLength = sizeof(peer);
+  int length = lwip_recvfrom(fd, query, sizeof(query), 0, (sockaddr *)&peer,
+                             &peerLength);
+  if (length <= 0) {
+    return; // Timeout
+  }
+  uint16_t replyLength = answerDnsQuery(dnsTemplate, query, length, dnsStats);
+  if (replyLength > 0 &&
+      lwip_sendto(fd, dnsTemplate.reply, replyLength, 0, (sockaddr *)&peer,
+                  peerLength) < 0) {
+    dnsStats.sendErrors++;
+  }
+}
+
+void dnsTask(void *) {
+  int fd = -1;
+  bool bindFailed = false;
+  for (;;) {
+    if (dnsState == DNS_RUNNING) {
+      if (fd < 0 && (fd = openDnsSocket()) < 0) {
+        if (!bindFailed) {
+          Serial.printf("[DNS] ERROR: cannot bind port %d, retrying\n",
+                        DNS_PORT);
+          bindFailed = true;
+        }
+        vTaskDelay(pdMS_TO_TICKS(DNS_RECV_TIMEOUT_MS));
+        continue;
+      }
+      serveDnsQuery(fd);
+      continue;
+    }
+    // Stopping: close first, so that a new task can bind the port
+    if (fd >= 0) {
+      lwip_close(fd);
+      fd = -1;
+    }
+    uint8_t stopping = DNS_STOPPING;
+    if (dnsState.compare_exchange_strong(stopping, DNS_IDLE)) {
+      break;
+    }
+  }
+  vTaskDelete(nullptr);
+}
+
+// Answer every name with ip (returns immediately)
+inline bool startCaptiveDns(const IPAddress &ip) {
+  uint8_t state = DNS_STOPPING;
+  if (dnsState.compare_exchange_strong(state, DNS_RUNNING) ||
+      state == DNS_RUNNING) {
+    return true; // The task is still up, with the same address (apIP)
+  }
+  prepareDnsTemplate(dnsTemplate, ip); // No task reads it now
+  dnsState = DNS_RUNNING;
+  if (xTaskCreate(dnsTask, "dns", DNS_TASK_STACK, nullptr, DNS_TASK_PRIORITY,
+                  nullptr) != pdPASS) {
+    dnsState = DNS_IDLE;
+    Serial.println("[DNS] ERROR: no DNS task");
+    return false;
+  }
+  return true;
+}
+
+// Stop answering (returns immediately, see above)
+inline void stopCaptiveDns() {
+  uint8_t running = DNS_RUNNING;
+  dnsState.compare_exchange_strong(running, DNS_STOPPING);
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+
+// ============================================================================
+// LED Layout
+// ============================================================================
+// Constants exported for web.h LED preview
+const int NUM_LEDS = 282;
+const int NUM_SEGMENTS = (7 * 4 + 1); // 4 digits + colon
+const int LEDS_PER_SEGMENT = 10;
+const int COLON_LEDS = 2;
+const int COLON_INDEX = 28;
+
+// ============================================================================
+// Frame Arena
+// ============================================================================
+// All render state lives in one statically sized block, laid out as
+// structure-of-arrays. Pixel buffers are indexed like leds[], so blending a
+// segment is a straight sweep over three parallel arrays; per-segment state
+// is indexed by segment id. Segments are only views into this arena.
+//
+// dirtyMask has one bit per segment, set whenever that segment's output may
+// differ from what was last pushed to the strip. loopLEDs() only pushes a
+// frame when a bit is set.
+//
+// Blend progress is time-based: blendPos is Q8.8 (0xFF00 = done) and
+// advances by speed * step88 per frame, where step88 is the frame's elapsed
+// time expressed in 60 fps frames (256 = 1/60 s). A segment speed therefore
+// means "blend units per 1/60 s" no matter how often frames are rendered.
+//
+// Tween tracks (see segment.h) blend linearly at tweenRate, a Q8.8 speed
+// precomputed from the keyframe's duration, so the blend ends on time and a
+// chain of keyframes moves at a steady pace.
+// ============================================================================
+struct FrameArena {
+  // Pixel buffers (indexed by LED)
+  CRGB current[NUM_LEDS]; // Blend start, copied from the live LEDs
+  CRGB target[NUM_LEDS];  // Blend goal
+
+  // Per-segment state (indexed by segment id)
+  uint16_t blendPos[NUM_SEGMENTS]; // Q8.8, BLEND_DONE when finished
+  uint8_t speed[NUM_SEGMENTS];
+  uint16_t tweenRate[NUM_SEGMENTS]; // Q8.8 speed of a tween (TWEEN mode)
+  uint8_t opacity[NUM_SEGMENTS];
+  uint8_t gradientRange[NUM_SEGMENTS];
+  uint8_t mode[NUM_SEGMENTS]; // SegmentMode
+  unsigned long nextMillis[NUM_SEGMENTS];
+
+  uint32_t dirtyMask;
+  uint32_t step88; // Q8.8 blend units per unit of speed for this frame
+};
+
+const uint16_t BLEND_DONE = 255 << 8;
+
+// Speeds are defined relative to this frame rate
+#define BLEND_REFERENCE_FPS 60
+
+// Longer gaps (stalls, MODE_OFF) just finish any running blend
+#define MAX_FRAME_STEP_US 5000000UL
+
+const uint32_t ALL_SEGMENTS_DIRTY = (1UL << NUM_SEGMENTS) - 1;
+
+FrameArena frameArena;
+
+// Set the blend step for a frame that comes elapsedMicros after the last one
+inline void advanceFrameClock(uint32_t elapsedMicros) {
+  if (elapsedMicros > MAX_FRAME_STEP_US) {
+    elapsedMicros = MAX_FRAME_STEP_US;
+  }
+  // elapsed * 256 * 60 / 1e6, reduced so 5 s still fits in 32 bits
+  frameArena.step88 = elapsedMicros * 192 / 12500;
+}
+
+// Force the next frame out, e.g. after the strip was written behind our back
+inline void invalidateFrame() { frameArena.dirtyMask = ALL_SEGMENTS_DIRTY; }
@@ -2,9 +2,12 @@
 #include <Arduino.h>
 #include <FastLED.h>
 #include <RTClib.h>
-#include <SPI.h>
-#include <Timer.h>
 
+#include "apa102.h"
+#include "boot.h"
+#include "commands.h"
+#include "frame.h"
+#include "scheduler.h"
 #include "segment.h"
 #include "settings.h"
 
@@ -13,34 +16,60 @@ extern RTC_DS1307 rtc;
 extern bool rtcInitialized;
 extern bool usingInternalTime;
 DateTime getCurrentTime();
+void updateTime();
 
 // ============================================================================
 // LED Hardware Configuration
 // ============================================================================
-#define FRAMES_PER_SECOND 60
+#define FRAMES_PER_SECOND 60 // Maximum render rate (see framesPerSecondFor)
 #define DATA_PIN 6  // GPIO6 on ESP32-C3
 #define CLOCK_PIN 7 // GPIO7 on ESP32-C3
 
-// Constants exported for web.h LED preview
-const int NUM_LEDS = 282;
-const int NUM_SEGMENTS = (7 * 4 + 1); // 4 digits + colon
-const int LEDS_PER_SEGMENT = 10;
-const int COLON_LEDS = 2;
-const int COLON_INDEX = 28;
-
 // ============================================================================
 // Global Hardware State
 // ============================================================================
 CRGB leds[NUM_LEDS];
-Timer timer;
+Scheduler scheduler;
 Segment segments[NUM_SEGMENTS];
 unsigned long lastMillis = millis();
+unsigned long lastFrameMicros = micros();
+
+// Frames sent to the strip vs. frames skipped because nothing changed
+struct FrameStats {
+  uint32_t pushed;
+  uint32_t skipped;
+};
+FrameStats frameStats = {0, 0};
 
 // ============================================================================
 // Include mode management (after hardware globals are defined)
 // ============================================================================
 #include "modes.h"
 
+// ============================================================================
+// Frame Rate Policy
+// ============================================================================
+// Blends advance with elapsed time (see frame.h), so each mode only renders
+// as often as it needs to look smooth.
+#define FPS_WAKEUP FRAMES_PER_SECOND // Time display & colour transitions
+#define FPS_DREAM_WORD 30            // Word tweens
+#define FPS_DREAM 15                 // Slow random fades (speed 1-3)
+#define FPS_TIME_NOT_SET 15          // Hard 1 s blink
+
+inline uint8_t framesPerSecondFor(DisplayMode mode) {
+  switch (mode) {
+  case MODE_WAKEUP:
+    return FPS_WAKEUP;
+  case MODE_DREAM:
+    return dreamWord.showing() ? FPS_DREAM_WORD : FPS_DREAM;
+  case MODE_TIME_NOT_SET:
+    return FPS_TIME_NOT_SET;
+  case MODE_OFF:
+    break; // Paced by loopPower()'s idle wait
+  }
+  return FRAMES_PER_SECOND;
+}
+
 // ============================================================================
 // LED Setup
 // ============================================================================
@@ -56,22 +85,24 @@ void setupLEDs() {
   for (int i = 0; i < 7 * 4; i++) {
     int start = i * LEDS_PER_SEGMENT;
     start = start >= 140 ? start + COLON_LEDS : start; // Jump over Colon
-    segments[i] = Segment(leds, start, LEDS_PER_SEGMENT);
+    segments[i] = Segment(leds, i, start, LEDS_PER_SEGMENT);
   }
 
   // Initialize colon segment
-  segments[COLON_INDEX] = Segment(leds, 140, COLON_LEDS);
-  Serial.println("  Segments initialized");
+  segments[COLON_INDEX] = Segment(leds, COLON_INDEX, 140, COLON_LEDS);
+  Serial.printf("  Segments initialized (frame arena: %u bytes)\n",
+                sizeof(frameArena));
 
-  FastLED.addLeds<APA102, DATA_PIN, CLOCK_PIN, BGR>(leds, NUM_LEDS)
-      .setCorrection(TypicalLEDStrip);
-  FastLED.showColor(CRGB::Black);
-  Serial.printf("  FastLED initialized @ %d FPS\n", FRAMES_PER_SECOND);
+  setupAPA102(DATA_PIN, CLOCK_PIN);
+  apa102Show();
+  Serial.printf("  APA102 output: %d byte frame @ %d MHz SPI\n",
+                APA102_FRAME_BYTES, APA102_SPI_HZ / 1000000);
+  Serial.printf("  Render rate: up to %d FPS\n", FRAMES_PER_SECOND);
 
   // Start in dream mode
   enterDreamMode();
 
-  // Schedule auto wakeup based on settings
+  // Log the first auto wakeup based on settings
   scheduleAutoWakeup();
   Serial.println("=================\n");
 }
@@ -80,12 +111,36 @@ void setupLEDs() {
 // LED Main Loop
 // ============================================================================
 void loopLEDs() {
-  // Frame rate limiting
-  if ((millis() - lastMillis) < (1000 / FRAMES_PER_SECOND)) {
+  // Release a finished DMA transfer / send a frame that was waiting for it
+  apa102Poll();
+
+  // Frame rate limiting (per mode, wakeups and web commands render
+  // immediately). While off, every loop checks the schedule: loopPower()
+  // paces the loop.
+  if (!wakeup && currentMode != MODE_OFF && commandQueue.empty() &&
+      (millis() - lastMillis) < (1000UL / framesPerSecondFor(currentMode))) {
     return;
   }
   lastMillis = millis();
 
+  // Snapshots replaced last frame may be reused from now on (see settings.h)
+  settingsFrameBoundary();
+
+  // Settings, time and wakeups from the web server (see commands.h)
+  applyCommands();
+
+  // Advance blends by the time since the last frame, not by frame count
+  unsigned long nowMicros = micros();
+  advanceFrameClock(nowMicros - lastFrameMicros);
+  lastFrameMicros = nowMicros;
+
+  // Time for this frame (resyncs the RTC when due, raises minute events)
+  updateTime();
+
+  // Run expired timers before the mode update, so their changes are drawn
+  // this frame (and auto wakeups are handled while the display is off)
+  scheduler.update();
+
   // Update display mode state machine
   updateMode();
 
@@ -94,10 +149,19 @@ void loopLEDs() {
     return;
   }
 
-  // Draw all segments & update timers
+  // Draw all segments
   for (int i = 0; i < NUM_SEGMENTS; i++) {
     segments[i].draw();
   }
-  timer.update();
-  FastLED.show();
+
+  // Only clock the strip out when a segment changed
+  if (frameArena.dirtyMask) {
+    apa102Show();
+    frameArena.dirtyMask = 0;
+    if (frameStats.pushed++ == 0) {
+      markBootStage(BOOT_FIRST_FRAME);
+    }
+  } else {
+    frameStats.skipped++;
+  }
 }
@@ -6,15 +6,16 @@
 bool wakeup = false;
 bool timeWasSet = false;
 
+#include "boot.h"
 #include "leds.h"
 #include "network.h"
 #include "ota.h"
+#include "power.h"
 #include "rtc.h"
 #include "web.h"
 
 void setup() {
   Serial.begin(115200);
-  delay(100); // Give Serial time to initialize
 
   Serial.println();
   Serial.println("╔══════════════════════════════════════╗");
@@ -22,31 +23,38 @@ void setup() {
   Serial.println("╚══════════════════════════════════════╝");
   Serial.println();
 
-  for (uint8_t t = 3; t > 0; t--) {
-    Serial.printf("Starting in %d...\n", t);
-    Serial.flush();
-    delay(1000);
-  }
-  Serial.println();
-
+  // Display first: the clock dreams while the network comes up
   setupRTC();
+  markBootStage(BOOT_RTC);
   setupSettings();
-  setupNetwork();
-  setupOTA();
-  setupWeb();
+  markBootStage(BOOT_SETTINGS);
   setupLEDs();
+  markBootStage(BOOT_LEDS);
 
   Serial.println();
   Serial.println("╔══════════════════════════════════════╗");
-  Serial.println("║         SETUP COMPLETE! ✓            ║");
+  Serial.println("║         DISPLAY READY! ✓             ║");
   Serial.println("╚══════════════════════════════════════╝");
-  Serial.printf("Free heap: %d bytes\n", ESP.getFreeHeap());
+  Serial.printf("Display up after %u ms, free heap: %d bytes\n",
+                bootStageMicros[BOOT_LEDS] / 1000, ESP.getFreeHeap());
   Serial.println();
+
+  // Network, OTA and web server in the background (see boot.h)
+  startBackgroundBoot();
 }
 
 void loop() {
-  loopNetwork(); // Don't delete!
-  loopOTA();     // Don't delete!
-  loopWeb();     // WebSocket LED preview
+  // Services only run once the boot task has started them
+  if (bootStageDone(BOOT_NETWORK)) {
+    loopNetwork(); // Don't delete!
+  }
+  if (bootStageDone(BOOT_OTA)) {
+    loopOTA(); // Don't delete!
+  }
+  if (bootStageDone(BOOT_WEB)) {
+    loopWeb(); // WebSocket LED preview
+  }
+  loopSettings(); // Commits settings changes once they settle
   loopLEDs();
+  loopPower(); // Idles while the display is off
 }
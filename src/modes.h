@@ -1,10 +1,13 @@
 #pragma once
 #include <Arduino.h>
 #include <RTClib.h>
-#include <Timer.h>
 
+#include "choreography.h"
 #include "display.h"
 #include "dreams.h"
+#include "power.h"
+#include "schedule.h"
+#include "scheduler.h"
 #include "segment.h"
 #include "settings.h"
 
@@ -17,12 +20,14 @@ extern bool usingInternalTime;
 DateTime getCurrentTime();
 extern CRGB leds[];
 extern Segment segments[];
-extern Timer timer;
+extern Scheduler scheduler;
 
 // ============================================================================
 // Constants
 // ============================================================================
 #define WAKEUP_DURATION_MS 15000
+#define DREAM_WORD_FADE_MS (DREAM_WORD_DISPLAY_MS / 4) // 25% fade in/out
+#define DREAM_WORD_HUE_MS 100 // The word's hue drifts one step per 100 ms
 
 // ============================================================================
 // Display Modes
@@ -41,16 +46,25 @@ DisplayMode currentMode = MODE_DREAM;
 bool awake = false;
 CHSV mainColor = CHSV(random(0, 255), 255, 255);
 
-// Timer event IDs
-int8_t sleepAgainEvent = -1;
-int8_t autoWakeupEvent = -1;
-int8_t dreamWordEvent = -1;
+// Timer handles
+TimerHandle sleepAgainEvent = NO_TIMER;
+TimerHandle autoWakeupEvent = NO_TIMER;
+
+// Dream words: pause, then a word fades in, holds and fades out, and again
+// (a skipped word is tried again after half a pause)
+const ChoreoStep DREAM_WORD_CHOREOGRAPHY[] = {
+    {CHOREO_WAIT, 0, 0, DREAM_WORD_PAUSE_MS},
+    {CHOREO_SHOW, 0, DREAM_WORD_MIN_OPACITY, DREAM_WORD_PAUSE_MS / 2},
+    {CHOREO_FADE, DREAM_WORD_MIN_OPACITY, DREAM_WORD_MAX_OPACITY,
+     DREAM_WORD_FADE_MS},
+    {CHOREO_WAIT, 0, 0, DREAM_WORD_DISPLAY_MS - 2 * DREAM_WORD_FADE_MS},
+    {CHOREO_FADE, DREAM_WORD_MAX_OPACITY, DREAM_WORD_MIN_OPACITY,
+     DREAM_WORD_FADE_MS},
+    {CHOREO_HIDE, 0, 0, 0},
+    {CHOREO_LOOP, 0, 0, 0},
+};
 
-// Dream word state
-bool showingDreamWord = false;
-const char *currentDreamWord = nullptr;
-unsigned long dreamWordStartTime = 0;
-int dreamWordOpacity = 0;
+Choreographer dreamWord;
 
 // ============================================================================
 // Forward Declarations
@@ -58,8 +72,6 @@ int dreamWordOpacity = 0;
 void enterDreamMode();
 void enterWakeupMode();
 void scheduleAutoWakeup();
-void startDreamWord();
-void endDreamWord();
 
 // ============================================================================
 // Timer Callbacks
@@ -78,50 +90,33 @@ inline void triggerAutoWakeup() {
 // Timer Scheduling
 // ============================================================================
 
-// Schedule the next auto wakeup at the next aligned time
+// Schedule the next auto wakeup at the next aligned time of day
 // e.g., every 15 min -> wakeup at :00, :15, :30, :45
+// This is a wall-clock timer, so it follows the RTC (and time changes)
+// rather than a millis() delay.
 inline void scheduleAutoWakeup() {
-  if (autoWakeupEvent >= 0) {
-    timer.stop(autoWakeupEvent);
-    autoWakeupEvent = -1;
-  }
+  scheduler.cancel(autoWakeupEvent);
 
-  int intervalMinutes = clockSettings.wakeupInterval;
+  int intervalMinutes = currentSettings()->clock.wakeupInterval;
   if (intervalMinutes <= 0 || !timeWasSet) {
     return;
   }
 
-  DateTime now = getCurrentTime();
-  int currentMinute = now.minute();
-  int currentSecond = now.second();
-
-  // Calculate minutes until next aligned time
-  // e.g., if interval=15 and current=17, next aligned = 30, wait = 13 min
-  int minutesSinceLastSlot = currentMinute % intervalMinutes;
-  int minutesToNextSlot = intervalMinutes - minutesSinceLastSlot;
-
-  // If we're exactly on a slot, schedule for the next one
-  if (minutesSinceLastSlot == 0 && currentSecond == 0) {
-    minutesToNextSlot = intervalMinutes;
-  }
-
-  // Convert to milliseconds, accounting for current seconds
-  unsigned long msToNextSlot =
-      (unsigned long)minutesToNextSlot * 60 * 1000 - currentSecond * 1000;
-
-  int nextMinute = (currentMinute + minutesToNextSlot) % 60;
-  Serial.printf("[WAKEUP] Next auto wakeup at :%02d (in %lu ms)\n", nextMinute,
-                msToNextSlot);
+  uint32_t now = currentUnixTime();
+  uint32_t dayStart = now - now % 86400;
+  uint32_t minuteOfDay = (now - dayStart) / 60;
+  uint32_t nextSlot = (minuteOfDay / intervalMinutes + 1) * intervalMinutes;
+  Serial.printf("[WAKEUP] Next auto wakeup at %02u:%02u (in %u min)\n",
+                (nextSlot / 60) % 24, nextSlot % 60, nextSlot - minuteOfDay);
 
-  autoWakeupEvent = timer.after(msToNextSlot, triggerAutoWakeup);
+  autoWakeupEvent = scheduler.atUnix(dayStart + nextSlot * 60,
+                                     triggerAutoWakeup);
 }
 
 // Start the sleep timer after wakeup
 inline void startSleepTimer() {
-  if (sleepAgainEvent >= 0) {
-    timer.stop(sleepAgainEvent);
-  }
-  sleepAgainEvent = timer.after(WAKEUP_DURATION_MS, goSleep);
+  scheduler.cancel(sleepAgainEvent);
+  sleepAgainEvent = scheduler.after(WAKEUP_DURATION_MS, goSleep);
 }
 
 // ============================================================================
@@ -143,92 +138,74 @@ inline void setDreamWord(const char *word, int opacity) {
     }
   }
   // Keep colon dim during dreams
-  segments[COLON_INDEX].opacity = opacity / 4;
+  segments[COLON_INDEX].setOpacity(opacity / 4);
 }
 
-// Start showing a new dream word
-void startDreamWord() {
-  // return;
-  // Only start dream word if we're actually in dream mode
-  if (currentMode != MODE_DREAM) {
-    Serial.println("[DREAM] Skipping dream word - not in dream mode");
-    return;
-  }
-
+// The next word, nullptr to skip this one (DREAM_WORD_PROBABILITY)
+inline const char *pickDreamWord() {
   if (random8() > DREAM_WORD_PROBABILITY) {
-    // Skip this word, schedule next attempt
-    Serial.println("[DREAM] Probability skip, trying again later");
-    dreamWordEvent = timer.after(DREAM_WORD_PAUSE_MS / 2, startDreamWord);
-    return;
+    return nullptr;
   }
-
-  currentDreamWord = getRandomDreamWord();
-  Serial.printf("[DREAM] Starting word: %s\n", currentDreamWord);
-  showingDreamWord = true;
-  dreamWordStartTime = millis();
-  dreamWordOpacity = DREAM_WORD_MIN_OPACITY;
-
-  // Schedule end of word display
-  dreamWordEvent = timer.after(DREAM_WORD_DISPLAY_MS, endDreamWord);
+  return getRandomDreamWord();
 }
 
-// End the current dream word and return to pure random
-void endDreamWord() {
-  // return;
-  Serial.println("[DREAM] Ending dream word, returning to random");
-  showingDreamWord = false;
-  currentDreamWord = nullptr;
-  dreamWordOpacity = 0;
-
-  // Return all segments to random mode with full opacity
-  for (int i = 0; i < 7 * 4; i++) {
-    segments[i].mode = SegmentMode::RANDOM;
-    segments[i].opacity = 255;
-  }
+// Start the dream word choreography from its first pause
+inline void startDreamWords() {
+  Serial.printf("[DREAM] Scheduling first dream word in %d ms\n",
+                DREAM_WORD_PAUSE_MS);
+  dreamWord.start(DREAM_WORD_CHOREOGRAPHY, pickDreamWord,
+                  DREAM_WORD_KEYFRAME_MS, millis());
+}
 
-  // Schedule next dream word (only if still in dream mode)
-  if (currentMode == MODE_DREAM) {
+// Put what the choreography changed on the display
+inline void applyDreamWord(uint8_t events, uint32_t now) {
+  if (events & CHOREO_HIDDEN) {
+    // Return all segments to random mode with full opacity
+    Serial.println("[DREAM] Ending dream word, returning to random");
+    for (int i = 0; i < 7 * 4; i++) {
+      segments[i].returnToRandom();
+      segments[i].setOpacity(255);
+    }
     Serial.printf("[DREAM] Scheduling next word in %d ms\n",
                   DREAM_WORD_PAUSE_MS);
-    dreamWordEvent = timer.after(DREAM_WORD_PAUSE_MS, startDreamWord);
   }
-}
-
-// Update dream word animation (call every frame)
-void updateDreamWord() {
-  // return;
-  if (!showingDreamWord || currentDreamWord == nullptr)
+  if (events & CHOREO_SKIPPED) {
+    Serial.println("[DREAM] Probability skip, trying again later");
+  }
+  if (events & CHOREO_SHOWN) {
+    Serial.printf("[DREAM] Starting word: %s\n", dreamWord.word);
+  }
+  if (!dreamWord.showing()) {
     return;
-
-  unsigned long elapsed = millis() - dreamWordStartTime;
-  unsigned long fadeTime = DREAM_WORD_DISPLAY_MS / 4; // 25% fade in/out
-
-  if (elapsed < fadeTime) {
-    // Fading in
-    dreamWordOpacity = map(elapsed, 0, fadeTime, DREAM_WORD_MIN_OPACITY,
-                           DREAM_WORD_MAX_OPACITY);
-  } else if (elapsed > DREAM_WORD_DISPLAY_MS - fadeTime) {
-    // Fading out
-    unsigned long fadeElapsed = elapsed - (DREAM_WORD_DISPLAY_MS - fadeTime);
-    dreamWordOpacity = map(fadeElapsed, 0, fadeTime, DREAM_WORD_MAX_OPACITY,
-                           DREAM_WORD_MIN_OPACITY);
-  } else {
-    // Full visibility (but still subtle)
-    dreamWordOpacity = DREAM_WORD_MAX_OPACITY;
   }
 
-  // Apply the word pattern with current opacity
-  setDreamWord(currentDreamWord, dreamWordOpacity);
-
-  // Set colors for visible segments - blend with random background
+  // The word pattern with the current opacity (also puts back segments the
+  // random animation switched on since the last resume)
+  setDreamWord(dreamWord.word, dreamWord.opacity);
+
+  // Visible segments tween from what they show to the colour and opacity
+  // due at the next resume (the first keyframe blends out of the random
+  // background). Timed from the resume, not from millis() after the logging
+  uint32_t until = dreamWord.nextResume();
+  uint8_t opacity = dreamWord.opacityAt(until);
+  int32_t duration = (int32_t)(until - now);
+  Keyframe key = {CHSV((until / DREAM_WORD_HUE_MS) % 255, 180, opacity),
+                  opacity, (uint16_t)constrain(duration, 1, 0xFFFF)};
   for (int i = 0; i < 7 * 4; i++) {
-    if (segments[i].opacity > 0) {
-      CHSV dreamColor = CHSV((millis() / 100) % 255, 180, dreamWordOpacity);
-      segments[i].fillColor(dreamColor, DREAM_WORD_FADE_SPEED);
+    if (segments[i].opacity() > 0) {
+      segments[i].tweenTo(key);
     }
   }
 }
 
+// Resume the dream word choreography once its next deadline has come
+inline void updateDreamWord() {
+  uint32_t now = millis();
+  if (dreamWord.due(now)) {
+    applyDreamWord(dreamWord.resume(now), now);
+  }
+}
+
 // ============================================================================
 // Mode Handlers
 // ============================================================================
@@ -236,7 +213,7 @@ void updateDreamWord() {
 // Handle MODE_TIME_NOT_SET - blinking zeros
 void handleTimeNotSet() {
   setNumber(0, 255);
-  segments[COLON_INDEX].opacity = 255;
+  segments[COLON_INDEX].setOpacity(255);
   CRGB color = ((millis() % 2000) > 1000) ? mainColor : CRGB(0, 0, 0);
   for (int i = 0; i < NUM_SEGMENTS; i++) {
     segments[i].fillColor(color, 255);
@@ -255,43 +232,31 @@ void handleWakeupMode() { showCurrentTime(); }
 
 // Transition to dream mode
 void enterDreamMode() {
+  exitLowPower();
   Serial.println("[DREAM] Entering dream mode");
   currentMode = MODE_DREAM;
   awake = false;
 
   // Reset all segments to random
   for (int i = 0; i < NUM_SEGMENTS; i++) {
-    segments[i].mode = SegmentMode::RANDOM;
-    segments[i].speed = random(MIN_SPEED, MAX_SPEED);
-    segments[i].opacity = 255; // Ensure segments are visible
+    segments[i].setMode(SegmentMode::RANDOM);
+    segments[i].setSpeed(random(MIN_SPEED, MAX_SPEED));
+    segments[i].setOpacity(255); // Ensure segments are visible
   }
 
   // Start the dream word cycle
-  if (dreamWordEvent >= 0) {
-    timer.stop(dreamWordEvent);
-  }
-  showingDreamWord = false;
-  currentDreamWord = nullptr;
-
-  // Schedule first dream word
-  Serial.printf("[DREAM] Scheduling first dream word in %d ms\n",
-                DREAM_WORD_PAUSE_MS);
-  dreamWordEvent = timer.after(DREAM_WORD_PAUSE_MS, startDreamWord);
+  startDreamWords();
 }
 
 // Transition to wakeup mode (showing time)
 void enterWakeupMode() {
+  exitLowPower();
   Serial.println("[WAKEUP] Entering wakeup mode");
   currentMode = MODE_WAKEUP;
   awake = true;
 
   // Stop any pending dream word
-  if (dreamWordEvent >= 0) {
-    timer.stop(dreamWordEvent);
-    dreamWordEvent = -1;
-  }
-  showingDreamWord = false;
-  currentDreamWord = nullptr;
+  dreamWord.stop();
 
   // Pick new main color
   mainColor = CHSV(random(0, 255), 255, 255);
@@ -302,13 +267,13 @@ void enterWakeupMode() {
 
   // Set all digit segments to COLOR mode first
   for (int i = 0; i < 7 * 4; i++) {
-    segments[i].mode = SegmentMode::COLOR;
+    segments[i].setMode(SegmentMode::COLOR);
     segments[i].fillColor(mainColor, 10);
   }
 
   // Set colon to full brightness
-  segments[COLON_INDEX].mode = SegmentMode::COLOR;
-  segments[COLON_INDEX].opacity = 255;
+  segments[COLON_INDEX].setMode(SegmentMode::COLOR);
+  segments[COLON_INDEX].setOpacity(255);
   segments[COLON_INDEX].fillColor(mainColor, 255);
 
   // Start sleep timer
@@ -327,8 +292,7 @@ void updateMode() {
 
     // Only wakeup if time is set and display should be active
     if (timeWasSet) {
-      DateTime now = getCurrentTime();
-      if (isDisplayActiveTime(now.dayOfTheWeek(), now.hour())) {
+      if (isDisplayActiveTime(currentUnixTime())) {
         enterWakeupMode();
         return; // Skip rest of update, mode is set
       }
@@ -342,14 +306,21 @@ void updateMode() {
       currentMode = MODE_TIME_NOT_SET;
     }
   } else if (currentMode != MODE_WAKEUP) {
-    // Only check active hours if not in wakeup mode
-    DateTime now = getCurrentTime();
-    if (!isDisplayActiveTime(now.dayOfTheWeek(), now.hour())) {
+    // Only check active hours if not in wakeup mode (cached until the next
+    // schedule edge, see schedule.h)
+    if (!isDisplayActiveTime(currentUnixTime())) {
       if (currentMode != MODE_OFF) {
         Serial.println("[MODE] Outside active hours -> MODE_OFF");
         currentMode = MODE_OFF;
+        // Blank once, the strip holds black until we come back
+        apa102ShowBlack();
+        invalidateFrame(); // Repaint fully when we come back
       }
-      FastLED.showColor(CRGB::Black);
+      // Idle until the next schedule edge (refreshed every off frame, the
+      // schedule or the clock may have changed)
+      enterLowPower(scheduleWatch.untilUnix == 0xFFFFFFFF
+                        ? 0
+                        : unixToTimerMicros(scheduleWatch.untilUnix));
       return;
     } else if (currentMode == MODE_OFF) {
       // Came back into active hours, go to dream mode
@@ -1,43 +1,115 @@
-
 #pragma once
-#include <DNSServer.h>
 #include <ESPmDNS.h>
 #include <WiFi.h>
 
+#include "boot.h"
+#include "dns.h"
 #include "settings.h"
 
-// DNS Server for Captive Portal
-const int DNS_PORT = 53;
+// Access point address, every name resolves to it in captive mode (dns.h)
 IPAddress apIP(192, 168, 4, 1);
-DNSServer dnsServer;
 
-// Connection timeout for client mode (ms)
-#define WIFI_CONNECT_TIMEOUT 15000
+// ============================================================================
+// WiFi State Machine
+// ============================================================================
+// Nothing in here waits. WiFi.begin() only starts a connection attempt, its
+// outcome arrives as WiFi events on the WiFi event task. The event handler
+// only counts them; loopNetwork() acts on them on the loop task:
+//
+//   CONNECTING --got IP--> CONNECTED --link lost--> BACKOFF --> CONNECTING
+//   CONNECTING --rejected / WIFI_CONNECT_TIMEOUT--> BACKOFF
+//   BACKOFF (WIFI_FALLBACK_ATTEMPTS failures, fallback on) --> CAPTIVE
+//
+// Retries wait WIFI_BACKOFF_MIN_MS, doubling per failed attempt up to
+// WIFI_BACKOFF_MAX_MS. A lost link retries after the minimum wait. Captive
+// mode stays until the network is restarted.
+//
+// restartNetwork() may be called from the web server task: it only requests
+// the restart, loopNetwork() performs it WIFI_RESTART_DELAY_MS later (so the
+// HTTP response still goes out on the old link).
+// ============================================================================
+#define WIFI_CONNECT_TIMEOUT 15000 // One connection attempt (ms)
+#define WIFI_BACKOFF_MIN_MS 1000   // First retry delay
+#define WIFI_BACKOFF_MAX_MS 60000  // Retry delay cap
+#define WIFI_FALLBACK_ATTEMPTS 3   // Failed attempts before captive fallback
+#define WIFI_RESTART_DELAY_MS 200  // Let the HTTP response go out first
+
+enum NetworkState {
+  NET_OFF,        // No SSID and no fallback: nothing to do
+  NET_CONNECTING, // WiFi.begin() issued, waiting for an IP
+  NET_CONNECTED,  // Station has an IP
+  NET_BACKOFF,    // Waiting before the next attempt
+  NET_CAPTIVE,    // Access point + captive DNS task
+};
+
+const char *const NETWORK_STATE_NAMES[] = {"off", "connecting", "connected",
+                                           "backoff", "captive"};
+
+struct NetworkStats {
+  uint32_t attempts;   // WiFi.begin() calls
+  uint32_t connects;   // Times an IP was obtained
+  uint32_t linkLosses; // Disconnects of an established link
+  uint8_t lastDisconnectReason;
+};
+
+NetworkState networkState = NET_OFF;
+NetworkStats networkStats = {0, 0, 0, 0};
+uint32_t networkStateSince = 0; // millis() of the last transition
+uint32_t backoffMs = WIFI_BACKOFF_MIN_MS;
+uint8_t failedAttempts = 0; // Consecutive failed attempts
 
 // Track current active mode (may differ from settings if fallback occurred)
 NetworkMode activeNetworkMode = NETWORK_CAPTIVE;
 
-// Flag to prevent loopNetwork from running during mode switch
-bool networkSwitching = false;
+// Written by the WiFi event task, each only by it (read-only here)
+volatile uint32_t wifiGotIpEvents = 0;
+volatile uint32_t wifiDisconnectEvents = 0;
+volatile uint8_t wifiDisconnectReason = 0;
+uint32_t seenGotIpEvents = 0;
+uint32_t seenDisconnectEvents = 0;
 
-// Cleanly stop all network services
-void stopNetworkServices() {
-  networkSwitching = true;
+// Set from the web server task
+volatile bool networkRestartRequested = false;
+volatile uint32_t networkRestartAt = 0;
 
-  // Stop DNS server first
-  dnsServer.stop();
-  delay(10);
+// Runs on the WiFi event task: record only
+void onWiFiEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
+  switch (event) {
+  case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+    wifiGotIpEvents++;
+    break;
+  case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+    // Our own WiFi.disconnect() is not a failure
+    if (info.wifi_sta_disconnected.reason != WIFI_REASON_ASSOC_LEAVE) {
+      wifiDisconnectReason = info.wifi_sta_disconnected.reason;
+      wifiDisconnectEvents++;
+    }
+    break;
+  default:
+    break;
+  }
+}
 
-  // Stop mDNS
-  MDNS.end();
-  delay(200);
+inline void setNetworkState(NetworkState state) {
+  networkState = state;
+  networkStateSince = millis();
+  activeNetworkMode = (state == NET_CAPTIVE) ? NETWORK_CAPTIVE : NETWORK_CLIENT;
+  bumpStateVersion(); // Reported by /api/state
+}
 
-  // Disconnect WiFi
-  WiFi.disconnect(true); // true = also erase stored credentials
-  WiFi.mode(WIFI_OFF);
-  delay(100);
+// Forget events that belong to an earlier attempt
+inline void discardWiFiEvents() {
+  seenGotIpEvents = wifiGotIpEvents;
+  seenDisconnectEvents = wifiDisconnectEvents;
+}
 
-  networkSwitching = false;
+// Stop all network services (returns immediately)
+void stopNetworkServices() {
+  stopCaptiveDns();
+  MDNS.end();
+  WiFi.disconnect();
+  setNetworkState(NET_OFF);
+  discardWiFiEvents();
 }
 
 // Start Captive Portal mode
@@ -45,99 +117,151 @@ void startCaptivePortal() {
   Serial.println("  Starting Captive Portal...");
 
   WiFi.mode(WIFI_AP);
-  delay(100);
   WiFi.softAPConfig(apIP, apIP, IPAddress(255, 255, 255, 0));
   WiFi.softAP(AP_SSID);
 
   MDNS.begin(HOSTNAME);
 
-  dnsServer.setErrorReplyCode(DNSReplyCode::NoError);
-  dnsServer.start(DNS_PORT, "*", apIP);
+  startCaptiveDns(apIP);
 
-  activeNetworkMode = NETWORK_CAPTIVE;
+  setNetworkState(NET_CAPTIVE);
+  markBootStage(BOOT_ONLINE);
   Serial.printf("  AP SSID: %s\n", AP_SSID);
   Serial.printf("  IP: %s\n", apIP.toString().c_str());
 }
 
-// Try to connect to WiFi in client mode
-bool connectToWiFi() {
-  if (strlen(networkSettings.ssid) == 0) {
-    Serial.println("  No SSID configured");
-    return false;
+// Start one connection attempt in client mode
+void beginWiFiAttempt() {
+  const NetworkSettings &settings = currentSettings()->network;
+  Serial.printf("[NET] Connecting to: %s (attempt %u)\n", settings.ssid,
+                failedAttempts + 1);
+  if (WiFi.getMode() != WIFI_STA) {
+    WiFi.mode(WIFI_STA);
   }
+  discardWiFiEvents();
+  WiFi.begin(settings.ssid, settings.password);
+  networkStats.attempts++;
+  setNetworkState(NET_CONNECTING);
+}
 
-  Serial.printf("  Connecting to: %s\n", networkSettings.ssid);
-
-  WiFi.mode(WIFI_STA);
-  delay(100);
-  WiFi.begin(networkSettings.ssid, networkSettings.password);
+void onWiFiConnected() {
+  Serial.printf("[NET] Connected! IP: %s\n",
+                WiFi.localIP().toString().c_str());
+  MDNS.begin(HOSTNAME);
+  networkStats.connects++;
+  failedAttempts = 0;
+  backoffMs = WIFI_BACKOFF_MIN_MS;
+  setNetworkState(NET_CONNECTED);
+  markBootStage(BOOT_ONLINE);
+}
 
-  unsigned long startTime = millis();
-  while (WiFi.status() != WL_CONNECTED) {
-    if (millis() - startTime > WIFI_CONNECT_TIMEOUT) {
-      Serial.println("\n  Connection timeout!");
-      return false;
-    }
-    delay(250);
-    Serial.print(".");
+void onWiFiAttemptFailed(const char *why) {
+  WiFi.disconnect(); // Abandon the attempt if it is still running
+  failedAttempts++;
+  if (failedAttempts >= WIFI_FALLBACK_ATTEMPTS &&
+      currentSettings()->network.fallbackToCaptive) {
+    Serial.printf("[NET] Attempt %s, falling back to Captive Portal\n", why);
+    startCaptivePortal();
+    return;
   }
-
-  Serial.printf("\n  Connected! IP: %s\n", WiFi.localIP().toString().c_str());
-  MDNS.begin(HOSTNAME);
-  activeNetworkMode = NETWORK_CLIENT;
-  return true;
+  Serial.printf("[NET] Attempt %s, retry in %u ms\n", why, backoffMs);
+  setNetworkState(NET_BACKOFF);
 }
 
-void setupNetwork() {
-  Serial.println("=== Network Setup ===");
+void onWiFiLinkLost() {
+  Serial.printf("[NET] WiFi disconnected (reason %u), reconnecting...\n",
+                networkStats.lastDisconnectReason);
+  MDNS.end();
+  networkStats.linkLosses++;
+  failedAttempts = 0;
+  backoffMs = WIFI_BACKOFF_MIN_MS;
+  setNetworkState(NET_BACKOFF);
+}
 
-  if (networkSettings.mode == NETWORK_CLIENT) {
-    // Try to connect to configured WiFi
-    if (!connectToWiFi()) {
-      // Connection failed
-      if (networkSettings.fallbackToCaptive) {
-        Serial.println("  Falling back to Captive Portal");
-        startCaptivePortal();
-      } else {
-        Serial.println("  WiFi connection failed, no fallback enabled");
-        // Keep trying in client mode
-        activeNetworkMode = NETWORK_CLIENT;
-      }
-    }
+// Start the network per the settings (returns immediately)
+void startNetwork() {
+  const NetworkSettings &settings = currentSettings()->network;
+  if (settings.mode == NETWORK_CLIENT &&
+      strlen(settings.ssid) > 0) {
+    failedAttempts = 0;
+    backoffMs = WIFI_BACKOFF_MIN_MS;
+    beginWiFiAttempt();
+  } else if (settings.mode == NETWORK_CLIENT &&
+             !settings.fallbackToCaptive) {
+    Serial.println("  No SSID configured, no fallback enabled");
+    setNetworkState(NET_OFF);
   } else {
     // Default: Captive Portal mode
+    if (settings.mode == NETWORK_CLIENT) {
+      Serial.println("  No SSID configured");
+    }
     startCaptivePortal();
   }
+}
+
+void setupNetwork() {
+  Serial.println("=== Network Setup ===");
+  WiFi.persistent(false);       // Credentials live in the settings blob
+  WiFi.setAutoReconnect(false); // Reconnects are ours (with backoff)
+  WiFi.onEvent(onWiFiEvent);
+  startNetwork();
   Serial.println("=====================");
 }
 
 void loopNetwork() {
-  // Don't process during network mode switch
-  if (networkSwitching) {
+  if (networkRestartRequested &&
+      (int32_t)(millis() - networkRestartAt) >= 0) {
+    networkRestartRequested = false;
+    Serial.println("\n>>> Restarting network with new settings...");
+    stopNetworkServices();
+    startNetwork();
+    return;
+  }
+
+  // Events since the last loop (an IP before a disconnect, if both came)
+  uint32_t gotIp = wifiGotIpEvents;
+  uint32_t disconnects = wifiDisconnectEvents;
+  bool connected = gotIp != seenGotIpEvents;
+  bool dropped = disconnects != seenDisconnectEvents;
+  seenGotIpEvents = gotIp;
+  seenDisconnectEvents = disconnects;
+  if (dropped) {
+    networkStats.lastDisconnectReason = wifiDisconnectReason;
+  }
+
+  if (connected && networkState == NET_CONNECTING) {
+    onWiFiConnected();
+  }
+  if (dropped && networkState == NET_CONNECTED) {
+    onWiFiLinkLost();
     return;
   }
 
-  if (activeNetworkMode == NETWORK_CAPTIVE) {
-    dnsServer.processNextRequest();
-  } else if (activeNetworkMode == NETWORK_CLIENT) {
-    // Check if still connected, try to reconnect if not
-    static unsigned long lastReconnectAttempt = 0;
-    if (WiFi.status() != WL_CONNECTED &&
-        (millis() - lastReconnectAttempt > 5000)) {
-      lastReconnectAttempt = millis();
-      Serial.println("WiFi disconnected, reconnecting...");
-      stopNetworkServices();
-      if (!connectToWiFi() && networkSettings.fallbackToCaptive) {
-        Serial.println("Reconnection failed, falling back to Captive Portal");
-        startCaptivePortal();
-      }
+  uint32_t elapsed = millis() - networkStateSince;
+  switch (networkState) {
+  case NET_CONNECTING:
+    if (dropped) {
+      onWiFiAttemptFailed("rejected");
+    } else if (elapsed >= WIFI_CONNECT_TIMEOUT) {
+      onWiFiAttemptFailed("timed out");
     }
+    break;
+  case NET_BACKOFF:
+    if (elapsed >= backoffMs) {
+      backoffMs = min(backoffMs * 2, (uint32_t)WIFI_BACKOFF_MAX_MS);
+      beginWiFiAttempt();
+    }
+    break;
+  case NET_CONNECTED:
+  case NET_CAPTIVE: // DNS is answered by its own task
+  case NET_OFF:
+    break;
   }
 }
 
-// Restart network with new settings (called after saving network config)
+// Restart network with new settings (called after saving network config).
+// Safe from other tasks: the restart itself runs in loopNetwork().
 void restartNetwork() {
-  Serial.println("\n>>> Restarting network with new settings...");
-  stopNetworkServices();
-  setupNetwork();
-}
\ No newline at end of file
+  networkRestartAt = millis() + WIFI_RESTART_DELAY_MS;
+  networkRestartRequested = true;
+}
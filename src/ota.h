@@ -13,7 +13,10 @@ void setupOTA() {
   MDNS.addService("ota", "tcp", 3232);
   Serial.println("  mDNS service: ota (TCP:3232)");
 
-  ArduinoOTA.onStart([]() { Serial.println("\n>>> OTA Update started..."); });
+  ArduinoOTA.onStart([]() {
+    Serial.println("\n>>> OTA Update started...");
+    flushSettings(); // The update ends in a reboot
+  });
   ArduinoOTA.onEnd(
       []() { Serial.println("\n>>> OTA Update complete! Rebooting..."); });
   ArduinoOTA.onProgress([](unsigned int progress, unsigned int total) {
@@ -0,0 +1,121 @@
+#pragma once
+#include <Arduino.h>
+#include <IPAddress.h>
+
+// ============================================================================
+// Captive Portal Probes
+// ============================================================================
+// A phone or laptop that joins the access point fetches a well-known URL to
+// find out whether it is online, usually several in a burst. In captive
+// mode every name resolves to the clock (network.h), so all of them land
+// here.
+//
+// Probes are answered from a table built at compile time. The request path
+// is hashed once (FNV-1a) and compared against the precomputed hashes, so an
+// unknown URL costs a hash and a few integer compares. A probe gets a canned
+// 302 to the portal's absolute URL (prebuilt once from the AP address). The
+// OS then shows its sign-in page and opens the portal by IP, without another
+// DNS lookup for the probe's host name. Nothing is read or formatted per
+// probe.
+//
+// probeStats counts the probes per OS and the time from the first probe of a
+// burst until the portal page is served (the user saw the sign-in prompt).
+// ============================================================================
+#define PROBE_BURST_MS 60000 // A probe this long after the last starts anew
+#define PROBE_LOCATION_SIZE 24
+
+enum ProbeOs : uint8_t {
+  PROBE_ANDROID,
+  PROBE_APPLE,
+  PROBE_WINDOWS,
+  PROBE_FIREFOX,
+  PROBE_OS_COUNT,
+};
+
+const char *const PROBE_OS_NAMES[PROBE_OS_COUNT] = {"android", "apple",
+                                                    "windows", "firefox"};
+
+// FNV-1a, usable at compile time (C++11 constexpr: one return statement)
+constexpr uint32_t probeHash(const char *path, uint32_t hash = 2166136261u) {
+  return *path ? probeHash(path + 1, (hash ^ (uint8_t)*path) * 16777619u)
+               : hash;
+}
+
+struct ProbeRoute {
+  const char *path;
+  uint32_t hash;
+  ProbeOs os;
+};
+
+#define PROBE_ROUTE(path, os) {path, probeHash(path), os}
+
+const ProbeRoute PROBE_ROUTES[] = {
+    PROBE_ROUTE("/generate_204", PROBE_ANDROID),
+    PROBE_ROUTE("/gen_204", PROBE_ANDROID),
+    PROBE_ROUTE("/mobile/status.php", PROBE_ANDROID),
+    PROBE_ROUTE("/hotspot-detect.html", PROBE_APPLE),
+    PROBE_ROUTE("/library/test/success.html", PROBE_APPLE),
+    PROBE_ROUTE("/connecttest.txt", PROBE_WINDOWS),
+    PROBE_ROUTE("/ncsi.txt", PROBE_WINDOWS),
+    PROBE_ROUTE("/redirect", PROBE_WINDOWS),
+    PROBE_ROUTE("/success.txt", PROBE_FIREFOX),
+    PROBE_ROUTE("/canonical.html", PROBE_FIREFOX),
+};
+
+struct ProbeStats {
+  uint32_t answered[PROBE_OS_COUNT];
+  uint32_t lastMicros; // Request -> response queued (last probe)
+  uint32_t maxMicros;
+  uint32_t bursts;
+  uint32_t burstStartMs; // First probe of the current burst
+  uint32_t lastProbeMs;
+  uint32_t lastPortalMs; // First probe -> portal page, last burst
+  bool burstOpen;        // No portal page served since its first probe
+};
+
+ProbeStats probeStats = {{0, 0, 0, 0}, 0, 0, 0, 0, 0, 0, false};
+char probeLocation[PROBE_LOCATION_SIZE] = "http://192.168.4.1/";
+
+// Once at setup: the portal URL the probes are redirected to
+inline void setProbeLocation(const IPAddress &ip) {
+  snprintf(probeLocation, sizeof(probeLocation), "http://%u.%u.%u.%u/", ip[0],
+           ip[1], ip[2], ip[3]);
+}
+
+// The probe route of a request path, nullptr if it is none
+inline const ProbeRoute *findProbeRoute(const char *path) {
+  uint32_t hash = 2166136261u;
+  for (const char *p = path; *p; p++) {
+    hash = (hash ^ (uint8_t)*p) * 16777619u;
+  }
+  for (const ProbeRoute &route : PROBE_ROUTES) {
+    if (route.hash == hash && strcmp(route.path, path) == 0) {
+      return &route;
+    }
+  }
+  return nullptr;
+}
+
+// A probe was answered
+inline void noteProbe(ProbeStats &stats, const ProbeRoute &route,
+                      uint32_t now, uint32_t micros) {
+  stats.answered[route.os]++;
+  stats.lastMicros = micros;
+  if (micros > stats.maxMicros) {
+    stats.maxMicros = micros;
+  }
+  if (stats.bursts == 0 || now - stats.lastProbeMs >= PROBE_BURST_MS) {
+    stats.burstOpen = true;
+    stats.burstStartMs = now;
+    stats.bursts++;
+  }
+  stats.lastProbeMs = now;
+}
+
+// The portal page was served
+inline void notePortalOpened(ProbeStats &stats, uint32_t now) {
+  if (stats.burstOpen) {
+    stats.lastPortalMs = now - stats.burstStartMs;
+    stats.burstOpen = false;
+  }
+}
@@ -0,0 +1,131 @@
+#pragma once
+#include <Arduino.h>
+#include <esp_timer.h>
+
+#if CONFIG_PM_ENABLE && CONFIG_FREERTOS_USE_TICKLESS_IDLE
+#include <esp_pm.h>
+#endif
+
+// ============================================================================
+// Low-Power Idle (MODE_OFF)
+// ============================================================================
+// While the display is off the strip is blanked once and the main loop stops
+// spinning: loopPower() blocks in delay() until the next schedule edge, but
+// at most OFF_IDLE_MAX_MS, so network polling (OTA) stays responsive. The
+// CPU drops to OFF_CPU_MHZ, the lowest clock WiFi supports. On builds with
+// tickless idle and power management enabled, the idle waits become
+// automatic light sleep instead (the WiFi modem sleeps between beacons in
+// station mode).
+//
+// Proxies for the saving are kept in powerStats: loop iterations and the
+// share of time not spent idle per second, and how late the display came
+// back relative to the schedule edge.
+// ============================================================================
+#define OFF_IDLE_MAX_MS 100 // Longest idle wait (network polling latency)
+#define OFF_CPU_MHZ 80
+#define POWER_STATS_WINDOW_US 1000000
+
+struct PowerStats {
+  uint32_t loopsPerSecond;    // Main loop iterations in the last window
+  uint8_t busyPercent;        // Time not spent in idle waits, last window
+  uint32_t lastWakeLatencyMs; // Schedule edge -> display back on
+  uint32_t maxWakeLatencyMs;
+  uint32_t offCount; // Times the display went off
+};
+
+// ============================================================================
+// Power State
+// ============================================================================
+PowerStats powerStats = {0, 100, 0, 0, 0};
+bool lowPower = false;
+int64_t wakeEdgeMicros = 0; // esp_timer time of the next schedule edge
+uint32_t savedCpuMhz = 0;
+
+// Statistics window
+int64_t powerWindowStart = 0;
+int64_t powerWindowIdle = 0;
+uint32_t powerWindowLoops = 0;
+
+// Blank stays on the strip; wake up again at wakeAtMicros (0 = no edge)
+inline void enterLowPower(int64_t wakeAtMicros) {
+  wakeEdgeMicros = wakeAtMicros;
+  if (lowPower) {
+    return;
+  }
+  lowPower = true;
+  powerStats.offCount++;
+
+#if CONFIG_PM_ENABLE && CONFIG_FREERTOS_USE_TICKLESS_IDLE
+  esp_pm_config_esp32c3_t pm = {};
+  pm.max_freq_mhz = OFF_CPU_MHZ;
+  pm.min_freq_mhz = 10;
+  pm.light_sleep_enable = true;
+  esp_pm_configure(&pm);
+#else
+  savedCpuMhz = getCpuFrequencyMhz();
+  setCpuFrequencyMhz(OFF_CPU_MHZ);
+#endif
+  if (wakeAtMicros) {
+    Serial.printf("[POWER] Low power, next edge in %lld s\n",
+                  (long long)((wakeAtMicros - esp_timer_get_time()) / 1000000));
+  } else {
+    Serial.println("[POWER] Low power, no edge scheduled");
+  }
+}
+
+inline void exitLowPower() {
+  if (!lowPower) {
+    return;
+  }
+  lowPower = false;
+
+#if CONFIG_PM_ENABLE && CONFIG_FREERTOS_USE_TICKLESS_IDLE
+  esp_pm_config_esp32c3_t pm = {};
+  pm.max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+  pm.min_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+  pm.light_sleep_enable = false;
+  esp_pm_configure(&pm);
+#else
+  setCpuFrequencyMhz(savedCpuMhz);
+#endif
+
+  // Only an edge that has passed counts (settings changes wake early)
+  int64_t late = esp_timer_get_time() - wakeEdgeMicros;
+  if (wakeEdgeMicros && late >= 0) {
+    powerStats.lastWakeLatencyMs = late / 1000;
+    powerStats.maxWakeLatencyMs =
+        max(powerStats.maxWakeLatencyMs, powerStats.lastWakeLatencyMs);
+    Serial.printf("[POWER] Awake, %u ms after the edge\n",
+                  powerStats.lastWakeLatencyMs);
+  } else {
+    Serial.println("[POWER] Awake");
+  }
+}
+
+// Call last in loop(): idles while the display is off, keeps statistics
+inline void loopPower() {
+  int64_t now = esp_timer_get_time();
+  powerWindowLoops++;
+
+  if (lowPower) {
+    int64_t waitMicros = (int64_t)OFF_IDLE_MAX_MS * 1000;
+    if (wakeEdgeMicros && wakeEdgeMicros - now < waitMicros) {
+      waitMicros = max(wakeEdgeMicros - now, (int64_t)0);
+    }
+    if (waitMicros > 0) {
+      delay((waitMicros + 999) / 1000); // Round up to land past the edge
+      int64_t after = esp_timer_get_time();
+      powerWindowIdle += after - now;
+      now = after;
+    }
+  }
+
+  int64_t window = now - powerWindowStart;
+  if (window >= POWER_STATS_WINDOW_US) {
+    powerStats.loopsPerSecond = powerWindowLoops * 1000000LL / window;
+    powerStats.busyPercent = 100 - powerWindowIdle * 100 / window;
+    powerWindowStart = now;
+    powerWindowIdle = 0;
+    powerWindowLoops = 0;
+  }
+}
@@ -0,0 +1,266 @@
+#pragma once
+#include <Arduino.h>
+#include <FastLED.h>
+
+#include "frame.h"
+
+// ============================================================================
+// LED Preview Encoding
+// ============================================================================
+// The preview streams (websocket.h) only send what changed since the last
+// message. A stream is a fixed number of units (segments or LEDs), each an
+// RGB triplet. Every message starts with a 3 byte header:
+//
+//   [PREVIEW_VERSION, type, sequence]
+//
+//   PREVIEW_KEYFRAME: units × RGB
+//   PREVIEW_DELTA:    bitmap of changed units (bit u = byte u / 8, LSB
+//                     first), then the RGB of each changed unit in order
+//
+// The sequence increments with every frame that changed; a keyframe repeats
+// the current one. A client applies deltas only on top of the previous
+// sequence and asks for a keyframe (text message "key") when it sees a gap.
+// An unchanged frame produces no message at all, and a delta that would not
+// be smaller than a keyframe is sent as a keyframe.
+// ============================================================================
+#define PREVIEW_VERSION 1
+#define PREVIEW_HEADER_BYTES 3
+#define PREVIEW_INTERVAL_MS 50 // ~20 FPS sampling
+
+enum PreviewMessageType : uint8_t {
+  PREVIEW_KEYFRAME = 0,
+  PREVIEW_DELTA = 1,
+};
+
+struct PreviewStats {
+  uint32_t frames;    // Frames with a change
+  uint32_t keyframes; // Keyframes built (fallbacks + for clients)
+};
+
+template <uint16_t UNITS> class PreviewEncoder {
+public:
+  static const uint16_t BITMAP_BYTES = (UNITS + 7) / 8;
+  static const uint16_t KEYFRAME_BYTES = PREVIEW_HEADER_BYTES + UNITS * 3;
+  // Worst case delta, the size of a message buffer
+  static const uint16_t MESSAGE_BYTES = KEYFRAME_BYTES + BITMAP_BYTES;
+
+  PreviewEncoder() : sequence(0) {
+    memset(last, 0, sizeof(last));
+    memset(&stats, 0, sizeof(stats));
+  }
+
+  // Encode a frame (UNITS × RGB) against the last one into out
+  // (MESSAGE_BYTES), returns the message length or 0 if nothing changed
+  uint16_t encode(const uint8_t *rgb, uint8_t *out) {
+    uint8_t *bitmap = out + PREVIEW_HEADER_BYTES;
+    uint8_t *p = bitmap + BITMAP_BYTES;
+    memset(bitmap, 0, BITMAP_BYTES);
+    for (uint16_t u = 0; u < UNITS; u++) {
+      const uint8_t *unit = rgb + u * 3;
+      uint8_t *previous = last + u * 3;
+      if (unit[0] == previous[0] && unit[1] == previous[1] &&
+          unit[2] == previous[2]) {
+        continue;
+      }
+      bitmap[u >> 3] |= 1 << (u & 7);
+      p[0] = previous[0] = unit[0];
+      p[1] = previous[1] = unit[1];
+      p[2] = previous[2] = unit[2];
+      p += 3;
+    }
+    if (p == bitmap + BITMAP_BYTES) {
+      return 0; // Unchanged
+    }
+
+    sequence++;
+    stats.frames++;
+    uint16_t length = p - out;
+    if (length >= KEYFRAME_BYTES) {
+      return keyframe(out);
+    }
+    writeHeader(out, PREVIEW_DELTA);
+    return length;
+  }
+
+  // A keyframe of the last encoded frame into out, returns its length
+  uint16_t keyframe(uint8_t *out) {
+    writeHeader(out, PREVIEW_KEYFRAME);
+    memcpy(out + PREVIEW_HEADER_BYTES, last, sizeof(last));
+    stats.keyframes++;
+    return KEYFRAME_BYTES;
+  }
+
+  PreviewStats stats;
+
+private:
+  uint8_t last[UNITS * 3]; // What the clients show
+  uint8_t sequence;
+
+  void writeHeader(uint8_t *out, PreviewMessageType type) {
+    out[0] = PREVIEW_VERSION;
+    out[1] = type;
+    out[2] = sequence;
+  }
+};
+
+// Average RGB per segment (29 × 3 bytes, colon last)
+inline void previewSegments(const CRGB *pixels, uint8_t *rgb) {
+  for (int seg = 0; seg < NUM_SEGMENTS; seg++) {
+    int start = seg * LEDS_PER_SEGMENT;
+    int count = LEDS_PER_SEGMENT;
+    if (seg == COLON_INDEX) {
+      start = 7 * 2 * LEDS_PER_SEGMENT; // Colon sits between digits 1 and 2
+      count = COLON_LEDS;
+    } else if (seg >= 7 * 2) {
+      start += COLON_LEDS; // Skip the colon LEDs
+    }
+
+    uint16_t r = 0, g = 0, b = 0;
+    for (int i = start; i < start + count; i++) {
+      r += pixels[i].r;
+      g += pixels[i].g;
+      b += pixels[i].b;
+    }
+    rgb[seg * 3] = r / count;
+    rgb[seg * 3 + 1] = g / count;
+    rgb[seg * 3 + 2] = b / count;
+  }
+}
+
+// ============================================================================
+// Per-Client Pacing
+// ============================================================================
+// Every client gets its own send rate and queue budget, so a slow phone on
+// the captive portal never makes the AsyncWebSocket queue grow.
+//
+// A message leaves a client's queue once TCP acked it. The time from the
+// first unacked send until the queue is empty again is the client's ack
+// latency. A client whose queue reaches PREVIEW_QUEUE_BUDGET or whose acks
+// take longer than its interval halves its rate (down to 2 fps), a drained
+// fast client speeds up again step by step (up to 20 fps).
+//
+// A client only gets the shared delta while it has every message since its
+// last keyframe. A frame it skips (rate) or cannot take (full queue) is
+// dropped, and its next message is a keyframe of the newest frame instead,
+// so stale frames never pile up behind a slow link.
+// ============================================================================
+#define PREVIEW_QUEUE_BUDGET 3       // Unacked messages per client
+#define PREVIEW_MIN_INTERVAL_MS 50   // 20 fps
+#define PREVIEW_MAX_INTERVAL_MS 500  // 2 fps
+#define PREVIEW_MAX_CLIENTS 8        // Per endpoint (AsyncWebSocket default)
+
+enum PreviewAction : uint8_t {
+  PREVIEW_SKIP,
+  PREVIEW_SEND_DELTA,
+  PREVIEW_SEND_KEYFRAME,
+};
+
+struct PreviewClientState {
+  uint32_t id; // AsyncWebSocketClient id, 0 = free slot
+  uint32_t lastSendMs;
+  uint32_t waitingSinceMs; // First send the queue has not drained since
+  uint16_t intervalMs;     // Current send interval
+  uint16_t ackMs;          // Smoothed ack latency
+  uint8_t queueDepth;      // At the last sample
+  uint8_t maxQueueDepth;
+  bool waiting; // Messages are queued
+  bool inSync;  // Has every message since its last keyframe
+  bool seen;    // Still connected (this sample)
+  uint32_t sent;
+  uint32_t keyframes;
+  uint32_t skipped; // Frames dropped by the rate
+  uint32_t dropped; // Frames dropped by the queue budget
+  uint32_t bytes;
+};
+
+// The state of a client, a fresh one for a new id (nullptr if all are taken)
+inline PreviewClientState *previewClient(PreviewClientState *clients,
+                                         uint32_t id) {
+  PreviewClientState *free = nullptr;
+  for (uint8_t i = 0; i < PREVIEW_MAX_CLIENTS; i++) {
+    if (clients[i].id == id) {
+      clients[i].seen = true;
+      return &clients[i];
+    }
+    if (!free && clients[i].id == 0) {
+      free = &clients[i];
+    }
+  }
+  if (free) {
+    memset(free, 0, sizeof(*free));
+    free->id = id;
+    free->intervalMs = PREVIEW_MIN_INTERVAL_MS;
+    free->seen = true;
+  }
+  return free;
+}
+
+// Free the states of clients that were not seen since the last call
+inline void releasePreviewClients(PreviewClientState *clients) {
+  for (uint8_t i = 0; i < PREVIEW_MAX_CLIENTS; i++) {
+    if (!clients[i].seen) {
+      clients[i].id = 0;
+    }
+    clients[i].seen = false;
+  }
+}
+
+// Mark every client for a keyframe
+inline void resyncPreviewClients(PreviewClientState *clients) {
+  for (uint8_t i = 0; i < PREVIEW_MAX_CLIENTS; i++) {
+    clients[i].inSync = false;
+  }
+}
+
+// Per sample and client: adapt the rate to the queue, then decide what the
+// client gets. hasDelta: the frame changed this sample.
+inline PreviewAction pacePreviewClient(PreviewClientState &client,
+                                       uint8_t queueDepth, uint32_t now,
+                                       bool hasDelta) {
+  client.queueDepth = queueDepth;
+  if (queueDepth > client.maxQueueDepth) {
+    client.maxQueueDepth = queueDepth;
+  }
+  if (client.waiting && queueDepth == 0) {
+    client.ackMs = (3 * client.ackMs + (now - client.waitingSinceMs)) / 4;
+    client.waiting = false;
+  }
+  uint32_t pendingMs = client.waiting ? now - client.waitingSinceMs : 0;
+
+  if (queueDepth >= PREVIEW_QUEUE_BUDGET || pendingMs > client.intervalMs ||
+      client.ackMs > client.intervalMs) {
+    client.intervalMs = min((uint16_t)(client.intervalMs * 2),
+                            (uint16_t)PREVIEW_MAX_INTERVAL_MS);
+  } else if (queueDepth == 0 && client.ackMs < client.intervalMs / 2) {
+    client.intervalMs =
+        max((uint16_t)(client.intervalMs - client.intervalMs / 8),
+            (uint16_t)PREVIEW_MIN_INTERVAL_MS);
+  }
+
+  if (client.inSync && !hasDelta) {
+    return PREVIEW_SKIP; // Nothing new
+  }
+  if (now - client.lastSendMs < client.intervalMs) {
+    client.skipped += hasDelta;
+    client.inSync = false;
+    return PREVIEW_SKIP;
+  }
+  if (queueDepth >= PREVIEW_QUEUE_BUDGET) {
+    client.dropped += hasDelta;
+    client.inSync = false;
+    return PREVIEW_SKIP;
+  }
+
+  client.lastSendMs = now;
+  client.sent++;
+  if (!client.waiting) {
+    client.waiting = true;
+    client.waitingSinceMs = now;
+  }
+  if (client.inSync) {
+    return PREVIEW_SEND_DELTA;
+  }
+  client.inSync = true;
+  client.keyframes++;
+  return PREVIEW_SEND_KEYFRAME;
+}
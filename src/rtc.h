@@ -2,12 +2,17 @@
 #include <Arduino.h>
 #include <RTClib.h>
 #include <Wire.h>
-#include <time.h>
+#include <esp_timer.h>
+
+#include <atomic>
+
+#include "scheduler.h"
 
 // RTC Module (DS1307)
 extern RTC_DS1307 rtc;
 extern bool rtcInitialized;
 extern bool usingInternalTime;
+extern Scheduler scheduler;
 
 // I2C Pins for ESP32-C3
 #define I2C_SDA 4
@@ -18,14 +23,121 @@ void setRTCTime(int hours, int minutes, int seconds, int day, int month,
                 int year);
 DateTime getCurrentTime();
 
+// ============================================================================
+// Time Service
+// ============================================================================
+// The DS1307 is read once at boot and then every RTC_RESYNC_MS. In between,
+// time is interpolated from esp_timer, so getCurrentTime() never touches the
+// I2C bus. Without an RTC the same base is set from the web interface and
+// never resynced.
+//
+// The RTC only reports whole seconds, so the base is placed in the middle of
+// the second it was read in (error within ±0.5 s plus drift). A resync only
+// rebases when the RTC and the interpolation disagree on the second. Served
+// time never goes backwards: after a backward correction the current second
+// is held until the new base catches up. Only setRTCTime() may jump back.
+//
+// updateTime() runs once per rendered frame and raises the minute/hour
+// changed events for that frame. Setting the time does not raise them.
+//
+// The service belongs to the loop task: currentUnixTime() and
+// getCurrentTime() update the served time and read the 64-bit base, so other
+// tasks must not call them. updateTime() and setTimeBase() publish the
+// served seconds in publishedUnix, and the web handlers build their time
+// from that (getPublishedTime()).
+// ============================================================================
+#define RTC_RESYNC_MS (10UL * 60 * 1000) // DS1307 read interval
+
+struct TimeService {
+  uint32_t baseUnix;      // Unix time at baseMicros
+  int64_t baseMicros;     // esp_timer time of baseUnix
+  int64_t nextSyncMicros; // Next DS1307 read
+  uint32_t servedUnix;    // Last time handed out (never decreases)
+  DateTime served;        // Calendar form of servedUnix
+  uint32_t eventMinute;   // servedUnix / 60 at the last updateTime()
+  uint32_t eventHour;
+  bool minuteChanged;     // Events for the current frame
+  bool hourChanged;
+  uint32_t syncs;         // DS1307 reads since boot
+  int32_t lastCorrection; // RTC minus interpolation at the last resync, in s
+};
+
 // Global variable definitions
 RTC_DS1307 rtc;
 bool rtcInitialized = false;
 bool usingInternalTime = false;
+TimeService timeService;
+std::atomic<uint32_t> publishedUnix(0); // servedUnix, for other tasks
+
+// Start serving unixTime from now on, allowing a jump in either direction
+inline void setTimeBase(uint32_t unixTime, int64_t baseMicros) {
+  timeService.baseUnix = unixTime;
+  timeService.baseMicros = baseMicros;
+  timeService.servedUnix = unixTime;
+  timeService.served = DateTime(unixTime);
+  timeService.eventMinute = unixTime / 60;
+  timeService.eventHour = unixTime / 3600;
+  publishedUnix.store(unixTime, std::memory_order_release);
+  scheduler.clockChanged(); // Re-place wall-clock timers
+}
+
+// Read the DS1307 and correct the interpolated time if it disagrees
+inline void syncTimeFromRTC() {
+  int64_t nowMicros = esp_timer_get_time();
+  uint32_t rtcUnix = rtc.now().unixtime();
+  timeService.syncs++;
+  timeService.nextSyncMicros = nowMicros + (int64_t)RTC_RESYNC_MS * 1000;
+
+  uint32_t interpolated =
+      timeService.baseUnix +
+      (uint32_t)((nowMicros - timeService.baseMicros) / 1000000);
+  timeService.lastCorrection = (int32_t)(rtcUnix - interpolated);
+  if (timeService.lastCorrection != 0) {
+    timeService.baseUnix = rtcUnix;
+    timeService.baseMicros = nowMicros - 500000; // Mid-second
+    scheduler.clockChanged();
+  }
+}
+
+// Current unix time, interpolated and monotonic (loop task only)
+inline uint32_t currentUnixTime() {
+  int64_t elapsed = esp_timer_get_time() - timeService.baseMicros;
+  uint32_t unixTime = timeService.baseUnix + (uint32_t)(elapsed / 1000000);
+  if ((int32_t)(unixTime - timeService.servedUnix) > 0) {
+    timeService.servedUnix = unixTime;
+    timeService.served = DateTime(unixTime);
+  }
+  return timeService.servedUnix;
+}
 
-// Internal time tracking (fallback when RTC not connected)
-static time_t internalTimeOffset = 0;
-static unsigned long internalTimeSetMillis = 0;
+// Resync if due and raise this frame's minute/hour events
+inline void updateTime() {
+  if (rtcInitialized && esp_timer_get_time() >= timeService.nextSyncMicros) {
+    syncTimeFromRTC();
+  }
+  uint32_t unixTime = currentUnixTime();
+  uint32_t minute = unixTime / 60;
+  uint32_t hour = minute / 60;
+  timeService.minuteChanged = (minute != timeService.eventMinute);
+  timeService.hourChanged = (hour != timeService.eventHour);
+  timeService.eventMinute = minute;
+  timeService.eventHour = hour;
+  publishedUnix.store(unixTime, std::memory_order_release);
+}
+
+// The time as of the last frame, safe from any task (no I2C, no writes)
+inline DateTime getPublishedTime() {
+  return DateTime(publishedUnix.load(std::memory_order_acquire));
+}
+
+// esp_timer time at which the served time reaches unixTime
+inline int64_t unixToTimerMicros(uint32_t unixTime) {
+  return timeService.baseMicros +
+         (int64_t)(int32_t)(unixTime - timeService.baseUnix) * 1000000;
+}
+
+inline bool minuteChanged() { return timeService.minuteChanged; }
+inline bool hourChanged() { return timeService.hourChanged; }
 
 void setupRTC() {
   Serial.println("=== RTC Setup ===");
@@ -42,15 +154,8 @@ void setupRTC() {
     usingInternalTime = true;
 
     // Set internal time to a default (Jan 1, 2025, 00:00:00)
-    struct tm defaultTime = {0};
-    defaultTime.tm_year = 2025 - 1900; // Years since 1900
-    defaultTime.tm_mon = 0;            // January (0-11)
-    defaultTime.tm_mday = 1;
-    defaultTime.tm_hour = 0;
-    defaultTime.tm_min = 0;
-    defaultTime.tm_sec = 0;
-    internalTimeOffset = mktime(&defaultTime);
-    internalTimeSetMillis = millis();
+    setTimeBase(DateTime(2025, 1, 1, 0, 0, 0).unixtime(),
+                esp_timer_get_time());
 
     timeWasSet = false;
     Serial.println("  -> Set time via web interface: /settings");
@@ -62,6 +167,12 @@ void setupRTC() {
   usingInternalTime = false;
   Serial.println("  RTC connected successfully");
 
+  // Single boot read, later reads only resync (see updateTime)
+  setTimeBase(rtc.now().unixtime(), esp_timer_get_time() - 500000);
+  timeService.syncs = 1;
+  timeService.nextSyncMicros =
+      esp_timer_get_time() + (int64_t)RTC_RESYNC_MS * 1000;
+
   // Check if RTC is running
   if (!rtc.isrunning()) {
     Serial.println("  WARNING: RTC has no valid time set");
@@ -70,7 +181,7 @@ void setupRTC() {
   } else {
     // RTC has valid time
     timeWasSet = true;
-    DateTime now = rtc.now();
+    DateTime now = timeService.served;
     Serial.printf("  Current time: %02d:%02d:%02d\n", now.hour(), now.minute(),
                   now.second());
     Serial.printf("  Current date: %04d-%02d-%02d\n", now.year(), now.month(),
@@ -79,46 +190,30 @@ void setupRTC() {
   Serial.println("=================\n");
 }
 
-// Get current time from RTC or internal fallback
+// Get current time from the time service (no I2C access, loop task only)
 DateTime getCurrentTime() {
-  if (rtcInitialized) {
-    return rtc.now();
-  }
-
-  // Calculate internal time based on elapsed millis
-  unsigned long elapsedSeconds = (millis() - internalTimeSetMillis) / 1000;
-  time_t currentTime = internalTimeOffset + elapsedSeconds;
-  struct tm *timeinfo = localtime(&currentTime);
-
-  return DateTime(timeinfo->tm_year + 1900, timeinfo->tm_mon + 1,
-                  timeinfo->tm_mday, timeinfo->tm_hour, timeinfo->tm_min,
-                  timeinfo->tm_sec);
+  currentUnixTime();
+  return timeService.served;
 }
 
 // Set time on RTC or internal fallback
 void setRTCTime(int hours, int minutes, int seconds, int day, int month,
                 int year) {
+  DateTime newTime(year, month, day, hours, minutes, seconds);
   if (rtcInitialized) {
     // Set time on external RTC
-    rtc.adjust(DateTime(year, month, day, hours, minutes, seconds));
+    rtc.adjust(newTime);
     Serial.printf("RTC Time set to: %04d-%02d-%02d %02d:%02d:%02d\n", year,
                   month, day, hours, minutes, seconds);
   } else {
-    // Set internal time (fallback)
-    struct tm newTime = {0};
-    newTime.tm_year = year - 1900;
-    newTime.tm_mon = month - 1; // 0-11
-    newTime.tm_mday = day;
-    newTime.tm_hour = hours;
-    newTime.tm_min = minutes;
-    newTime.tm_sec = seconds;
-    internalTimeOffset = mktime(&newTime);
-    internalTimeSetMillis = millis();
-
     Serial.printf("Internal Time set to: %04d-%02d-%02d %02d:%02d:%02d\n", year,
                   month, day, hours, minutes, seconds);
     Serial.println("  (Note: Time will be lost on power cycle)");
   }
 
+  // The chip's seconds restart on adjust(), so the new base is exact
+  setTimeBase(newTime.unixtime(), esp_timer_get_time());
+  timeService.nextSyncMicros =
+      esp_timer_get_time() + (int64_t)RTC_RESYNC_MS * 1000;
   timeWasSet = true;
 }
@@ -0,0 +1,159 @@
+#pragma once
+#include <Arduino.h>
+
+#include "settings.h"
+
+// ============================================================================
+// Compiled Weekly Schedule
+// ============================================================================
+// The active hours are compiled into one bit per minute of the week
+// (7 × 1440 = 10080 bits, minute 0 = Sunday 00:00), so "is the display on"
+// is a single bit test and the next on/off edge is a word-wise scan.
+//
+// A day's span runs from its start to its end time. If the end is earlier
+// than the start, the span continues into the next weekday (e.g. Fri 22:00
+// to Sat 02:00). Equal start and end means the day is empty.
+//
+// compileSchedule() builds into the spare bitmap and then publishes it with a
+// single pointer store, so the render loop never sees a half-built week.
+// publishSettings() calls it whenever days / useActiveHours change.
+// ============================================================================
+const uint16_t MINUTES_PER_DAY = 24 * 60;
+const uint16_t MINUTES_PER_WEEK = 7 * MINUTES_PER_DAY;
+const uint16_t SCHEDULE_WORDS = MINUTES_PER_WEEK / 32;
+static_assert(MINUTES_PER_WEEK % 32 == 0, "week must fill whole words");
+
+// nextScheduleTransition() result when the schedule never changes state
+const uint16_t SCHEDULE_NO_TRANSITION = 0xFFFF;
+
+struct ScheduleBitmap {
+  uint32_t bits[SCHEDULE_WORDS];
+  uint32_t generation; // Incremented by every compile
+};
+
+ScheduleBitmap scheduleBitmaps[2];
+ScheduleBitmap *volatile activeSchedule = &scheduleBitmaps[0];
+
+// Minute of the week for a unix time (Jan 1 1970 was a Thursday)
+inline uint16_t minuteOfWeek(uint32_t unixTime) {
+  return (unixTime / 60 + 4UL * MINUTES_PER_DAY) % MINUTES_PER_WEEK;
+}
+
+inline bool isScheduleActive(const ScheduleBitmap &schedule, uint16_t minute) {
+  return (schedule.bits[minute >> 5] >> (minute & 31)) & 1;
+}
+
+// Set minutes [from, from + count) with wrap-around at the end of the week
+inline void setScheduleRange(uint32_t *bits, uint16_t from, uint16_t count) {
+  for (uint16_t i = 0; i < count; i++) {
+    uint16_t minute = (from + i) % MINUTES_PER_WEEK;
+    bits[minute >> 5] |= 1UL << (minute & 31);
+  }
+}
+
+// Minute of the day, clamping out-of-range values from the web interface
+inline uint16_t scheduleMinute(uint8_t hour, uint8_t minute) {
+  return (hour < 24 ? hour : 23) * 60 + (minute < 60 ? minute : 59);
+}
+
+inline void compileSchedule() {
+  ScheduleBitmap *next = (activeSchedule == &scheduleBitmaps[0])
+                             ? &scheduleBitmaps[1]
+                             : &scheduleBitmaps[0];
+  const ClockSettings &settings = currentSettings()->clock;
+  uint16_t activeMinutes = MINUTES_PER_WEEK;
+
+  if (!settings.useActiveHours) {
+    memset(next->bits, 0xFF, sizeof(next->bits)); // Always active
+  } else {
+    memset(next->bits, 0, sizeof(next->bits));
+    activeMinutes = 0;
+    for (int d = 0; d < 7; d++) {
+      const DaySchedule &day = settings.days[d];
+      if (!day.enabled) {
+        continue;
+      }
+      uint16_t start = scheduleMinute(day.startHour, day.startMinute);
+      uint16_t end = scheduleMinute(day.endHour, day.endMinute);
+      uint16_t length =
+          (end >= start) ? end - start : MINUTES_PER_DAY - start + end;
+      setScheduleRange(next->bits, d * MINUTES_PER_DAY + start, length);
+      activeMinutes += length; // Overlaps are counted twice, log only
+    }
+  }
+
+  next->generation = activeSchedule->generation + 1;
+  activeSchedule = next;
+  Serial.printf("[SCHEDULE] Compiled: %u of %u minutes active\n",
+                activeMinutes, MINUTES_PER_WEEK);
+}
+
+// Minutes from `minute` until the schedule changes state
+inline uint16_t nextScheduleTransition(const ScheduleBitmap &schedule,
+                                       uint16_t minute) {
+  uint32_t invert = isScheduleActive(schedule, minute) ? 0xFFFFFFFF : 0;
+
+  // Walk the week once, a word at a time, starting right after `minute`
+  uint16_t pos = (minute + 1) % MINUTES_PER_WEEK;
+  for (uint16_t scanned = 0; scanned < MINUTES_PER_WEEK;) {
+    uint16_t bit = pos & 31;
+    uint32_t changed = (schedule.bits[pos >> 5] ^ invert) >> bit;
+    if (changed) {
+      return scanned + __builtin_ctz(changed) + 1;
+    }
+    scanned += 32 - bit;
+    pos = (pos + 32 - bit) % MINUTES_PER_WEEK;
+  }
+  return SCHEDULE_NO_TRANSITION;
+}
+
+// ============================================================================
+// Display Schedule Check
+// ============================================================================
+// The result is cached together with the unix time of the next edge, so the
+// mode machine only looks at the bitmap again when an edge is reached, the
+// schedule is recompiled or the clock is set backwards.
+struct ScheduleWatch {
+  uint32_t generation; // Bitmap the cache was built from
+  uint32_t fromUnix;   // State holds for [fromUnix, untilUnix)
+  uint32_t untilUnix;
+  bool active;
+  bool valid;
+};
+
+ScheduleWatch scheduleWatch = {0, 0, 0, false, false};
+
+const char *const SCHEDULE_DAY_NAMES[] = {"Sun", "Mon", "Tue", "Wed",
+                                          "Thu", "Fri", "Sat"};
+
+// Check if display should be active at unixTime (local time)
+inline bool isDisplayActiveTime(uint32_t unixTime) {
+  ScheduleWatch &w = scheduleWatch;
+  const ScheduleBitmap &schedule = *activeSchedule;
+  if (w.valid && w.generation == schedule.generation &&
+      unixTime >= w.fromUnix && unixTime < w.untilUnix) {
+    return w.active;
+  }
+
+  uint16_t minute = minuteOfWeek(unixTime);
+  uint16_t untilEdge = nextScheduleTransition(schedule, minute);
+  w.generation = schedule.generation;
+  w.active = isScheduleActive(schedule, minute);
+  w.fromUnix = unixTime;
+  w.untilUnix = (untilEdge == SCHEDULE_NO_TRANSITION)
+                    ? 0xFFFFFFFF
+                    : unixTime - unixTime % 60 + untilEdge * 60UL;
+  w.valid = true;
+
+  if (untilEdge == SCHEDULE_NO_TRANSITION) {
+    Serial.printf("[SCHEDULE] Display %s, no transitions\n",
+                  w.active ? "on" : "off");
+  } else {
+    uint16_t edge = (minute + untilEdge) % MINUTES_PER_WEEK;
+    Serial.printf("[SCHEDULE] Display %s until %s %02u:%02u\n",
+                  w.active ? "on" : "off",
+                  SCHEDULE_DAY_NAMES[edge / MINUTES_PER_DAY],
+                  (edge % MINUTES_PER_DAY) / 60, edge % 60);
+  }
+  return w.active;
+}
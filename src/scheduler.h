@@ -0,0 +1,318 @@
+#pragma once
+#include <Arduino.h>
+#include <esp_timer.h>
+
+// Wall-clock conversion from rtc.h
+uint32_t currentUnixTime();
+int64_t unixToTimerMicros(uint32_t unixTime);
+
+// ============================================================================
+// Timer Wheel Scheduler
+// ============================================================================
+// One-shot timers on a hierarchical timing wheel: 6 levels of 64 slots, with
+// 1 ms ticks at level 0 and 64× coarser ticks per level above, covering
+// 2^36 ms (~2 years). A timer sits in the level where its deadline first
+// differs from the wheel's position and cascades down as the wheel reaches
+// its block, so insert and cancel are O(1). update() jumps straight to the
+// next occupied slot using per-level occupancy masks, so a tick costs
+// O(levels + expired) no matter how long the loop stalled.
+//
+// Wheel time is millis() extended to 64 bits, so deadlines survive the
+// 49-day millis() wraparound.
+//
+// Deadlines are monotonic (after) or wall-clock (atUnix). Wall-clock timers
+// are placed at the monotonic time the time service predicts for them, are
+// re-placed by clockChanged() when the clock is set or corrected, and only
+// fire once currentUnixTime() has reached their deadline.
+//
+// Timers live in a fixed pool. Handles carry a generation, so cancelling a
+// handle whose timer already fired (and whose slot was reused) is a no-op.
+// ============================================================================
+#define SCHEDULER_TIMERS 8
+#define WHEEL_LEVELS 6
+#define WHEEL_SLOTS 64
+#define WHEEL_BITS 6
+#define WHEEL_NONE 0xFF
+
+typedef void (*TimerCallback)();
+
+struct TimerHandle {
+  uint8_t index;
+  uint8_t generation;
+};
+
+const TimerHandle NO_TIMER = {WHEEL_NONE, 0};
+
+class Scheduler {
+public:
+  Scheduler() {
+    memset(heads, WHEEL_NONE, sizeof(heads));
+    memset(masks, 0, sizeof(masks));
+    for (uint8_t i = 0; i < SCHEDULER_TIMERS; i++) {
+      nodes[i].active = false;
+      nodes[i].generation = 0;
+      nodes[i].next = (i + 1 < SCHEDULER_TIMERS) ? i + 1 : WHEEL_NONE;
+    }
+    freeList = 0;
+    expiring = WHEEL_NONE;
+    lastMillis = millis();
+    extended = lastMillis;
+    tick = extended;
+  }
+
+  // Call callback once, delayMs from now
+  TimerHandle after(uint32_t delayMs, TimerCallback callback) {
+    uint8_t i = allocate(callback);
+    if (i == WHEEL_NONE) {
+      return NO_TIMER;
+    }
+    nodes[i].deadline = now() + delayMs;
+    place(i);
+    return handleFor(i);
+  }
+
+  // Call callback once the wall clock reaches unixTime
+  TimerHandle atUnix(uint32_t unixTime, TimerCallback callback) {
+    uint8_t i = allocate(callback);
+    if (i == WHEEL_NONE) {
+      return NO_TIMER;
+    }
+    nodes[i].wallClock = true;
+    nodes[i].unixDeadline = unixTime;
+    nodes[i].deadline = predictWallClock(unixTime);
+    place(i);
+    return handleFor(i);
+  }
+
+  // Stop a timer and clear the handle (stale handles are ignored)
+  void cancel(TimerHandle &handle) {
+    if (pending(handle)) {
+      unlink(handle.index);
+      release(handle.index);
+    }
+    handle = NO_TIMER;
+  }
+
+  bool pending(TimerHandle handle) const {
+    return handle.index < SCHEDULER_TIMERS &&
+           nodes[handle.index].active &&
+           nodes[handle.index].generation == handle.generation;
+  }
+
+  // Re-place wall-clock timers after the time service base changed
+  void clockChanged() {
+    for (uint8_t i = 0; i < SCHEDULER_TIMERS; i++) {
+      if (nodes[i].active && nodes[i].wallClock) {
+        unlink(i);
+        nodes[i].deadline = predictWallClock(nodes[i].unixDeadline);
+        place(i);
+      }
+    }
+  }
+
+  // Advance the wheel to millis() and run expired callbacks
+  void update() {
+    uint64_t target = now();
+    while (tick < target) {
+      uint64_t stop = nextStop();
+      if (stop > target) {
+        tick = target;
+        break;
+      }
+      tick = stop;
+      for (int level = WHEEL_LEVELS - 1; level > 0; level--) {
+        if ((tick & ((1ULL << (level * WHEEL_BITS)) - 1)) == 0) {
+          cascade(level);
+        }
+      }
+      expire();
+    }
+  }
+
+  uint8_t activeCount() const {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < SCHEDULER_TIMERS; i++) {
+      count += nodes[i].active;
+    }
+    return count;
+  }
+
+private:
+  struct Node {
+    uint64_t deadline;     // Wheel tick (extended millis)
+    uint32_t unixDeadline; // Wall-clock timers only
+    TimerCallback callback;
+    uint8_t prev, next; // Slot list (next doubles as free list link)
+    uint8_t level, slot;
+    uint8_t generation;
+    bool wallClock;
+    bool active;
+  };
+
+  Node nodes[SCHEDULER_TIMERS];
+  uint8_t heads[WHEEL_LEVELS][WHEEL_SLOTS];
+  uint64_t masks[WHEEL_LEVELS]; // Occupied slots per level
+  uint8_t freeList;
+  uint8_t expiring;    // Timers of the slot being expired
+  uint32_t lastMillis; // millis() at the last now()
+  uint64_t extended;   // millis() extended to 64 bits
+  uint64_t tick;       // Last processed wheel tick
+
+  uint64_t now() {
+    uint32_t ms = millis();
+    extended += (uint32_t)(ms - lastMillis); // Wrap-safe delta
+    lastMillis = ms;
+    return extended;
+  }
+
+  TimerHandle handleFor(uint8_t i) const {
+    TimerHandle h = {i, nodes[i].generation};
+    return h;
+  }
+
+  uint8_t allocate(TimerCallback callback) {
+    uint8_t i = freeList;
+    if (i == WHEEL_NONE) {
+      Serial.println("[SCHEDULER] ERROR: out of timers");
+      return WHEEL_NONE;
+    }
+    freeList = nodes[i].next;
+    nodes[i].active = true;
+    nodes[i].wallClock = false;
+    nodes[i].callback = callback;
+    return i;
+  }
+
+  void release(uint8_t i) {
+    nodes[i].active = false;
+    nodes[i].generation++;
+    nodes[i].next = freeList;
+    freeList = i;
+  }
+
+  uint64_t predictWallClock(uint32_t unixTime) {
+    int64_t micros = unixToTimerMicros(unixTime) - esp_timer_get_time();
+    return now() + (micros > 0 ? (micros + 999) / 1000 : 0);
+  }
+
+  // Put a node into the level/slot for its deadline, relative to tick + 1
+  void place(uint8_t i) {
+    Node &n = nodes[i];
+    uint64_t ref = tick + 1;
+    const uint64_t maxDelay = 1ULL << (WHEEL_LEVELS * WHEEL_BITS - 1);
+    if (n.deadline < ref) {
+      n.deadline = ref; // Overdue: next tick
+    } else if (n.deadline - ref > maxDelay) {
+      n.deadline = ref + maxDelay;
+    }
+    uint64_t diff = n.deadline ^ ref;
+    uint8_t level = 0;
+    while (level < WHEEL_LEVELS - 1 &&
+           (diff >> ((level + 1) * WHEEL_BITS)) != 0) {
+      level++;
+    }
+    n.level = level;
+    n.slot = (n.deadline >> (level * WHEEL_BITS)) & (WHEEL_SLOTS - 1);
+    n.prev = WHEEL_NONE;
+    n.next = heads[level][n.slot];
+    if (n.next != WHEEL_NONE) {
+      nodes[n.next].prev = i;
+    }
+    heads[level][n.slot] = i;
+    masks[level] |= 1ULL << n.slot;
+  }
+
+  // level == WHEEL_LEVELS marks a node on the expiring list
+  void unlink(uint8_t i) {
+    Node &n = nodes[i];
+    uint8_t &head =
+        (n.level == WHEEL_LEVELS) ? expiring : heads[n.level][n.slot];
+    if (n.prev != WHEEL_NONE) {
+      nodes[n.prev].next = n.next;
+    } else {
+      head = n.next;
+    }
+    if (n.next != WHEEL_NONE) {
+      nodes[n.next].prev = n.prev;
+    }
+    if (n.level < WHEEL_LEVELS && head == WHEEL_NONE) {
+      masks[n.level] &= ~(1ULL << n.slot);
+    }
+  }
+
+  // First occupied slot at or after index in a level mask, or -1
+  static int firstSlot(uint64_t mask, uint8_t index) {
+    if (index >= WHEEL_SLOTS) {
+      return -1;
+    }
+    uint64_t from = mask >> index;
+    return from ? index + __builtin_ctzll(from) : -1;
+  }
+
+  // Earliest tick after `tick` with a slot to expire or cascade. A level's
+  // slot is reached at the start of its block, so for the block containing
+  // tick + 1 it only counts when tick + 1 is exactly that start.
+  uint64_t nextStop() const {
+    uint64_t from = tick + 1;
+    for (int level = 0; level < WHEEL_LEVELS; level++) {
+      int shift = level * WHEEL_BITS;
+      uint8_t index = (from >> shift) & (WHEEL_SLOTS - 1);
+      bool atStart = (from & ((1ULL << shift) - 1)) == 0;
+      int slot = firstSlot(masks[level], atStart ? index : index + 1);
+      if (slot >= 0) {
+        uint64_t block = from >> (shift + WHEEL_BITS);
+        return ((block << WHEEL_BITS) + slot) << shift;
+      }
+      // Nothing left in this block, the next candidate is the next block
+    }
+    int top = WHEEL_LEVELS * WHEEL_BITS;
+    return ((from >> top) + 1) << top;
+  }
+
+  // The wheel reached this level's current slot: move its timers down
+  void cascade(int level) {
+    uint8_t slot = (tick >> (level * WHEEL_BITS)) & (WHEEL_SLOTS - 1);
+    uint8_t i = heads[level][slot];
+    heads[level][slot] = WHEEL_NONE;
+    masks[level] &= ~(1ULL << slot);
+    uint64_t saved = tick;
+    tick--; // place() is relative to tick + 1
+    while (i != WHEEL_NONE) {
+      uint8_t next = nodes[i].next;
+      place(i);
+      i = next;
+    }
+    tick = saved;
+  }
+
+  // Run the timers of the level-0 slot for the current tick. The slot is
+  // moved to the expiring list first, so timers scheduled by the callbacks
+  // can never land in the list being run.
+  void expire() {
+    uint8_t slot = tick & (WHEEL_SLOTS - 1);
+    expiring = heads[0][slot];
+    heads[0][slot] = WHEEL_NONE;
+    masks[0] &= ~(1ULL << slot);
+    for (uint8_t i = expiring; i != WHEEL_NONE; i = nodes[i].next) {
+      nodes[i].level = WHEEL_LEVELS;
+    }
+
+    while (expiring != WHEEL_NONE) {
+      uint8_t i = expiring;
+      unlink(i);
+      Node &n = nodes[i];
+      // The clock may have been slower than predicted
+      if (n.wallClock && (int32_t)(currentUnixTime() - n.unixDeadline) < 0) {
+        n.deadline = predictWallClock(n.unixDeadline);
+        if (n.deadline <= tick) {
+          n.deadline = tick + 1000; // Same second: look again in 1 s
+        }
+        place(i);
+        continue;
+      }
+      TimerCallback callback = n.callback;
+      release(i); // Callbacks may schedule again
+      callback();
+    }
+  }
+};
@@ -6,100 +6,201 @@
 #include <Arduino.h>
 #include <FastLED.h>
 #include <math.h>
+
+#include "apa102.h"
+#include "frame.h"
+#include "gradient.h"
 using namespace std;
 
 enum SegmentMode {
   RANDOM,
   COLOR,
+  TWEEN, // Following keyframes (tweenTo)
+};
+
+// ============================================================================
+// Tween Tracks
+// ============================================================================
+// A keyframe says where a segment goes next and how long it takes to get
+// there. tweenTo() starts a linear blend from what the segment shows to the
+// keyframe's colour, with its speed precomputed from the duration; each frame
+// only advances the blend. Issuing the keyframe the track is already heading
+// to changes nothing, so a caller can issue keyframes whenever it likes and
+// only real changes start a new blend.
+// ============================================================================
+struct Keyframe {
+  CRGB color;          // Dimmed by opacity, like fillColor()
+  uint8_t opacity;     // Segment opacity from now on
+  uint16_t durationMs; // Time to reach the colour
 };
 
+// The Q8.8 speed (blend units per 1/60 s) that finishes a blend in
+// durationMs
+inline uint16_t tweenRateFor(uint16_t durationMs) {
+  const uint32_t fullBlend = 255UL * 256 * 1000 / BLEND_REFERENCE_FPS;
+  uint32_t rate = fullBlend / (durationMs > 0 ? durationMs : 1);
+  return rate > 0xFFFF ? 0xFFFF : (rate > 0 ? rate : 1);
+}
+
+// A lightweight view of one segment's slice of the frame arena. Copying a
+// Segment copies the view, never the pixel buffers.
 class Segment {
 private:
   bool initialized = false;
-  int segStart;
-  int segLength;
-  CRGB *leds;
-  CRGB *current;
-  CRGB *target;
-  int blendAmount = 0;
-  unsigned long nextMillis = millis();
+  uint8_t id = 0;
+  int segStart = 0;
+  int segLength = 0;
+  CRGB *leds = nullptr;
+  CRGB *current = nullptr;
+  CRGB *target = nullptr;
 
 public:
-  int speed = 255;
-  int opacity = 0;
-  int gradientRange = 0;
-  SegmentMode mode = RANDOM;
   Segment() {}
-  Segment(CRGB *leds, int start, int length)
-      : leds(leds), segStart(start), segLength(length) {
+  Segment(CRGB *leds, uint8_t id, int start, int length)
+      : id(id), segStart(start), segLength(length), leds(leds) {
     initialized = true;
-    current = new CRGB[segLength];
-    target = new CRGB[segLength];
+    current = &frameArena.current[segStart];
+    target = &frameArena.target[segStart];
+    frameArena.blendPos[id] = 0;
+    frameArena.speed[id] = 255;
+    frameArena.opacity[id] = 0;
+    frameArena.gradientRange[id] = 0;
+    frameArena.mode[id] = RANDOM;
+    frameArena.nextMillis[id] = millis();
+    markDirty();
   }
 
+  void markDirty() { frameArena.dirtyMask |= 1UL << id; }
+  bool isDirty() const { return frameArena.dirtyMask & (1UL << id); }
+
+  // Per-segment state accessors (backed by the arena)
+  int speed() const { return frameArena.speed[id]; }
+  void setSpeed(int value) { frameArena.speed[id] = value; }
+  int opacity() const { return frameArena.opacity[id]; }
+  void setOpacity(int value) {
+    if (frameArena.opacity[id] != value) {
+      frameArena.opacity[id] = value;
+      markDirty();
+    }
+  }
+  SegmentMode mode() const { return (SegmentMode)frameArena.mode[id]; }
+  void setMode(SegmentMode value) { frameArena.mode[id] = value; }
+
   void fillRandomGradient(CRGB *array, int numToFill) {
-    mode = RANDOM;
-    CHSV hsv_array[numToFill];
+    setMode(RANDOM);
+    int opacity = this->opacity();
+    int gradientRange = frameArena.gradientRange[id];
     int minB = max(0, opacity - gradientRange);
     int maxB = min(opacity + gradientRange, 255);
-    int hueDeviation = sin(2 * PI * millis() / 1000.0);
     int hueMin = (millis() / 7803) % 255;
     int hueMax = (millis() / 1000) % 255;
-    CHSV colorStart = CHSV(random(hueMin, hueMax), 255, random(minB, maxB));
-    CHSV colorMid = CHSV(random(hueMin, hueMax), 255, random(minB, maxB));
-    CHSV colorEnd = CHSV(random(hueMin, hueMax), 255, random(minB, maxB));
-    fill_gradient(hsv_array, 0, colorStart, (numToFill / 2 - 1), colorMid);
-    fill_gradient(hsv_array, numToFill / 2, colorMid, numToFill - 1, colorEnd);
-    for (int i = 0; i < numToFill; i++) {
-      array[i] = hsv_array[i];
-    }
+    GradientStop colorStart = {(uint8_t)random(hueMin, hueMax),
+                               (uint8_t)random(minB, maxB)};
+    GradientStop colorMid = {(uint8_t)random(hueMin, hueMax),
+                             (uint8_t)random(minB, maxB)};
+    GradientStop colorEnd = {(uint8_t)random(hueMin, hueMax),
+                             (uint8_t)random(minB, maxB)};
+    fillGradientRGB(array, 0, colorStart, (numToFill / 2 - 1), colorMid);
+    fillGradientRGB(array, numToFill / 2, colorMid, numToFill - 1, colorEnd);
   }
 
   void newSequence() {
     // Reset Sequence and copy values from live leds
-    blendAmount = 0;
-    nextMillis = millis() + random(10000);
-    for (int i = 0; i < segLength; i++) {
-      current[i] = leds[i + segStart];
-    }
+    frameArena.blendPos[id] = 0;
+    frameArena.nextMillis[id] = millis() + random(10000);
+    markDirty();
+    memcpy(current, &leds[segStart], segLength * sizeof(CRGB));
   }
 
   void fillColor(CRGB color, int newSpeed) {
-    mode = COLOR;
+    color.fadeToBlackBy(255 - opacity());
+    if (mode() == COLOR && frameArena.blendPos[id] >= BLEND_DONE &&
+        isSolid(color)) {
+      return; // Already showing exactly this colour
+    }
+    setMode(COLOR);
     newSequence();
-    speed = newSpeed;
-    color.fadeToBlackBy(255 - opacity);
+    setSpeed(newSpeed);
+    for (int i = 0; i < segLength; i++) {
+      target[i] = color;
+    }
+    if (newSpeed == 255) {
+      memcpy(current, target, segLength * sizeof(CRGB));
+      frameArena.blendPos[id] = BLEND_DONE; // Instant, no blend
+    }
+  }
+
+  // Head for a keyframe (see Tween Tracks)
+  void tweenTo(const Keyframe &key) {
+    CRGB color = key.color;
+    color.fadeToBlackBy(255 - key.opacity);
+    uint16_t rate = tweenRateFor(key.durationMs);
+    if (mode() == TWEEN && frameArena.tweenRate[id] == rate &&
+        opacity() == key.opacity && isSolid(color)) {
+      return; // Same keyframe: keep going
+    }
+    setMode(TWEEN);
+    setOpacity(key.opacity);
+    frameArena.blendPos[id] = 0;
+    frameArena.tweenRate[id] = rate;
+    markDirty();
+    memcpy(current, &leds[segStart], segLength * sizeof(CRGB));
     for (int i = 0; i < segLength; i++) {
       target[i] = color;
-      if (speed == 255) {
-        current[i] = color;
+    }
+  }
+
+  // Back to the random animation, its next gradient a random pause away as
+  // in newSequence(). Segments leaving the same tween track would otherwise
+  // all be due at once.
+  void returnToRandom() {
+    setMode(RANDOM);
+    frameArena.nextMillis[id] = millis() + random(10000);
+  }
+
+  bool isSolid(const CRGB &color) const {
+    for (int i = 0; i < segLength; i++) {
+      if (target[i] != color) {
+        return false;
       }
     }
+    return true;
   }
 
   void animationFinished() {
-    if (mode == RANDOM && nextMillis < millis()) {
+    if (mode() == RANDOM && frameArena.nextMillis[id] < millis()) {
       newSequence();
-      speed = random(MIN_SPEED, MAX_SPEED);
+      setSpeed(random(MIN_SPEED, MAX_SPEED));
       // gradientRange = random(0, 50);
       // opacity = 0;
       if (random8(255) > 200) {
-        opacity = (random8(255) > 120) ? 255 : 0;
+        setOpacity((random8(255) > 120) ? 255 : 0);
       }
       fillRandomGradient(target, segLength);
     }
   }
 
   void drawBlend() {
-    if (blendAmount == 255) {
+    if (frameArena.blendPos[id] >= BLEND_DONE) {
       animationFinished();
     }
+    uint16_t pos = frameArena.blendPos[id];
+    if (pos >= BLEND_DONE && !isDirty()) {
+      return; // Blend finished and nothing re-targeted: output unchanged
+    }
+    markDirty();
+    bool tween = mode() == TWEEN;
+    fract8 curve = tween ? pos >> 8 : quadwave8((pos >> 8) / 2);
+    CRGB *out = &leds[segStart];
     for (int i = 0; i < segLength; i++) {
-      leds[i + segStart] =
-          blend(current[i], target[i], quadwave8(blendAmount / 2));
-      // blend(current[i], target[i], blendAmount);
+      out[i] = blend(current[i], target[i], curve);
+      apa102SetPixel(segStart + i, out[i]);
     }
-    blendAmount = min(255, blendAmount + speed);
+    uint32_t step =
+        tween ? ((uint32_t)frameArena.tweenRate[id] *
+                 min(frameArena.step88, (uint32_t)0xFFFF)) >> 8
+              : (uint32_t)speed() * frameArena.step88;
+    frameArena.blendPos[id] = min(pos + step, (uint32_t)BLEND_DONE);
   }
 
   void draw() {
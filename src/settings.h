@@ -1,6 +1,9 @@
 #pragma once
 #include <Arduino.h>
 #include <Preferences.h>
+#include <stddef.h>
+
+#include <atomic>
 
 // ===== Globale Konstanten =====
 #define AP_SSID "the dreaming clock"
@@ -38,11 +41,13 @@ struct NetworkSettings {
   bool fallbackToCaptive; // Fallback to captive if client fails
 };
 
-// Active hours for a single day
+// Active hours for a single day (an end before the start runs overnight)
 struct DaySchedule {
-  bool enabled;      // Whether the display is active on this day
-  uint8_t startHour; // Start hour (0-23)
-  uint8_t endHour;   // End hour (0-23)
+  bool enabled;        // Whether the display is active on this day
+  uint8_t startHour;   // Start hour (0-23)
+  uint8_t startMinute; // Start minute (0-59)
+  uint8_t endHour;     // End hour (0-23)
+  uint8_t endMinute;   // End minute (0-59)
 };
 
 // Global settings structure
@@ -53,165 +58,433 @@ struct ClockSettings {
   char timezone[40];       // IANA timezone identifier (e.g., "Europe/Vienna")
 };
 
-// Global settings instances
-extern ClockSettings clockSettings;
-extern NetworkSettings networkSettings;
 extern Preferences preferences;
 
-// Initialize settings from NVS
-void setupSettings() {
-  Serial.println("=== Settings Setup ===");
-  Serial.println("  Loading from NVS...");
-  preferences.begin(SETTINGS_NAMESPACE, false);
+// Derived from the settings: schedule.h / modes.h
+void compileSchedule();
+void scheduleAutoWakeup();
+
+// ============================================================================
+// State Version
+// ============================================================================
+// GET /api/state (web.h) returns the settings, the clock and the network
+// status in one document. stateVersion counts changes to any of it except
+// the running clock, and the ETag combines it with the displayed minute, so
+// a client that already has the current state gets a 304.
+//
+// Every writer bumps the version after the change is visible. The handler
+// reads the version before it reads the state, so a body is never older
+// than the ETag it is sent with (at worst newer, which costs one extra 200).
+// ============================================================================
+#define STATE_ETAG_SIZE 24 // "\"<version>-<minute>\"" + null
+
+std::atomic<uint32_t> stateVersion(1);
+
+// Loop task: something /api/state reports has changed
+inline void bumpStateVersion() {
+  stateVersion.fetch_add(1, std::memory_order_release);
+}
+
+// The quoted ETag of a state version at a minute (unix time / 60)
+inline void formatStateEtag(char *out, uint32_t version, uint32_t minute) {
+  snprintf(out, STATE_ETAG_SIZE, "\"%u-%u\"", (unsigned)version,
+           (unsigned)minute);
+}
+
+// ============================================================================
+// Settings Snapshots
+// ============================================================================
+// The settings are only read through immutable snapshots. The loop task is
+// the single writer: editSettings() copies the current snapshot into a spare
+// buffer, the changes go into that draft, and publishSettings() makes it
+// current with one atomic pointer store. Nobody ever sees a half-edited week
+// or a new SSID with the old password.
+//
+// On the loop task currentSettings() is a single pointer load. Other tasks
+// (the web handlers) hold a SettingsReader, which pins the snapshot while
+// they read it. A replaced snapshot is reused for a draft only after the
+// next frame boundary (loop-side pointers never outlive a frame) and once no
+// reader pins it: three buffers cover current, just replaced and draft.
+//
+// publishSettings() recomputes what depends on the settings once per publish,
+// and only what changed: the compiled schedule and the next auto wakeup.
+// ============================================================================
+#define SETTINGS_SNAPSHOTS 3
+
+struct SettingsSnapshot {
+  ClockSettings clock;
+  NetworkSettings network;
+  uint32_t generation;          // Incremented by every publish (0 = none yet)
+  uint32_t retiredFrame;        // Frame in which it was replaced
+  std::atomic<uint8_t> readers; // SettingsReaders holding it
+};
+
+SettingsSnapshot settingsSnapshots[SETTINGS_SNAPSHOTS];
+std::atomic<SettingsSnapshot *> settingsCurrent(&settingsSnapshots[0]);
+SettingsSnapshot *settingsDraft = nullptr; // Open draft (loop task)
+uint32_t settingsFrame = 1;                // Frame boundaries (loop task)
+
+// Loop task: the published settings
+inline const SettingsSnapshot *currentSettings() {
+  return settingsCurrent.load(std::memory_order_relaxed);
+}
+
+// Loop task: call at the start of every frame
+inline void settingsFrameBoundary() { settingsFrame++; }
+
+// Loop task: a draft copy of the current settings (the open one if there is
+// one), nullptr while no buffer is free - try again next frame
+inline SettingsSnapshot *editSettings() {
+  if (settingsDraft) {
+    return settingsDraft;
+  }
+  SettingsSnapshot *current = settingsCurrent.load(std::memory_order_relaxed);
+  for (SettingsSnapshot &buffer : settingsSnapshots) {
+    if (&buffer == current || buffer.retiredFrame == settingsFrame ||
+        buffer.readers.load() != 0) {
+      continue;
+    }
+    buffer.clock = current->clock;
+    buffer.network = current->network;
+    settingsDraft = &buffer;
+    return settingsDraft;
+  }
+  return nullptr;
+}
+
+// Loop task: make the draft current and update what depends on it
+inline void publishSettings() {
+  SettingsSnapshot *draft = settingsDraft;
+  if (!draft) {
+    return;
+  }
+  SettingsSnapshot *old = settingsCurrent.load(std::memory_order_relaxed);
+  bool first = old->generation == 0;
+  draft->generation = old->generation + 1;
+  old->retiredFrame = settingsFrame;
+  settingsDraft = nullptr;
+  settingsCurrent.store(draft);
+  bumpStateVersion();
+
+  if (first || old->clock.useActiveHours != draft->clock.useActiveHours ||
+      memcmp(old->clock.days, draft->clock.days, sizeof(old->clock.days))) {
+    compileSchedule();
+  }
+  if (first || old->clock.wakeupInterval != draft->clock.wakeupInterval) {
+    scheduleAutoWakeup();
+  }
+}
+
+// Other tasks: pins the current snapshot while in scope. The pin is only
+// taken once the snapshot is still current after counting in, so the loop
+// either sees the reader or the reader sees the newer snapshot.
+class SettingsReader {
+public:
+  SettingsReader() {
+    for (;;) {
+      snapshot = settingsCurrent.load();
+      snapshot->readers.fetch_add(1);
+      if (snapshot == settingsCurrent.load()) {
+        return;
+      }
+      snapshot->readers.fetch_sub(1);
+    }
+  }
+  ~SettingsReader() { snapshot->readers.fetch_sub(1); }
+  SettingsReader(const SettingsReader &) = delete;
+  SettingsReader &operator=(const SettingsReader &) = delete;
+
+  const SettingsSnapshot *operator->() const { return snapshot; }
+
+private:
+  SettingsSnapshot *snapshot;
+};
+
+// ============================================================================
+// Settings Blob
+// ============================================================================
+// ClockSettings and NetworkSettings are stored together as one binary blob
+// under a single NVS key: one putBytes per save and one getBytes at boot,
+// instead of a key (and a String-built key name) per field.
+//
+// The blob carries a magic, a layout version, its own size and a CRC-32. A
+// blob that fails any of these checks is ignored and the settings fall back
+// to the legacy per-field keys (or their defaults). Changing either struct
+// requires bumping SETTINGS_VERSION.
+//
+// Firmware that still has the legacy keys migrates them on first boot: the
+// blob is written first, then the old keys are removed.
+//
+// requestSettingsSave() only marks the settings dirty. loopSettings() writes
+// the blob once no change arrived for SETTINGS_COMMIT_DELAY_MS (but at most
+// SETTINGS_COMMIT_MAX_MS after the first one), so a burst of POSTs from the
+// settings page becomes a single flash commit.
+// ============================================================================
+#define SETTINGS_BLOB_KEY "blob"
+#define SETTINGS_MAGIC 0x4344 // "DC"
+#define SETTINGS_VERSION 1
+#define SETTINGS_COMMIT_DELAY_MS 2000 // Quiet time before a commit
+#define SETTINGS_COMMIT_MAX_MS 10000  // Longest a change stays in RAM only
+
+struct SettingsBlob {
+  uint16_t magic;
+  uint8_t version;
+  uint8_t reserved;
+  uint32_t length; // sizeof(SettingsBlob) when written
+  ClockSettings clock;
+  NetworkSettings network;
+  uint32_t crc; // CRC-32 of all fields above
+};
+
+struct SettingsStats {
+  uint32_t loadMicros; // Boot-time load (incl. migration)
+  uint32_t requests;   // requestSettingsSave() calls
+  uint32_t commits;    // Blob writes
+  bool migrated;       // Legacy keys were converted this boot
+};
+
+SettingsStats settingsStats = {0, 0, 0, false};
+
+// Pending commit. Loop task only: applyCommands() marks changes through
+// requestSettingsSave(), commits clear them. /api/stats reads settingsDirty
+// from the AsyncTCP task, so only that one is atomic.
+std::atomic<bool> settingsDirty(false);
+uint32_t settingsFirstChange = 0;
+uint32_t settingsLastChange = 0;
+
+// CRC-32 (IEEE, reflected), bitwise: only runs at boot and per commit
+inline uint32_t settingsCrc32(const void *data, size_t length) {
+  const uint8_t *p = (const uint8_t *)data;
+  uint32_t crc = 0xFFFFFFFF;
+  while (length--) {
+    crc ^= *p++;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+// Load the blob into a snapshot, false if missing or invalid
+inline bool loadSettingsBlob(SettingsSnapshot &settings) {
+  SettingsBlob blob;
+  size_t length = preferences.getBytesLength(SETTINGS_BLOB_KEY);
+  if (length == 0) {
+    return false;
+  }
+  if (length != sizeof(blob) ||
+      preferences.getBytes(SETTINGS_BLOB_KEY, &blob, sizeof(blob)) !=
+          sizeof(blob)) {
+    Serial.printf("[SETTINGS] Blob size %u, expected %u - ignored\n", length,
+                  sizeof(blob));
+    return false;
+  }
+  if (blob.magic != SETTINGS_MAGIC || blob.version != SETTINGS_VERSION ||
+      blob.length != sizeof(blob)) {
+    Serial.printf("[SETTINGS] Blob version %u not supported - ignored\n",
+                  blob.version);
+    return false;
+  }
+  if (blob.crc != settingsCrc32(&blob, offsetof(SettingsBlob, crc))) {
+    Serial.println("[SETTINGS] Blob CRC mismatch - ignored");
+    return false;
+  }
+
+  settings.clock = blob.clock;
+  settings.network = blob.network;
+  // Never trust stored strings to be terminated
+  settings.clock.timezone[sizeof(settings.clock.timezone) - 1] = '\0';
+  settings.network.ssid[sizeof(settings.network.ssid) - 1] = '\0';
+  settings.network.password[sizeof(settings.network.password) - 1] = '\0';
+  return true;
+}
 
+// Write the published settings as one blob (one NVS write)
+inline void commitSettings() {
+  const SettingsSnapshot *settings = currentSettings();
+  SettingsBlob blob;
+  memset(&blob, 0, sizeof(blob)); // Deterministic padding for the CRC
+  blob.magic = SETTINGS_MAGIC;
+  blob.version = SETTINGS_VERSION;
+  blob.length = sizeof(blob);
+  blob.clock = settings->clock;
+  blob.network = settings->network;
+  blob.crc = settingsCrc32(&blob, offsetof(SettingsBlob, crc));
+
+  settingsDirty = false;
+  if (preferences.putBytes(SETTINGS_BLOB_KEY, &blob, sizeof(blob)) !=
+      sizeof(blob)) {
+    Serial.println("[SETTINGS] ERROR: commit failed");
+    return;
+  }
+  settingsStats.commits++;
+  Serial.printf("[SETTINGS] Committed %u bytes to NVS\n", sizeof(blob));
+}
+
+// ============================================================================
+// Legacy Keys (one NVS key per field, before the blob)
+// ============================================================================
+const char *const LEGACY_KEYS[] = {"netMode",     "netSSID",      "netPass",
+                                   "netFallback", "useActiveHrs", "wakeupInt",
+                                   "timezone"};
+const char *const LEGACY_DAY_KEYS[] = {"en", "st", "ed", "sm", "em"};
+
+// Load from the legacy keys, missing keys take their defaults
+inline void loadLegacySettings(SettingsSnapshot &settings) {
   // Load network settings
-  networkSettings.mode =
+  settings.network.mode =
       (NetworkMode)preferences.getUChar("netMode", NETWORK_CAPTIVE);
 
   // Initialize strings to empty, then load if they exist
-  networkSettings.ssid[0] = '\0';
-  networkSettings.password[0] = '\0';
+  settings.network.ssid[0] = '\0';
+  settings.network.password[0] = '\0';
   if (preferences.isKey("netSSID")) {
-    preferences.getString("netSSID", networkSettings.ssid,
-                          sizeof(networkSettings.ssid));
+    preferences.getString("netSSID", settings.network.ssid,
+                          sizeof(settings.network.ssid));
   }
   if (preferences.isKey("netPass")) {
-    preferences.getString("netPass", networkSettings.password,
-                          sizeof(networkSettings.password));
+    preferences.getString("netPass", settings.network.password,
+                          sizeof(settings.network.password));
   }
 
-  networkSettings.fallbackToCaptive = preferences.getBool("netFallback", true);
-
-  // Log network configuration
-  Serial.println("=== Network Configuration ===");
-  Serial.printf("  Mode: %s\n", networkSettings.mode == NETWORK_CAPTIVE
-                                    ? "Captive Portal"
-                                    : "Client");
-  if (networkSettings.mode == NETWORK_CLIENT) {
-    Serial.printf("  SSID: %s\n", networkSettings.ssid);
-    Serial.printf("  Password: %s\n",
-                  strlen(networkSettings.password) > 0 ? "****" : "(none)");
-    Serial.printf("  Fallback to Captive: %s\n",
-                  networkSettings.fallbackToCaptive ? "Yes" : "No");
-  }
-  Serial.println("=============================\n");
+  settings.network.fallbackToCaptive = preferences.getBool("netFallback", true);
 
   // Load useActiveHours setting
-  clockSettings.useActiveHours = preferences.getBool("useActiveHrs", true);
+  settings.clock.useActiveHours = preferences.getBool("useActiveHrs", true);
 
   // Load wakeup interval
-  clockSettings.wakeupInterval = preferences.getUShort("wakeupInt", WAKEUP_OFF);
+  settings.clock.wakeupInterval = preferences.getUShort("wakeupInt", WAKEUP_OFF);
 
-  // Load timezone (default: Europe/Berlin)
-  clockSettings.timezone[0] = '\0';
+  // Load timezone (default: Europe/Vienna)
+  settings.clock.timezone[0] = '\0';
   if (preferences.isKey("timezone")) {
-    preferences.getString("timezone", clockSettings.timezone,
-                          sizeof(clockSettings.timezone));
+    preferences.getString("timezone", settings.clock.timezone,
+                          sizeof(settings.clock.timezone));
   } else {
-    strcpy(clockSettings.timezone, "Europe/Vienna");
+    strcpy(settings.clock.timezone, "Europe/Vienna");
   }
-  Serial.printf("  Timezone: %s\n", clockSettings.timezone);
 
   // Load day schedules
   // Default: Mon-Fri 8-18, Sat-Sun off
+  char key[8];
   for (int i = 0; i < 7; i++) {
-    String prefix = "day" + String(i);
-
-    // Default values: Mon-Fri enabled 8-18, Sat-Sun disabled
+    DaySchedule &day = settings.clock.days[i];
     bool defaultEnabled = (i >= 1 && i <= 5); // Mon-Fri
-    uint8_t defaultStart = 8;
-    uint8_t defaultEnd = 18;
 
-    clockSettings.days[i].enabled =
-        preferences.getBool((prefix + "en").c_str(), defaultEnabled);
-    clockSettings.days[i].startHour =
-        preferences.getUChar((prefix + "st").c_str(), defaultStart);
-    clockSettings.days[i].endHour =
-        preferences.getUChar((prefix + "ed").c_str(), defaultEnd);
+    snprintf(key, sizeof(key), "day%d%s", i, LEGACY_DAY_KEYS[0]);
+    day.enabled = preferences.getBool(key, defaultEnabled);
+    snprintf(key, sizeof(key), "day%d%s", i, LEGACY_DAY_KEYS[1]);
+    day.startHour = preferences.getUChar(key, 8);
+    snprintf(key, sizeof(key), "day%d%s", i, LEGACY_DAY_KEYS[2]);
+    day.endHour = preferences.getUChar(key, 18);
+    snprintf(key, sizeof(key), "day%d%s", i, LEGACY_DAY_KEYS[3]);
+    day.startMinute = preferences.getUChar(key, 0);
+    snprintf(key, sizeof(key), "day%d%s", i, LEGACY_DAY_KEYS[4]);
+    day.endMinute = preferences.getUChar(key, 0);
   }
-
-  Serial.println("Settings loaded from NVS");
 }
 
-// Save all settings to NVS
-void saveSettings() {
-  preferences.putBool("useActiveHrs", clockSettings.useActiveHours);
-  preferences.putUShort("wakeupInt", clockSettings.wakeupInterval);
-
-  for (int i = 0; i < 7; i++) {
-    String prefix = "day" + String(i);
-    preferences.putBool((prefix + "en").c_str(), clockSettings.days[i].enabled);
-    preferences.putUChar((prefix + "st").c_str(),
-                         clockSettings.days[i].startHour);
-    preferences.putUChar((prefix + "ed").c_str(),
-                         clockSettings.days[i].endHour);
+// Remove the legacy keys, returns how many existed
+inline uint8_t removeLegacySettings() {
+  uint8_t removed = 0;
+  for (const char *key : LEGACY_KEYS) {
+    removed += preferences.remove(key);
   }
-
-  Serial.println("Settings saved to NVS");
-}
-
-// Save only active hours settings
-void saveActiveHours() {
-  preferences.putBool("useActiveHrs", clockSettings.useActiveHours);
-
+  char key[8];
   for (int i = 0; i < 7; i++) {
-    String prefix = "day" + String(i);
-    preferences.putBool((prefix + "en").c_str(), clockSettings.days[i].enabled);
-    preferences.putUChar((prefix + "st").c_str(),
-                         clockSettings.days[i].startHour);
-    preferences.putUChar((prefix + "ed").c_str(),
-                         clockSettings.days[i].endHour);
+    for (const char *suffix : LEGACY_DAY_KEYS) {
+      snprintf(key, sizeof(key), "day%d%s", i, suffix);
+      removed += preferences.remove(key);
+    }
   }
-
-  Serial.println("Active hours saved");
+  return removed;
 }
 
-// Save only wakeup interval
-void saveWakeupInterval() {
-  preferences.putUShort("wakeupInt", clockSettings.wakeupInterval);
-  Serial.printf("Wakeup interval saved: %d minutes\n",
-                clockSettings.wakeupInterval);
-}
+// ============================================================================
+// Settings Setup & Saving
+// ============================================================================
 
-// Save timezone
-void saveTimezone() {
-  preferences.putString("timezone", clockSettings.timezone);
-  Serial.printf("Timezone saved: %s\n", clockSettings.timezone);
-}
+// Initialize settings from NVS
+void setupSettings() {
+  Serial.println("=== Settings Setup ===");
+  Serial.println("  Loading from NVS...");
+  uint32_t start = micros();
+  preferences.begin(SETTINGS_NAMESPACE, false);
 
-// Check if display should be active right now based on settings
-bool isDisplayActiveTime(uint8_t weekday, uint8_t hour) {
-  if (!clockSettings.useActiveHours) {
-    return true; // Always active if feature disabled
+  // Publishing the first snapshot also compiles the schedule
+  SettingsSnapshot *draft = editSettings();
+  bool blobOk = loadSettingsBlob(*draft);
+  if (!blobOk) {
+    // First boot, older firmware or a damaged blob: legacy keys or defaults
+    loadLegacySettings(*draft);
   }
+  publishSettings();
 
-  DaySchedule &day = clockSettings.days[weekday];
+  settingsStats.migrated = false;
+  if (blobOk) {
+    Serial.println("  Settings blob OK");
+  } else {
+    commitSettings();
+    uint8_t removed = removeLegacySettings();
+    settingsStats.migrated = removed > 0;
+    Serial.printf("  Settings blob created (%u legacy keys migrated)\n",
+                  removed);
+  }
+  settingsDirty = false;
+  settingsStats.loadMicros = micros() - start;
 
-  if (!day.enabled) {
-    return false;
+  // Log network configuration
+  const NetworkSettings &network = currentSettings()->network;
+  Serial.println("=== Network Configuration ===");
+  Serial.printf("  Mode: %s\n", network.mode == NETWORK_CAPTIVE
+                                    ? "Captive Portal"
+                                    : "Client");
+  if (network.mode == NETWORK_CLIENT) {
+    Serial.printf("  SSID: %s\n", network.ssid);
+    Serial.printf("  Password: %s\n",
+                  strlen(network.password) > 0 ? "****" : "(none)");
+    Serial.printf("  Fallback to Captive: %s\n",
+                  network.fallbackToCaptive ? "Yes" : "No");
   }
+  Serial.println("=============================\n");
+
+  Serial.printf("  Timezone: %s\n", currentSettings()->clock.timezone);
 
-  // Handle same-day schedule (e.g., 8-18)
-  if (day.startHour <= day.endHour) {
-    return (hour >= day.startHour && hour < day.endHour);
+  Serial.printf("Settings loaded from NVS in %u us\n",
+                settingsStats.loadMicros);
+}
+
+// Mark the settings as changed, loopSettings() commits them
+inline void requestSettingsSave() {
+  uint32_t now = millis();
+  if (!settingsDirty) {
+    settingsFirstChange = now;
   }
+  settingsLastChange = now;
+  settingsDirty = true;
+  settingsStats.requests++;
+}
 
-  // Handle overnight schedule (e.g., 22-6) - not typical but supported
-  return (hour >= day.startHour || hour < day.endHour);
+// Commit pending changes now (e.g. before a reboot)
+inline void flushSettings() {
+  if (settingsDirty) {
+    commitSettings();
+  }
 }
 
-// Save network settings
-void saveNetworkSettings() {
-  preferences.putUChar("netMode", networkSettings.mode);
-  preferences.putString("netSSID", networkSettings.ssid);
-  preferences.putString("netPass", networkSettings.password);
-  preferences.putBool("netFallback", networkSettings.fallbackToCaptive);
-  Serial.println("Network settings saved");
+// Call from loop(): commits once the changes have settled
+inline void loopSettings() {
+  if (!settingsDirty) {
+    return;
+  }
+  uint32_t now = millis();
+  if (now - settingsLastChange >= SETTINGS_COMMIT_DELAY_MS ||
+      now - settingsFirstChange >= SETTINGS_COMMIT_MAX_MS) {
+    commitSettings();
+  }
 }
 
 // Global variable definitions
-ClockSettings clockSettings;
-NetworkSettings networkSettings;
 Preferences preferences;
 
 extern bool wakeup;
@@ -1,298 +1,382 @@
 #pragma once
 #include <Arduino.h>
-#include <ArduinoJson.h>
 #include <AsyncTCP.h>
 #include <ESPAsyncWebServer.h>
 #include <ESPmDNS.h>
-#include <FS.h>
-#include <LittleFS.h>
-
+#include <esp_timer.h>
+
+#include "api.h"
+#include "assets.h"
+#include "boot.h"
+#include "commands.h"
+#include "portal.h"
+#include "schedule.h"
 #include "settings.h"
 #include "websocket.h"
 
-// RTC time setting function from rtc.h
-extern void setRTCTime(int hours, int minutes, int seconds, int day, int month,
-                       int year);
-extern RTC_DS1307 rtc;
-extern bool rtcInitialized;
-extern bool usingInternalTime;
-DateTime getCurrentTime();
-
 // Network restart function from network.h
 extern void restartNetwork();
-extern NetworkMode activeNetworkMode;
-
-// Mode functions from modes.h
-extern void scheduleAutoWakeup();
 
 AsyncWebServer server(80);
+const WebAsset *portalPage = nullptr; // What "/" serves
+
+// Helper: Send a JSON body, written straight into the response stream
+// through the response arena (see api.h)
+void sendJson(AsyncWebServerRequest *request, void (*write)(JsonWriter &)) {
+  AsyncResponseStream *response =
+      request->beginResponseStream("application/json", RESPONSE_STREAM_BYTES);
+  JsonWriter json(*response);
+  write(json);
+  json.finish();
+  request->send(response);
+}
 
 // Helper: Send JSON response
 void sendJsonResponse(AsyncWebServerRequest *request, bool success,
                       const char *message = nullptr) {
-  JsonDocument doc;
-  doc["success"] = success;
+  AsyncResponseStream *response =
+      request->beginResponseStream("application/json", RESPONSE_STREAM_BYTES);
+  JsonWriter json(*response);
+  json.field("success", success);
   if (message) {
-    doc["message"] = message;
+    json.field("message", message);
   }
-  String response;
-  serializeJson(doc, response);
-  request->send(200, "application/json", response);
+  json.finish();
+  request->send(response);
 }
 
-void setupWeb() {
-  Serial.println("=== Web Server Setup ===");
+// Helper: Queue a command for the render loop, answer the request
+void sendCommandResponse(AsyncWebServerRequest *request, Command &command,
+                         const char *message) {
+  if (sendCommand(command)) {
+    sendJsonResponse(request, true, message);
+  } else {
+    sendJsonResponse(request, false, "Busy, please try again");
+  }
+}
 
-  if (!LittleFS.begin()) {
-    Serial.println("  ERROR: Failed to mount LittleFS filesystem!");
-    return;
+// Body callback of the POST endpoints. AsyncWebServer hands over every body
+// it does not parse itself (JSON, raw forms), assembled in requestBody.
+void onRequestBody(AsyncWebServerRequest *request, uint8_t *data, size_t len,
+                   size_t index, size_t total) {
+  appendRequestBody(requestBody, request, data, len, index, total, millis());
+}
+
+// Helper: The fields of a POST, without copies: the body from requestBody,
+// or the form arguments AsyncWebServer parsed itself (referenced in place).
+// False if the body could not be used.
+bool readRequestFields(AsyncWebServerRequest *request,
+                       RequestFields &fields) {
+  if (requestBody.owner == request) {
+    return takeRequestBody(requestBody, request, request->contentLength(),
+                           fields);
+  }
+  if (strncmp(request->contentType().c_str(), "application/json", 16) == 0) {
+    return false; // Its body was rejected (too large or busy)
+  }
+  for (size_t i = 0; i < request->params(); i++) {
+    const AsyncWebParameter *param = request->getParam(i);
+    if (!param->isFile() &&
+        !fields.add(param->name().c_str(), param->value().c_str())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Helper: Send an embedded asset from flash (gzipped), or a 304 if the
+// client's copy is current (see assets.h)
+void sendWebAsset(AsyncWebServerRequest *request, const WebAsset &asset) {
+  int64_t start = esp_timer_get_time();
+  const AsyncWebHeader *ifNoneMatch = request->getHeader("If-None-Match");
+  const String &version = request->arg("v");
+
+  AsyncWebServerResponse *response;
+  if (etagMatches(ifNoneMatch ? ifNoneMatch->value().c_str() : nullptr,
+                  asset)) {
+    response = request->beginResponse(304);
+    webAssetStats.notModified++;
+  } else {
+    response = request->beginResponse(200, asset.contentType, asset.data,
+                                      asset.length);
+    response->addHeader("Content-Encoding", "gzip");
+    webAssetStats.sent++;
+    webAssetStats.bytesSent += asset.length;
+    if (asset.rawLength > asset.length) {
+      webAssetStats.bytesSaved += asset.rawLength - asset.length;
+    }
   }
-  Serial.println("  LittleFS mounted successfully");
+  response->addHeader("ETag", asset.etag);
+  response->addHeader("Cache-Control",
+                      assetCacheControl(version.c_str(), asset));
+  request->send(response);
+  if (&asset == portalPage) {
+    notePortalOpened(probeStats, millis());
+  }
+
+  uint32_t micros = esp_timer_get_time() - start;
+  webAssetStats.lastMicros = micros;
+  webAssetStats.maxMicros = max(webAssetStats.maxMicros, micros);
+}
+
+// Helper: Answer a connectivity probe with the canned redirect to the portal
+// (see portal.h)
+void sendProbeResponse(AsyncWebServerRequest *request,
+                       const ProbeRoute &route) {
+  int64_t start = esp_timer_get_time();
+  AsyncWebServerResponse *response = request->beginResponse(302);
+  response->addHeader("Location", probeLocation);
+  response->addHeader("Cache-Control", "no-store");
+  request->send(response);
+  noteProbe(probeStats, route, millis(), esp_timer_get_time() - start);
+}
+
+void setupWeb() {
+  Serial.println("=== Web Server Setup ===");
 
   MDNS.addService("http", "tcp", 80);
   Serial.printf("  URL: http://%s.local\n", HOSTNAME);
   Serial.println("  Port: 80");
 
-  // GET / - Main page (always show settings page now)
-  server.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
-    request->send(LittleFS, "/index.html");
-  });
+  // GET / and /settings - pages, and the files they use (see assets.h)
+  portalPage = findWebAsset("/");
+  uint32_t rawBytes = 0, packedBytes = 0;
+  for (uint8_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    const WebAsset *asset = &WEB_ASSETS[i];
+    server.on(asset->path, HTTP_GET, [asset](AsyncWebServerRequest *request) {
+      sendWebAsset(request, *asset);
+    });
+    rawBytes += asset->rawLength;
+    packedBytes += asset->length;
+  }
+  for (const WebAssetAlias &alias : WEB_ASSET_ALIASES) {
+    const WebAsset *asset = findWebAsset(alias.path);
+    server.on(alias.url, HTTP_GET, [asset](AsyncWebServerRequest *request) {
+      sendWebAsset(request, *asset);
+    });
+  }
+  Serial.printf("  Web assets: %u files, %u bytes gzipped (%u raw)\n",
+                WEB_ASSET_COUNT, packedBytes, rawBytes);
+
+  // ===== API ENDPOINTS =====
 
-  // GET /settings - Settings page
-  server.on("/settings", HTTP_GET, [](AsyncWebServerRequest *request) {
-    request->send(LittleFS, "/settings.html");
+  // GET /api/state - Time, settings and network status in one document, or
+  // a 304 if the client has it (see "State Version" in settings.h)
+  server.on("/api/state", HTTP_GET, [](AsyncWebServerRequest *request) {
+    // Version first: the body may be newer than its ETag, never older
+    uint32_t version = stateVersion.load(std::memory_order_acquire);
+    DateTime now = getPublishedTime();
+    char etag[STATE_ETAG_SIZE];
+    formatStateEtag(etag, version, now.unixtime() / 60);
+
+    const AsyncWebHeader *ifNoneMatch = request->getHeader("If-None-Match");
+    if (etagListMatches(ifNoneMatch ? ifNoneMatch->value().c_str() : nullptr,
+                        etag)) {
+      AsyncWebServerResponse *response = request->beginResponse(304);
+      response->addHeader("ETag", etag);
+      response->addHeader("Cache-Control", ASSET_CACHE_REVALIDATE);
+      request->send(response);
+      stateStats.notModified++;
+      return;
+    }
+
+    AsyncResponseStream *response =
+        request->beginResponseStream("application/json", 1024);
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", ASSET_CACHE_REVALIDATE);
+    JsonWriter json(*response);
+    writeStateJson(json, version, now);
+    json.finish();
+    request->send(response);
+    stateStats.sent++;
   });
 
-  // ===== API ENDPOINTS =====
+  // POST /api/state - Any combination of the fields of the single POST
+  // endpoints below (JSON object or form), applied together in one frame
+  // (one snapshot, one save). Nothing is applied if a group is invalid or
+  // the queue has no room.
+  server.on(
+      "/api/state", HTTP_POST,
+      [](AsyncWebServerRequest *request) {
+        RequestFields fields;
+        Command batch[STATE_ARGS_GROUPS];
+        uint8_t count = 0;
+        if (!readRequestFields(request, fields)) {
+          sendJsonResponse(request, false, "Invalid request body");
+          return;
+        }
+        ArgsResult result = parseStateArgs(fields, batch, count);
+        if (result == ARGS_INVALID) {
+          sendJsonResponse(request, false, "Invalid parameters");
+          return;
+        }
+        if (result == ARGS_MISSING) {
+          sendJsonResponse(request, false, "No valid parameters provided");
+          return;
+        }
+        if (!sendCommands(batch, count)) {
+          sendJsonResponse(request, false, "Busy, please try again");
+          return;
+        }
+        stateStats.batches++;
+        bool restart = batch[count - 1].type == CMD_SET_NETWORK &&
+                       batch[count - 1].network.apply;
+        sendJsonResponse(request, true,
+                         restart ? "Settings saved. Restarting network..."
+                                 : "Settings saved");
+      },
+      nullptr, onRequestBody);
 
   // GET /api/time - Get current time (RTC or internal fallback)
   server.on("/api/time", HTTP_GET, [](AsyncWebServerRequest *request) {
-    JsonDocument doc;
-    DateTime now = getCurrentTime();
-    doc["success"] = true;
-    doc["hours"] = now.hour();
-    doc["minutes"] = now.minute();
-    doc["seconds"] = now.second();
-    doc["day"] = now.day();
-    doc["month"] = now.month();
-    doc["year"] = now.year();
-    doc["weekday"] = now.dayOfTheWeek();
-    doc["usingInternalTime"] = usingInternalTime;
-    String response;
-    serializeJson(doc, response);
-    request->send(200, "application/json", response);
+    sendJson(request, writeTimeJson);
   });
 
   // POST /api/time - Set RTC time
-  server.on("/api/time", HTTP_POST, [](AsyncWebServerRequest *request) {
-    if (request->hasArg("hours") && request->hasArg("minutes") &&
-        request->hasArg("day") && request->hasArg("month") &&
-        request->hasArg("year")) {
-      setRTCTime(request->arg("hours").toInt(), request->arg("minutes").toInt(),
-                 0, request->arg("day").toInt(), request->arg("month").toInt(),
-                 request->arg("year").toInt());
-      scheduleAutoWakeup();
-      wakeup = true;
-      sendJsonResponse(request, true, "Time saved");
-    } else {
-      sendJsonResponse(request, false, "Missing parameters");
-    }
-  });
+  server.on(
+      "/api/time", HTTP_POST,
+      [](AsyncWebServerRequest *request) {
+        RequestFields fields;
+        Command command;
+        if (readRequestFields(request, fields) &&
+            parseTimeArgs(fields, command) == ARGS_OK) {
+          sendCommandResponse(request, command, "Time saved");
+        } else {
+          sendJsonResponse(request, false, "Missing parameters");
+        }
+      },
+      nullptr, onRequestBody);
 
   // GET /api/timezone - Get current timezone
   server.on("/api/timezone", HTTP_GET, [](AsyncWebServerRequest *request) {
-    JsonDocument doc;
-    doc["success"] = true;
-    doc["timezone"] = clockSettings.timezone;
-    String response;
-    serializeJson(doc, response);
-    request->send(200, "application/json", response);
+    sendJson(request, writeTimezoneJson);
   });
 
   // POST /api/timezone - Set timezone
-  server.on("/api/timezone", HTTP_POST, [](AsyncWebServerRequest *request) {
-    if (request->hasArg("timezone")) {
-      String tz = request->arg("timezone");
-      if (tz.length() > 0 && tz.length() < sizeof(clockSettings.timezone)) {
-        strncpy(clockSettings.timezone, tz.c_str(),
-                sizeof(clockSettings.timezone) - 1);
-        clockSettings.timezone[sizeof(clockSettings.timezone) - 1] = '\0';
-        saveTimezone();
-        sendJsonResponse(request, true, "Timezone saved");
-      } else {
-        sendJsonResponse(request, false, "Invalid timezone");
-      }
-    } else {
-      sendJsonResponse(request, false, "Missing timezone parameter");
-    }
-  });
+  server.on(
+      "/api/timezone", HTTP_POST,
+      [](AsyncWebServerRequest *request) {
+        RequestFields fields;
+        Command command;
+        if (!readRequestFields(request, fields)) {
+          sendJsonResponse(request, false, "Invalid request body");
+          return;
+        }
+        switch (parseTimezoneArgs(fields, command)) {
+        case ARGS_OK:
+          sendCommandResponse(request, command, "Timezone saved");
+          break;
+        case ARGS_INVALID:
+          sendJsonResponse(request, false, "Invalid timezone");
+          break;
+        case ARGS_MISSING:
+          sendJsonResponse(request, false, "Missing timezone parameter");
+          break;
+        }
+      },
+      nullptr, onRequestBody);
 
   // GET /api/active-hours - Get active hours settings
   server.on("/api/active-hours", HTTP_GET, [](AsyncWebServerRequest *request) {
-    JsonDocument doc;
-    doc["success"] = true;
-    doc["enabled"] = clockSettings.useActiveHours;
-
-    JsonArray days = doc["days"].to<JsonArray>();
-    const char *dayNames[] = {"sun", "mon", "tue", "wed", "thu", "fri", "sat"};
-
-    for (int i = 0; i < 7; i++) {
-      JsonObject day = days.add<JsonObject>();
-      day["name"] = dayNames[i];
-      day["enabled"] = clockSettings.days[i].enabled;
-      day["start"] = clockSettings.days[i].startHour;
-      day["end"] = clockSettings.days[i].endHour;
-    }
-
-    String response;
-    serializeJson(doc, response);
-    request->send(200, "application/json", response);
+    sendJson(request, writeActiveHoursJson);
   });
 
-  // POST /api/active-hours - Set active hours settings
-  server.on("/api/active-hours", HTTP_POST, [](AsyncWebServerRequest *request) {
-    // Global enable/disable
-    if (request->hasArg("enabled")) {
-      clockSettings.useActiveHours =
-          request->arg("enabled") == "true" || request->arg("enabled") == "1";
-    }
-
-    // Per-day settings
-    for (int i = 0; i < 7; i++) {
-      String prefix = "day" + String(i);
-
-      if (request->hasArg(prefix + "_enabled")) {
-        String val = request->arg(prefix + "_enabled");
-        clockSettings.days[i].enabled = (val == "true" || val == "1");
-      }
-      if (request->hasArg(prefix + "_start")) {
-        clockSettings.days[i].startHour =
-            request->arg(prefix + "_start").toInt();
-      }
-      if (request->hasArg(prefix + "_end")) {
-        clockSettings.days[i].endHour = request->arg(prefix + "_end").toInt();
-      }
-    }
-
-    saveActiveHours();
-    sendJsonResponse(request, true, "Active hours saved");
-  });
+  // POST /api/active-hours - Set active hours settings (only the fields that
+  // were sent)
+  server.on(
+      "/api/active-hours", HTTP_POST,
+      [](AsyncWebServerRequest *request) {
+        RequestFields fields;
+        Command command;
+        if (!readRequestFields(request, fields)) {
+          sendJsonResponse(request, false, "Invalid request body");
+          return;
+        }
+        parseScheduleArgs(fields, command);
+        sendCommandResponse(request, command, "Active hours saved");
+      },
+      nullptr, onRequestBody);
 
   // GET /api/wakeup-interval - Get wakeup interval
   server.on("/api/wakeup-interval", HTTP_GET,
             [](AsyncWebServerRequest *request) {
-              JsonDocument doc;
-              doc["success"] = true;
-              doc["interval"] = clockSettings.wakeupInterval;
-
-              String response;
-              serializeJson(doc, response);
-              request->send(200, "application/json", response);
+              sendJson(request, writeWakeupIntervalJson);
             });
 
   // POST /api/wakeup-interval - Set wakeup interval
-  server.on("/api/wakeup-interval", HTTP_POST,
-            [](AsyncWebServerRequest *request) {
-              if (request->hasArg("interval")) {
-                clockSettings.wakeupInterval = request->arg("interval").toInt();
-                saveWakeupInterval();
-                scheduleAutoWakeup();
-                sendJsonResponse(request, true, "Wakeup interval saved");
-              } else {
-                sendJsonResponse(request, false, "Missing interval parameter");
-              }
-            });
+  server.on(
+      "/api/wakeup-interval", HTTP_POST,
+      [](AsyncWebServerRequest *request) {
+        RequestFields fields;
+        Command command;
+        if (readRequestFields(request, fields) &&
+            parseIntervalArgs(fields, command) == ARGS_OK) {
+          sendCommandResponse(request, command, "Wakeup interval saved");
+        } else {
+          sendJsonResponse(request, false, "Missing interval parameter");
+        }
+      },
+      nullptr, onRequestBody);
 
   // POST /wakeup - Manual wakeup trigger
   server.on("/wakeup", HTTP_POST, [](AsyncWebServerRequest *request) {
-    wakeup = true;
-    sendJsonResponse(request, true, "Wakeup triggered");
+    Command command = makeCommand(CMD_WAKEUP);
+    sendCommandResponse(request, command, "Wakeup triggered");
+  });
+
+  // GET /api/stats - Render statistics
+  server.on("/api/stats", HTTP_GET, [](AsyncWebServerRequest *request) {
+    AsyncResponseStream *response =
+        request->beginResponseStream("application/json", 1536);
+    JsonWriter json(*response);
+    writeStatsJson(json, segmentPreview.stats, segmentPreviewClients,
+                   ledPreviewClients);
+    json.finish();
+    request->send(response);
   });
 
   // GET /api/network - Get network settings
   server.on("/api/network", HTTP_GET, [](AsyncWebServerRequest *request) {
-    JsonDocument doc;
-    doc["success"] = true;
-    doc["mode"] = networkSettings.mode;
-    doc["ssid"] = networkSettings.ssid;
-    // Don't send password for security
-    doc["hasPassword"] = strlen(networkSettings.password) > 0;
-    doc["fallback"] = networkSettings.fallbackToCaptive;
-    doc["activeMode"] = activeNetworkMode;
-    doc["connected"] =
-        (activeNetworkMode == NETWORK_CLIENT && WiFi.status() == WL_CONNECTED);
-    if (activeNetworkMode == NETWORK_CLIENT && WiFi.status() == WL_CONNECTED) {
-      doc["ip"] = WiFi.localIP().toString();
-    } else if (activeNetworkMode == NETWORK_CAPTIVE) {
-      doc["ip"] = "192.168.4.1";
-    }
-
-    String response;
-    serializeJson(doc, response);
-    request->send(200, "application/json", response);
+    sendJson(request, writeNetworkJson);
   });
 
   // POST /api/network - Set network settings
-  server.on("/api/network", HTTP_POST, [](AsyncWebServerRequest *request) {
-    bool changed = false;
-
-    if (request->hasArg("mode")) {
-      int mode = request->arg("mode").toInt();
-      if (mode == NETWORK_CAPTIVE || mode == NETWORK_CLIENT) {
-        networkSettings.mode = (NetworkMode)mode;
-        changed = true;
-      }
-    }
-
-    if (request->hasArg("ssid")) {
-      String ssid = request->arg("ssid");
-      strncpy(networkSettings.ssid, ssid.c_str(),
-              sizeof(networkSettings.ssid) - 1);
-      networkSettings.ssid[sizeof(networkSettings.ssid) - 1] = '\0';
-      changed = true;
-    }
-
-    if (request->hasArg("password")) {
-      String password = request->arg("password");
-      // Only update password if provided (allow empty to clear)
-      strncpy(networkSettings.password, password.c_str(),
-              sizeof(networkSettings.password) - 1);
-      networkSettings.password[sizeof(networkSettings.password) - 1] = '\0';
-      changed = true;
-    }
-
-    if (request->hasArg("fallback")) {
-      String val = request->arg("fallback");
-      networkSettings.fallbackToCaptive = (val == "true" || val == "1");
-      changed = true;
-    }
-
-    if (changed) {
-      saveNetworkSettings();
-
-      // Check if we should restart network now
-      if (request->hasArg("apply") &&
-          (request->arg("apply") == "true" || request->arg("apply") == "1")) {
-        sendJsonResponse(request, true,
-                         "Network settings saved. Restarting network...");
-        // Delay restart to allow response to be sent
-        delay(100);
-        restartNetwork();
-      } else {
-        sendJsonResponse(request, true,
-                         "Network settings saved. Restart to apply.");
-      }
+  server.on(
+      "/api/network", HTTP_POST,
+      [](AsyncWebServerRequest *request) {
+        RequestFields fields;
+        Command command;
+        if (readRequestFields(request, fields) &&
+            parseNetworkArgs(fields, command) == ARGS_OK) {
+          sendCommandResponse(
+              request, command,
+              command.network.apply
+                  ? "Network settings saved. Restarting network..."
+                  : "Network settings saved. Restart to apply.");
+        } else {
+          sendJsonResponse(request, false, "No valid parameters provided");
+        }
+      },
+      nullptr, onRequestBody);
+
+  // Captive portal: connectivity probes get their canned answer, all other
+  // unknown requests are redirected to main page. The probe redirect points
+  // at the access point, so outside captive mode probes are redirected to
+  // the main page on whatever host the client used, like everything else
+  setProbeLocation(apIP);
+  server.onNotFound([](AsyncWebServerRequest *request) {
+    const ProbeRoute *probe = networkState == NET_CAPTIVE
+                                  ? findProbeRoute(request->url().c_str())
+                                  : nullptr;
+    if (probe) {
+      sendProbeResponse(request, *probe);
     } else {
-      sendJsonResponse(request, false, "No valid parameters provided");
+      request->redirect("/");
     }
   });
-
-  // Serve static files
-  server.serveStatic("/", LittleFS, "/").setCacheControl("max-age=600");
-
-  // Captive portal: redirect all unknown requests to main page
-  server.onNotFound(
-      [](AsyncWebServerRequest *request) { request->redirect("/"); });
+  Serial.printf("  Captive probes: %u routes -> %s\n",
+                (unsigned)(sizeof(PROBE_ROUTES) / sizeof(PROBE_ROUTES[0])),
+                probeLocation);
 
   // Setup WebSocket for LED preview
   setupWebSocket(server);
@@ -0,0 +1,665 @@
+// Generated by scripts/embed_assets.py from data/ - do not edit.
+#pragma once
+#include <stdint.h>
+
+// 4 assets, 33970 bytes raw, 10119 bytes gzipped
+
+// script.js: 0 -> 20 bytes
+constexpr uint8_t WEB_ASSET_SCRIPT_JS[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+
+// style.css: 4015 -> 1233 bytes
+constexpr uint8_t WEB_ASSET_STYLE_CSS[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x57, 0x4b, 0x6f, 0xe3, 0x36,
+    0x10, 0xbe, 0xe7, 0x57, 0x10, 0x09, 0x16, 0x9b, 0x04, 0x96, 0x57, 0x92, 0x63, 0xc7, 0x51, 0xd0,
+    0x43, 0x5b, 0xa0, 0x40, 0x81, 0xb6, 0x87, 0x5d, 0xec, 0xa1, 0x28, 0xf6, 0x40, 0x49, 0x23, 0x99,
+    0x35, 0x25, 0x0a, 0x24, 0x15, 0xc7, 0x29, 0xfa, 0xdf, 0x3b, 0xa4, 0x1e, 0xa6, 0x2c, 0xd9, 0xde,
+    0xdd, 0x4b, 0x91, 0x4d, 0x56, 0x22, 0x87, 0xc3, 0x99, 0xf9, 0xbe, 0x79, 0xe8, 0x9e, 0xfc, 0x73,
+    0x45, 0x48, 0x2c, 0x5e, 0x3d, 0xc5, 0xde, 0x58, 0x99, 0x47, 0xf8, 0x2c, 0x53, 0x90, 0x1e, 0x2e,
+    0x3d, 0x5f, 0xfd, 0x7b, 0x75, 0x15, 0x8b, 0x74, 0x6f, 0x65, 0x0a, 0x2a, 0x73, 0x56, 0x46, 0xc4,
+    0x7f, 0xc6, 0x97, 0x8a, 0xa6, 0xa9, 0x95, 0xb6, 0x6f, 0x05, 0x2b, 0xbd, 0x0d, 0xb0, 0x7c, 0xa3,
+    0x23, 0x12, 0xf8, 0xfe, 0xcb, 0xc6, 0x2c, 0xc6, 0x34, 0xd9, 0xe6, 0x52, 0xd4, 0x65, 0x1a, 0x11,
+    0xce, 0x4a, 0xa0, 0xd2, 0xcb, 0x25, 0x4d, 0x19, 0x94, 0xfa, 0x36, 0x58, 0x2c, 0x53, 0xc8, 0x67,
+    0xe4, 0x26, 0xa0, 0x01, 0x0d, 0x81, 0xf8, 0xef, 0xcc, 0xf3, 0x2a, 0x0c, 0x16, 0x40, 0x96, 0xf6,
+    0xc5, 0xcf, 0x16, 0x0f, 0x2b, 0xdf, 0x68, 0x7b, 0x77, 0x67, 0xb4, 0x25, 0x82, 0x0b, 0x19, 0x91,
+    0xdd, 0x86, 0x69, 0x30, 0xef, 0x99, 0x28, 0xb5, 0x97, 0xd1, 0x82, 0xf1, 0x7d, 0x44, 0x3c, 0x5a,
+    0x55, 0x1c, 0x3c, 0xb5, 0x57, 0x1a, 0x8a, 0x19, 0xf9, 0x09, 0xaf, 0xdb, 0xfe, 0x4e, 0x93, 0x4f,
+    0xf6, 0xfd, 0x17, 0x94, 0x9c, 0x91, 0xf7, 0x9f, 0x20, 0x17, 0x40, 0x3e, 0xff, 0xfa, 0x7e, 0x46,
+    0x3e, 0x8a, 0x58, 0x68, 0x31, 0x23, 0x3f, 0x4a, 0x46, 0xf9, 0x8c, 0x28, 0x5a, 0x2a, 0x4f, 0x81,
+    0x64, 0x99, 0x75, 0x78, 0x9e, 0xe0, 0x01, 0x8a, 0x06, 0xcb, 0xd6, 0xed, 0x57, 0x6f, 0xc7, 0x52,
+    0xbd, 0x89, 0xd0, 0x32, 0xbf, 0x7a, 0x7d, 0x76, 0x43, 0x41, 0x68, 0xad, 0xc5, 0x20, 0x1e, 0xa1,
+    0x15, 0x41, 0x35, 0x9b, 0xc0, 0x1e, 0xd7, 0xf0, 0xaa, 0x3d, 0xca, 0x59, 0x8e, 0xe2, 0x09, 0xba,
+    0x0e, 0xd2, 0x55, 0x60, 0xa4, 0x51, 0xcb, 0xa2, 0xd5, 0x6b, 0x9d, 0x42, 0x1c, 0x00, 0xc3, 0x38,
+    0x5f, 0x43, 0xd1, 0x28, 0x0a, 0x87, 0xe1, 0xc7, 0x9f, 0x60, 0x39, 0x21, 0x1f, 0x1a, 0xf9, 0x3e,
+    0x50, 0x37, 0xf0, 0xf4, 0xb0, 0x5c, 0xf9, 0xad, 0x47, 0x54, 0xa6, 0x0d, 0xce, 0x0e, 0x26, 0x32,
+    0x8f, 0xe9, 0x6d, 0xb8, 0x5c, 0xce, 0xc8, 0xe1, 0x8f, 0x3f, 0x0f, 0x6c, 0xb4, 0x5b, 0x0e, 0x18,
+    0xb8, 0x6a, 0x85, 0xca, 0x57, 0xcd, 0x7d, 0x47, 0x5e, 0x76, 0x46, 0x21, 0x57, 0xb4, 0x16, 0xc5,
+    0x61, 0xd9, 0x5c, 0x93, 0x4a, 0x51, 0x79, 0x19, 0xe3, 0xe8, 0x31, 0x72, 0x8a, 0xd7, 0xf2, 0x36,
+    0xc0, 0xdd, 0xbb, 0xc6, 0xa0, 0x4c, 0xc8, 0xc2, 0x93, 0x62, 0x67, 0x8d, 0x4a, 0x99, 0xaa, 0x38,
+    0x45, 0x18, 0x33, 0x0e, 0xf6, 0xb8, 0x0d, 0x97, 0x87, 0x40, 0x17, 0xca, 0x0d, 0xda, 0xdf, 0xb5,
+    0xd2, 0x2c, 0xdb, 0x7b, 0x06, 0x1f, 0x5c, 0x74, 0xb7, 0x72, 0x5a, 0x21, 0x3c, 0x93, 0x36, 0x35,
+    0xb1, 0xc2, 0x4b, 0x59, 0x59, 0xd5, 0xfa, 0x2f, 0xbd, 0xaf, 0xe0, 0x87, 0xeb, 0xb2, 0x2e, 0x62,
+    0x90, 0xd7, 0x5f, 0xa2, 0xc8, 0xdb, 0x41, 0xbc, 0x65, 0xda, 0x63, 0x25, 0x02, 0xee, 0xa9, 0xca,
+    0x9c, 0xac, 0xf1, 0x64, 0x39, 0xbb, 0x70, 0x40, 0xd4, 0x7a, 0x78, 0xc0, 0xfa, 0xd2, 0xed, 0x22,
+    0x21, 0x91, 0xf0, 0xb4, 0x4c, 0x10, 0x9a, 0x52, 0x94, 0xf0, 0x3c, 0x4c, 0xa0, 0x13, 0xe6, 0x5c,
+    0x54, 0xe1, 0x15, 0xe2, 0x6d, 0xb0, 0x61, 0xe8, 0x95, 0x31, 0xe0, 0xa9, 0x8d, 0xdb, 0xf4, 0x46,
+    0x77, 0x59, 0x9b, 0xe9, 0x06, 0xd9, 0x83, 0xc6, 0x1e, 0xd2, 0x20, 0x6c, 0xb1, 0x1b, 0x42, 0xbf,
+    0x1e, 0x33, 0xad, 0x5d, 0x9a, 0x66, 0xf6, 0x65, 0x86, 0x3d, 0xb9, 0xf9, 0xdc, 0x16, 0x00, 0xb3,
+    0xd2, 0x26, 0xd9, 0xa3, 0xef, 0xe2, 0x35, 0x57, 0x05, 0xe5, 0xdc, 0x5a, 0xde, 0x25, 0xe1, 0x00,
+    0xcf, 0x28, 0x13, 0x49, 0xad, 0xec, 0x3e, 0x02, 0x62, 0xca, 0x0c, 0xb2, 0x10, 0x73, 0x4a, 0x09,
+    0xce, 0xd2, 0x61, 0x12, 0xa4, 0xec, 0x85, 0xa5, 0x6d, 0x52, 0x3b, 0xee, 0x84, 0x0f, 0x8e, 0x87,
+    0xbb, 0xb6, 0x88, 0xc5, 0xa2, 0x89, 0xe8, 0x54, 0x32, 0xc5, 0xba, 0x1c, 0xd2, 0x96, 0x95, 0xe6,
+    0x5e, 0x2f, 0xe6, 0x22, 0xd9, 0x1e, 0x87, 0xa0, 0x3f, 0x39, 0xae, 0x60, 0x67, 0x91, 0xe8, 0xcd,
+    0xba, 0x0c, 0xc7, 0xea, 0x9c, 0xfd, 0xb5, 0x54, 0xe6, 0xd2, 0x4a, 0xb0, 0x0e, 0x20, 0x8d, 0x04,
+    0x51, 0x4c, 0x33, 0x81, 0xb0, 0x99, 0xd0, 0xfa, 0xf3, 0x50, 0x11, 0xa0, 0x0a, 0x7a, 0xef, 0xa2,
+    0x8d, 0x78, 0x69, 0xe3, 0x34, 0x70, 0x25, 0xcb, 0x56, 0xf1, 0x2a, 0xee, 0x75, 0x98, 0x1c, 0x8e,
+    0x9a, 0x47, 0x4e, 0x35, 0xfc, 0x79, 0xeb, 0x85, 0x7d, 0x7e, 0x1b, 0x2d, 0x34, 0xd1, 0xec, 0x05,
+    0x9a, 0x22, 0x38, 0x29, 0xef, 0x1f, 0x84, 0x3d, 0x8e, 0xb9, 0x01, 0x2e, 0xcc, 0xa6, 0xf0, 0x4f,
+    0x96, 0x9c, 0x11, 0x13, 0x3b, 0x15, 0x07, 0xa6, 0xf4, 0x67, 0x70, 0x7f, 0x18, 0x9f, 0xf6, 0xdc,
+    0xc3, 0xa0, 0x52, 0xc8, 0xae, 0x71, 0x75, 0xda, 0x14, 0x70, 0x48, 0xf4, 0x59, 0x6b, 0xce, 0x67,
+    0xcb, 0x31, 0xb4, 0x13, 0x70, 0x7d, 0x7f, 0x9e, 0x9c, 0xaa, 0x6f, 0x37, 0x9a, 0x15, 0xf0, 0x86,
+    0x37, 0x3a, 0xed, 0xa2, 0x97, 0xf2, 0x5d, 0xcf, 0xbe, 0x21, 0x69, 0xb4, 0xc8, 0x73, 0x0e, 0xdf,
+    0x54, 0xa6, 0x6d, 0x2d, 0x0e, 0x5a, 0xb4, 0x46, 0x04, 0x74, 0x94, 0xba, 0x15, 0x30, 0xd9, 0x40,
+    0xb2, 0xc5, 0x91, 0xa3, 0xad, 0x81, 0x6d, 0xd8, 0x3b, 0xcc, 0xbb, 0xd9, 0x22, 0x3c, 0xa7, 0x55,
+    0xa1, 0x8e, 0xb4, 0xc6, 0x31, 0x40, 0xd3, 0x98, 0x4f, 0x72, 0xa9, 0x05, 0x0b, 0x43, 0xca, 0x69,
+    0xa5, 0xd0, 0xe9, 0xee, 0xc9, 0xad, 0xce, 0x26, 0x9e, 0xcd, 0x54, 0x33, 0x62, 0xcc, 0xc4, 0x2d,
+    0x7a, 0x33, 0xea, 0xf2, 0x1c, 0x32, 0xfd, 0x7c, 0xcc, 0xc2, 0x96, 0x71, 0x1d, 0x9a, 0x94, 0xd2,
+    0x51, 0xce, 0x96, 0x98, 0x1f, 0x94, 0x3b, 0x76, 0xf6, 0x08, 0xf7, 0xd0, 0xf4, 0x44, 0xe9, 0x7e,
+    0x31, 0x79, 0xef, 0xa6, 0xed, 0x4a, 0xc7, 0x99, 0x70, 0xca, 0x87, 0xcb, 0x38, 0x74, 0x25, 0xbf,
+    0x9f, 0xf1, 0xd6, 0x5f, 0xa1, 0xca, 0xd0, 0x71, 0xa8, 0xe6, 0xc9, 0x3f, 0x1a, 0x23, 0xd6, 0x27,
+    0x52, 0xd3, 0x68, 0xde, 0x20, 0xb4, 0xf6, 0xf0, 0x54, 0xcc, 0xa6, 0xf2, 0xd8, 0x1d, 0x8d, 0xac,
+    0x69, 0x9a, 0xea, 0x96, 0xe5, 0x27, 0x4b, 0x75, 0x9b, 0x25, 0x06, 0xb2, 0x03, 0x67, 0x27, 0x6e,
+    0x70, 0x8b, 0xa6, 0xa8, 0x68, 0xc2, 0xf4, 0x1e, 0x33, 0x74, 0xa1, 0xdc, 0x9b, 0xe6, 0xaa, 0x4e,
+    0x12, 0x50, 0x6a, 0x60, 0xf4, 0x03, 0x4d, 0x61, 0xed, 0x0f, 0xc4, 0x40, 0x4a, 0x21, 0x07, 0x42,
+    0xd9, 0xfa, 0x31, 0x78, 0x0c, 0x1a, 0x21, 0x33, 0xba, 0x0e, 0x6d, 0xee, 0x8d, 0x9d, 0x6e, 0xb8,
+    0xc7, 0x2d, 0xaa, 0x95, 0x4b, 0x21, 0x11, 0x92, 0x36, 0x16, 0x8f, 0x3a, 0x4c, 0x3f, 0xa4, 0xda,
+    0xeb, 0x9c, 0x7a, 0x3f, 0x3a, 0x8a, 0xf5, 0x09, 0xa4, 0x89, 0x99, 0x15, 0xff, 0x70, 0x4f, 0x7e,
+    0x83, 0x9c, 0x26, 0x7b, 0xa2, 0xea, 0xaa, 0x12, 0x52, 0x63, 0xac, 0x24, 0x06, 0x35, 0x85, 0xd7,
+    0xf9, 0x46, 0x17, 0x9c, 0xdc, 0x7f, 0xc0, 0x61, 0xd3, 0x9a, 0x36, 0x5d, 0x32, 0xcc, 0xff, 0x5e,
+    0xca, 0x24, 0x16, 0x21, 0xab, 0x1e, 0x8d, 0xaf, 0x8b, 0xf2, 0xfb, 0x66, 0xbe, 0xc9, 0x8f, 0x8e,
+    0x09, 0x17, 0x9d, 0xe9, 0xac, 0xe5, 0xe1, 0xaa, 0x29, 0x07, 0xce, 0x64, 0xbf, 0xf0, 0x4f, 0x55,
+    0x96, 0x21, 0xf6, 0x7d, 0x23, 0xb3, 0x6d, 0xd3, 0xd5, 0xef, 0x06, 0xf1, 0xd0, 0xed, 0x54, 0x42,
+    0x39, 0xdc, 0x06, 0x73, 0x7f, 0x79, 0xd7, 0x05, 0xf0, 0x0f, 0xd0, 0x3b, 0x21, 0xb7, 0x44, 0x81,
+    0xd6, 0x68, 0xa9, 0xb2, 0x31, 0x63, 0x65, 0x26, 0xcc, 0x17, 0xd7, 0xf4, 0x90, 0xee, 0x63, 0x3b,
+    0x68, 0xfe, 0xcd, 0x17, 0x77, 0xa7, 0xbb, 0xce, 0xa8, 0x39, 0x4d, 0x76, 0x8a, 0x69, 0x7e, 0x4f,
+    0x50, 0xcb, 0xb4, 0x94, 0x84, 0x9b, 0xcf, 0xb5, 0x9f, 0x45, 0x99, 0xb1, 0xfc, 0xa2, 0x6d, 0xe1,
+    0x57, 0xd9, 0x76, 0x61, 0x4a, 0x3f, 0x7c, 0x1a, 0x70, 0x1a, 0x43, 0xd3, 0xcf, 0x0d, 0xd2, 0x87,
+    0x52, 0x3e, 0xb6, 0xb8, 0xa9, 0xb8, 0x47, 0x33, 0xb5, 0x11, 0xb8, 0xfe, 0x32, 0x9c, 0xe2, 0x2b,
+    0xaa, 0x14, 0x06, 0x3f, 0x6d, 0xcb, 0x92, 0x61, 0x23, 0xaa, 0x74, 0x86, 0xcf, 0xee, 0x73, 0xee,
+    0x6c, 0x3d, 0xff, 0xdf, 0x7a, 0x3f, 0x7a, 0xf8, 0x1f, 0xd0, 0xc8, 0x1b, 0xd4, 0xaf, 0x0f, 0x00,
+    0x00,
+};
+
+// index.html: 13207 -> 4950 bytes
+constexpr uint8_t WEB_ASSET_INDEX_HTML[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x5b, 0xdd, 0x6e, 0x23, 0x57,
+    0x72, 0xbe, 0xf7, 0x53, 0x1c, 0x6b, 0x13, 0x4b, 0x8a, 0x9b, 0xe4, 0xf9, 0xff, 0xd1, 0x48, 0xb3,
+    0xf0, 0xc8, 0x93, 0xb5, 0x01, 0x8d, 0xd7, 0xc8, 0x8c, 0x93, 0x6c, 0x16, 0x83, 0x6c, 0x8b, 0x6c,
+    0x89, 0xcc, 0xb4, 0x48, 0x2d, 0xd9, 0x92, 0x66, 0x3c, 0x98, 0x67, 0xd8, 0x8b, 0x04, 0x58, 0x24,
+    0x58, 0x60, 0x81, 0xdc, 0xe6, 0x26, 0x17, 0xb9, 0xc8, 0x7d, 0xde, 0xc4, 0x2f, 0x90, 0x3c, 0x42,
+    0xbe, 0xaa, 0x6e, 0x76, 0x37, 0x25, 0x0d, 0x69, 0x27, 0x0b, 0xdb, 0xcd, 0xee, 0x3e, 0xe7, 0x54,
+    0xd5, 0xa9, 0x9f, 0xaf, 0xaa, 0x8e, 0xda, 0xc7, 0x9f, 0x7e, 0xf9, 0xcb, 0xd3, 0x57, 0xbf, 0xfa,
+    0xf6, 0xb9, 0x98, 0x56, 0x57, 0xe5, 0xd3, 0x4f, 0x8e, 0xeb, 0x1f, 0x21, 0x8e, 0xa7, 0x45, 0x3e,
+    0xa1, 0x1b, 0xdc, 0x5e, 0x15, 0x55, 0x2e, 0xc6, 0xd3, 0x7c, 0xb9, 0x2a, 0xaa, 0x93, 0xbd, 0x9b,
+    0xea, 0x62, 0x10, 0xf7, 0xc4, 0xa8, 0x3f, 0x38, 0xad, 0xaa, 0xeb, 0x41, 0xf1, 0xdb, 0x9b, 0xd9,
+    0xed, 0xc9, 0xde, 0xdf, 0x0e, 0xbe, 0xfb, 0x62, 0x70, 0xba, 0xb8, 0xba, 0xce, 0xab, 0xd9, 0x79,
+    0x59, 0xec, 0x89, 0xf1, 0x62, 0x5e, 0x15, 0x73, 0xac, 0xfc, 0xfa, 0xf9, 0x49, 0x31, 0xb9, 0x2c,
+    0xba, 0xb5, 0xd5, 0xac, 0x2a, 0x8b, 0xa7, 0xaf, 0xa6, 0x85, 0xf8, 0x72, 0x59, 0xe4, 0x57, 0xb3,
+    0xf9, 0xa5, 0x38, 0x2d, 0x17, 0xe3, 0x37, 0xc7, 0xa3, 0x7a, 0xa4, 0xc7, 0x61, 0x9e, 0x5f, 0x15,
+    0x27, 0x7b, 0xb7, 0xb3, 0xe2, 0xee, 0x7a, 0xb1, 0xac, 0x7a, 0x44, 0xef, 0x66, 0x93, 0x6a, 0x7a,
+    0x32, 0x29, 0x6e, 0x67, 0xe3, 0x62, 0xc0, 0x0f, 0x99, 0x98, 0xcd, 0x67, 0xd5, 0x2c, 0x2f, 0x07,
+    0xab, 0x71, 0x5e, 0x16, 0x27, 0xaa, 0x63, 0x58, 0xce, 0xe6, 0x6f, 0xc4, 0xb2, 0x28, 0x4f, 0xf6,
+    0x56, 0xd5, 0xbb, 0xb2, 0x58, 0x4d, 0x8b, 0x02, 0xb4, 0xa6, 0xcb, 0xe2, 0xa2, 0x79, 0x33, 0x1c,
+    0xaf, 0x56, 0x3f, 0xbf, 0x3d, 0x49, 0x17, 0xc9, 0xda, 0x71, 0xf2, 0x7e, 0x7c, 0x9e, 0xfb, 0xb1,
+    0xcb, 0x3b, 0x0a, 0x3c, 0xab, 0xbe, 0x17, 0x62, 0x78, 0xbd, 0x2c, 0x48, 0xa4, 0x01, 0x49, 0x93,
+    0xcf, 0xe6, 0xc5, 0x52, 0xbc, 0x6f, 0x86, 0x84, 0x38, 0xcf, 0xc7, 0x6f, 0x2e, 0x97, 0x8b, 0x9b,
+    0xf9, 0xe4, 0x48, 0x2c, 0x2f, 0xcf, 0xf3, 0x03, 0x99, 0x89, 0xe6, 0xdf, 0x61, 0x3c, 0x7c, 0xd2,
+    0xcd, 0x5b, 0x2c, 0x27, 0xc5, 0x72, 0xb0, 0xcc, 0x27, 0xb3, 0x9b, 0xd5, 0x91, 0x50, 0xfe, 0xfa,
+    0x6d, 0x37, 0x78, 0x9d, 0x4f, 0x26, 0x50, 0xcb, 0x91, 0xd0, 0xb2, 0xff, 0xfa, 0x2a, 0x5f, 0x5e,
+    0xce, 0xe6, 0xf5, 0x5b, 0x91, 0xdf, 0x54, 0x8b, 0xfe, 0xd0, 0xdb, 0x5a, 0x0d, 0x47, 0xc2, 0xc9,
+    0xde, 0xa2, 0x0f, 0xcd, 0xef, 0xcf, 0xc6, 0xa4, 0xe1, 0x41, 0x23, 0x79, 0x4f, 0xde, 0x66, 0x91,
+    0x92, 0xf2, 0xcf, 0x3b, 0x6a, 0xd3, 0x62, 0x76, 0x39, 0xad, 0x8e, 0x36, 0x78, 0xac, 0x29, 0x0d,
+    0x57, 0xc5, 0xe5, 0x15, 0x6c, 0xd0, 0xa3, 0x71, 0x31, 0x2b, 0xcb, 0x23, 0xf1, 0x33, 0xa5, 0x54,
+    0x47, 0xa2, 0x5a, 0xe6, 0xf3, 0x15, 0xec, 0xb1, 0x80, 0xbc, 0x34, 0x8e, 0xed, 0x4b, 0xb7, 0x12,
+    0x45, 0xbe, 0x2a, 0x1e, 0x50, 0xbc, 0x5b, 0x0d, 0x56, 0x55, 0x5e, 0xdd, 0xac, 0x7a, 0x34, 0xab,
+    0xe2, 0x6d, 0x35, 0xc8, 0xcb, 0xd9, 0x25, 0xd6, 0x8f, 0xc1, 0xae, 0x58, 0x76, 0xb4, 0x2f, 0xa0,
+    0xf7, 0xc1, 0x6a, 0xf6, 0x7d, 0x01, 0xb9, 0x75, 0x5f, 0x41, 0xe3, 0x45, 0xb9, 0x58, 0x42, 0x92,
+    0x18, 0xe3, 0x7d, 0xad, 0x0d, 0xaa, 0xc5, 0x35, 0x6d, 0xf3, 0xa1, 0x6a, 0x3a, 0xf6, 0x43, 0x18,
+    0x74, 0x5e, 0x8c, 0xab, 0x62, 0x22, 0xde, 0xb7, 0xb4, 0xec, 0x38, 0xbf, 0x70, 0xf2, 0xc9, 0x63,
+    0xd3, 0x27, 0xb3, 0xd5, 0x63, 0x2b, 0x2e, 0xac, 0x35, 0xc6, 0xaf, 0x57, 0x1c, 0x8f, 0x5a, 0xe7,
+    0x39, 0x1e, 0xad, 0xc3, 0xeb, 0xf8, 0x7c, 0x31, 0x79, 0xd7, 0xf8, 0xd6, 0x64, 0x76, 0x2b, 0xc6,
+    0x65, 0xbe, 0x5a, 0x9d, 0xec, 0xd5, 0x1b, 0xdd, 0x5b, 0x3b, 0xda, 0xf1, 0x54, 0x3d, 0xfd, 0xe1,
+    0x77, 0xff, 0x2e, 0x1e, 0x0b, 0x15, 0x0c, 0x7d, 0xb2, 0x9e, 0xf6, 0xe9, 0x60, 0x20, 0xce, 0x66,
+    0xb7, 0x85, 0xf8, 0xb6, 0x31, 0xef, 0x60, 0xd0, 0x92, 0xe8, 0x51, 0x7f, 0xe0, 0xb6, 0x2d, 0x23,
+    0xf2, 0xf0, 0xdb, 0x4b, 0x31, 0x9b, 0x40, 0x84, 0xbe, 0x9f, 0xec, 0x89, 0xb7, 0x57, 0xe5, 0x1c,
+    0x4b, 0x29, 0xd2, 0x8f, 0x46, 0xa3, 0xbb, 0xbb, 0xbb, 0xe1, 0x9d, 0x19, 0x2e, 0x96, 0x97, 0x23,
+    0x2d, 0xa5, 0x1c, 0x61, 0xd1, 0x9e, 0xb8, 0x2d, 0x96, 0x2b, 0x98, 0xf9, 0x64, 0x4f, 0x0d, 0x11,
+    0x73, 0xb4, 0xec, 0xd9, 0xe2, 0xed, 0xc9, 0x9e, 0x14, 0x52, 0x18, 0x1f, 0x9d, 0x50, 0x4e, 0xea,
+    0xa1, 0xed, 0xf1, 0x02, 0xb7, 0x9a, 0xd7, 0x64, 0x76, 0x39, 0xab, 0xcc, 0xc6, 0x08, 0xc6, 0xae,
+    0x17, 0xe5, 0xbb, 0xcb, 0xc5, 0x9c, 0x67, 0xc0, 0xd7, 0x74, 0xd8, 0x5b, 0x6f, 0xa0, 0xf1, 0xbc,
+    0x3d, 0x71, 0xbd, 0x98, 0xcd, 0x2b, 0xbc, 0x30, 0x26, 0xc8, 0xa1, 0x11, 0xde, 0x27, 0x5c, 0x8d,
+    0x55, 0x7e, 0x98, 0x44, 0x30, 0x01, 0xb7, 0xd1, 0xe2, 0xd6, 0x47, 0x85, 0xab, 0x71, 0xd6, 0x60,
+    0x58, 0x27, 0x3b, 0xa4, 0x91, 0x14, 0x86, 0x51, 0x68, 0x53, 0xaf, 0xd0, 0x8e, 0xde, 0x49, 0x8f,
+    0x57, 0x7d, 0x5a, 0x7b, 0xa3, 0x1d, 0x32, 0xf9, 0x2d, 0x32, 0x49, 0x4d, 0x5c, 0x35, 0xa8, 0x69,
+    0x30, 0x75, 0x61, 0x68, 0x85, 0x56, 0x86, 0xf9, 0x28, 0x85, 0x77, 0xca, 0x39, 0x92, 0xca, 0x5a,
+    0xd9, 0xde, 0x46, 0xe2, 0xdc, 0x4c, 0xb2, 0xca, 0x91, 0x80, 0xbc, 0xbc, 0x4f, 0x6b, 0xa7, 0x4c,
+    0xee, 0xe3, 0x32, 0xe9, 0x64, 0x02, 0xed, 0x2d, 0xd0, 0xae, 0x75, 0x0c, 0x66, 0xe8, 0xa1, 0x27,
+    0x85, 0xab, 0x8e, 0x5a, 0x83, 0xab, 0x0f, 0x9a, 0xa4, 0x8d, 0x50, 0x1b, 0xf1, 0x26, 0x6d, 0x19,
+    0x39, 0x74, 0xd0, 0x93, 0x21, 0xfe, 0x29, 0x91, 0x9c, 0x3a, 0xa6, 0xa1, 0x12, 0x7d, 0x5a, 0x3b,
+    0x65, 0xb2, 0xdb, 0x64, 0xb2, 0x0a, 0x74, 0xa2, 0x62, 0x3e, 0x31, 0x91, 0xc1, 0x82, 0x23, 0x61,
+    0x74, 0xf2, 0x0a, 0x4a, 0xf3, 0xc9, 0x93, 0x8d, 0x60, 0x31, 0x32, 0x65, 0xf3, 0x90, 0x48, 0x2d,
+    0xc1, 0x59, 0x08, 0x62, 0x8c, 0x0e, 0xf8, 0x69, 0x08, 0xf4, 0xa8, 0xed, 0x94, 0xca, 0x6c, 0xb1,
+    0x9e, 0x8e, 0xc4, 0x48, 0x69, 0x19, 0xa0, 0x1d, 0x03, 0x1e, 0x60, 0xae, 0x74, 0x70, 0xec, 0x2e,
+    0x52, 0xf2, 0x93, 0x96, 0xfc, 0xe4, 0x99, 0xa3, 0x51, 0x6b, 0x9b, 0x05, 0xcc, 0xa2, 0x35, 0x96,
+    0xec, 0x18, 0x71, 0xc5, 0x48, 0x9f, 0xdc, 0x4e, 0xb9, 0xf4, 0x16, 0x6d, 0x45, 0x47, 0x5a, 0x57,
+    0xf0, 0x15, 0xb6, 0x84, 0xb2, 0xe4, 0x49, 0x3a, 0x69, 0xf2, 0xae, 0x18, 0xc8, 0xc9, 0x94, 0x36,
+    0xec, 0xe1, 0xda, 0x3b, 0x96, 0xb2, 0x7e, 0x22, 0xe7, 0x36, 0xeb, 0x99, 0x46, 0xb3, 0x54, 0x2d,
+    0x95, 0x1e, 0xcd, 0x9d, 0xc2, 0xa9, 0xad, 0xc2, 0x19, 0x66, 0xa2, 0x48, 0x69, 0x3a, 0x24, 0xf2,
+    0x2f, 0xa5, 0x7d, 0x62, 0xdf, 0x35, 0x11, 0x72, 0x60, 0x4c, 0xb2, 0xbb, 0x41, 0x85, 0xb0, 0x99,
+    0x36, 0x6c, 0x74, 0xf8, 0x75, 0x80, 0xda, 0x34, 0x87, 0xa7, 0x22, 0x57, 0x8b, 0xb0, 0x29, 0x8d,
+    0xf4, 0x08, 0x6e, 0x4a, 0x76, 0x3c, 0xba, 0xfc, 0x18, 0x92, 0xe8, 0x5d, 0x48, 0x22, 0xb7, 0x6c,
+    0xc1, 0x2b, 0xdf, 0xe0, 0x88, 0xf6, 0x9e, 0xbc, 0x90, 0x70, 0x04, 0xc2, 0x93, 0x84, 0x35, 0x8e,
+    0xe8, 0xd0, 0xf8, 0x3f, 0xe9, 0x55, 0x07, 0x4b, 0x9b, 0xac, 0x71, 0x44, 0xfb, 0xa0, 0x20, 0x75,
+    0x8d, 0x23, 0x1d, 0xa5, 0x5d, 0x2a, 0x55, 0x69, 0x8b, 0x3c, 0xa0, 0xc9, 0x6c, 0x18, 0x45, 0xb4,
+    0x34, 0xf4, 0xc3, 0x00, 0xa1, 0xb5, 0x0b, 0x0d, 0x70, 0x68, 0xc0, 0x2b, 0x38, 0x36, 0x0f, 0x41,
+    0x7b, 0x12, 0xaf, 0x9e, 0xe4, 0x3d, 0x47, 0x77, 0xb3, 0xbc, 0xa3, 0xb5, 0x53, 0xa6, 0xb8, 0x45,
+    0x26, 0x15, 0xc9, 0x7b, 0x1a, 0x14, 0x51, 0x8a, 0x7e, 0x1a, 0x14, 0x91, 0x3e, 0x42, 0x01, 0x0d,
+    0x8a, 0x28, 0xc3, 0xa6, 0x26, 0x14, 0x51, 0x81, 0xbc, 0xaf, 0x41, 0x11, 0x8d, 0x10, 0x0d, 0x6b,
+    0x14, 0xe9, 0xd1, 0xda, 0x29, 0x53, 0xd8, 0x2a, 0x53, 0x0f, 0x04, 0x94, 0x65, 0x87, 0xaa, 0x51,
+    0x84, 0x62, 0x4e, 0x37, 0xc0, 0xa1, 0x5d, 0x22, 0xa4, 0x6f, 0x1e, 0xbc, 0xf1, 0x0d, 0x86, 0x40,
+    0x97, 0x1a, 0x1a, 0x5c, 0x2f, 0xef, 0x68, 0xed, 0x94, 0x69, 0x4b, 0x06, 0xd0, 0x0e, 0xa8, 0xa1,
+    0xd6, 0x18, 0x02, 0x16, 0x91, 0xc3, 0x81, 0x31, 0x44, 0x7b, 0xeb, 0x39, 0x1c, 0x18, 0x43, 0x60,
+    0x12, 0xe6, 0x08, 0x0c, 0x69, 0x2c, 0x56, 0x63, 0x88, 0x76, 0x50, 0x92, 0x6b, 0x30, 0x64, 0x83,
+    0xdc, 0x4e, 0xb9, 0xb6, 0x65, 0x01, 0x25, 0x3b, 0x04, 0x91, 0x5e, 0xb6, 0xf8, 0x01, 0xac, 0x60,
+    0x34, 0x61, 0xc4, 0xd0, 0x4e, 0x29, 0x96, 0xb0, 0x79, 0x72, 0x1d, 0xce, 0xd8, 0x48, 0x4b, 0xd7,
+    0x14, 0x3a, 0x6a, 0x3b, 0x85, 0xda, 0x96, 0x06, 0x64, 0x4a, 0x2d, 0x72, 0x48, 0x84, 0x93, 0x5d,
+    0x23, 0x87, 0x4a, 0xc8, 0x46, 0xae, 0x45, 0x0e, 0x69, 0x1d, 0xe3, 0x03, 0x23, 0x87, 0x42, 0xaa,
+    0x77, 0x6b, 0xe4, 0x50, 0x2e, 0x61, 0x42, 0x83, 0x1c, 0x1d, 0xb9, 0x1f, 0x83, 0x1b, 0x54, 0xb2,
+    0xcd, 0x1f, 0xc0, 0x46, 0x5e, 0x4d, 0x5b, 0xcc, 0x88, 0xe7, 0x0f, 0x65, 0xc7, 0xd0, 0x0b, 0x15,
+    0x51, 0xd5, 0x84, 0x4c, 0x49, 0x44, 0x55, 0x1a, 0x83, 0xb7, 0xcd, 0x64, 0x86, 0x54, 0x15, 0x06,
+    0x48, 0xa8, 0xba, 0xbe, 0xa3, 0xcb, 0x8a, 0x9e, 0xcd, 0xa0, 0x7d, 0xee, 0x2e, 0x19, 0x4d, 0xac,
+    0xef, 0xda, 0xc7, 0xac, 0x7b, 0xa4, 0xcb, 0xdf, 0x3d, 0xd4, 0xec, 0x86, 0x6c, 0x1f, 0x13, 0x0d,
+    0xb1, 0xa5, 0x33, 0x47, 0x61, 0x78, 0x5f, 0x32, 0xf3, 0x63, 0x25, 0x33, 0x3f, 0x49, 0xb2, 0x2d,
+    0xa8, 0xac, 0x76, 0xa0, 0xb2, 0xda, 0x92, 0x8d, 0x95, 0x63, 0xa3, 0xd6, 0xb8, 0xac, 0x5c, 0xa0,
+    0x90, 0x25, 0x5c, 0x56, 0xde, 0x52, 0x48, 0xd4, 0xb8, 0xac, 0x82, 0x6c, 0x2a, 0x00, 0x72, 0x5b,
+    0xef, 0x5c, 0x83, 0xca, 0xca, 0x45, 0xd3, 0x60, 0x72, 0x9f, 0xce, 0x4e, 0x67, 0xdd, 0x92, 0x85,
+    0x95, 0x0a, 0x0c, 0x5e, 0x0c, 0xab, 0x68, 0x77, 0x2c, 0x39, 0x26, 0x03, 0x2e, 0x1c, 0x32, 0x92,
+    0xeb, 0x32, 0x14, 0xc3, 0x21, 0x43, 0x5b, 0xe8, 0x29, 0x6f, 0x42, 0x37, 0xcd, 0x05, 0xd3, 0x2e,
+    0xef, 0x68, 0xed, 0x94, 0x69, 0x4b, 0xf2, 0x55, 0x32, 0x59, 0xc6, 0x5e, 0xde, 0xb3, 0x84, 0xd1,
+    0x63, 0x83, 0xca, 0x29, 0xca, 0x06, 0x92, 0x95, 0xb4, 0x9a, 0x01, 0x59, 0xc9, 0xc8, 0xa9, 0x80,
+    0x01, 0x59, 0x29, 0xc7, 0xf8, 0xc2, 0x80, 0xdc, 0x27, 0xb3, 0x53, 0x1c, 0xb9, 0x55, 0x1c, 0x4a,
+    0x05, 0x35, 0xa2, 0x2a, 0xe9, 0xc8, 0x4e, 0x35, 0x20, 0x43, 0x5f, 0xb1, 0xc5, 0x60, 0x34, 0x05,
+    0x1d, 0x3a, 0x2b, 0x67, 0xc9, 0x3c, 0x35, 0x24, 0x2b, 0xaa, 0xdd, 0x4d, 0x4b, 0xa0, 0xa3, 0xb6,
+    0x4b, 0xaa, 0x2d, 0xd9, 0x54, 0xa1, 0x23, 0x63, 0x28, 0x61, 0x44, 0x56, 0x36, 0x49, 0x06, 0x54,
+    0x46, 0x64, 0x58, 0x29, 0xf2, 0x13, 0x23, 0xb2, 0xf2, 0x8a, 0x19, 0x02, 0x91, 0xd9, 0x56, 0x35,
+    0x1e, 0x43, 0x5a, 0xaa, 0xfc, 0x6a, 0x3c, 0xde, 0x20, 0xb6, 0x4b, 0xa8, 0xb8, 0x4d, 0x53, 0x8a,
+    0xf1, 0xad, 0x86, 0xd3, 0xc4, 0x25, 0x44, 0x83, 0xb4, 0x30, 0xa3, 0xe5, 0x9c, 0xc1, 0x18, 0xac,
+    0xac, 0x66, 0xbe, 0xeb, 0x27, 0x6f, 0x7a, 0x33, 0xa9, 0x26, 0x6d, 0x51, 0x7d, 0x83, 0xe4, 0x2e,
+    0xd1, 0xc2, 0x56, 0xd1, 0x64, 0x0d, 0xbd, 0xa4, 0xaf, 0xe4, 0xc8, 0xa7, 0x1a, 0x54, 0x8e, 0xc9,
+    0xaf, 0x21, 0x39, 0x71, 0xf9, 0x58, 0x23, 0xb2, 0x92, 0x88, 0xb0, 0xd4, 0x20, 0x32, 0x40, 0x51,
+    0x71, 0x95, 0x17, 0x78, 0xa4, 0x47, 0xeb, 0x47, 0xa3, 0x86, 0xdc, 0x81, 0x1a, 0x5b, 0xd2, 0x6f,
+    0x08, 0xa6, 0xed, 0x09, 0xa3, 0x4a, 0x4d, 0x4b, 0x18, 0x63, 0x68, 0x3b, 0xc2, 0x64, 0x7d, 0xdb,
+    0x10, 0x26, 0x29, 0xdb, 0x7e, 0x30, 0xea, 0xd8, 0xb6, 0x83, 0x3d, 0x2a, 0xbb, 0x14, 0xb9, 0x25,
+    0xe5, 0x5a, 0x6d, 0xdb, 0x5e, 0xd0, 0x78, 0xd9, 0xb6, 0x82, 0xb6, 0xae, 0xdf, 0x19, 0x20, 0xe0,
+    0x55, 0xeb, 0xbb, 0x68, 0xda, 0x3e, 0x30, 0xc2, 0x0f, 0xd7, 0x6d, 0x60, 0x8f, 0xca, 0x2e, 0x59,
+    0xb6, 0x64, 0x5a, 0xb4, 0x2f, 0x5d, 0x0f, 0x88, 0xba, 0xac, 0x6d, 0x01, 0x35, 0x15, 0x91, 0xeb,
+    0x0e, 0x30, 0x34, 0x0d, 0x20, 0x5a, 0x9f, 0xb6, 0xff, 0x33, 0x29, 0xb6, 0xed, 0x5f, 0x8f, 0xca,
+    0x2e, 0x59, 0xb6, 0xb5, 0x59, 0xb6, 0x8b, 0x71, 0x9d, 0x42, 0xdb, 0xfa, 0x19, 0x6f, 0xdb, 0xce,
+    0x8f, 0xde, 0xac, 0x1b, 0x3f, 0x6a, 0x29, 0x4c, 0x03, 0x10, 0x54, 0x93, 0xaf, 0x2b, 0xbe, 0x1e,
+    0x9d, 0x9d, 0x0d, 0xcc, 0xc7, 0xa5, 0xf1, 0x31, 0x75, 0x3d, 0x5f, 0x30, 0xae, 0x6b, 0xf9, 0xa2,
+    0x34, 0x5d, 0xc7, 0x17, 0x59, 0x38, 0x82, 0x86, 0xda, 0x38, 0x35, 0x36, 0x04, 0x4b, 0xee, 0x52,
+    0x43, 0x43, 0x9f, 0xd0, 0x4e, 0x10, 0xdd, 0xd6, 0x8c, 0xf4, 0x62, 0x9a, 0xe2, 0xc6, 0x74, 0xad,
+    0x9e, 0xec, 0x3a, 0x3d, 0xef, 0x63, 0xd7, 0xe8, 0x05, 0x99, 0xba, 0x69, 0x54, 0x64, 0x76, 0x6d,
+    0x5e, 0x8f, 0xda, 0x2e, 0xa1, 0xb6, 0x75, 0x48, 0xce, 0x77, 0x3d, 0x9e, 0x4a, 0xbe, 0x6b, 0xf1,
+    0x94, 0x55, 0xbd, 0x0e, 0x4f, 0x9a, 0xae, 0xc1, 0x0b, 0xa6, 0xed, 0xef, 0x0c, 0x1f, 0xce, 0x34,
+    0x45, 0x5a, 0x8f, 0xd4, 0x16, 0x44, 0x38, 0xa6, 0xf3, 0xa5, 0xde, 0x23, 0x1d, 0x65, 0x91, 0x9c,
+    0xed, 0x01, 0x5c, 0x2b, 0x6c, 0x77, 0x80, 0xd8, 0x3f, 0x92, 0xdb, 0x7b, 0xfa, 0xc3, 0xbf, 0xfc,
+    0x9b, 0x38, 0xad, 0x1f, 0x67, 0xf3, 0xcb, 0xe1, 0x70, 0x78, 0x3c, 0x02, 0x91, 0xf6, 0x6c, 0xac,
+    0x7e, 0xf8, 0xa4, 0x3b, 0x01, 0xeb, 0x0e, 0x12, 0x6b, 0xba, 0xe7, 0x37, 0x55, 0x85, 0xfa, 0xb0,
+    0x7d, 0xbd, 0x98, 0x8f, 0xcb, 0xd9, 0xf8, 0x0d, 0x18, 0xe6, 0x6f, 0x8a, 0x9b, 0xeb, 0x83, 0xc3,
+    0x6e, 0x68, 0xf7, 0x41, 0xd9, 0xe6, 0xd4, 0xa3, 0xb7, 0x74, 0x2a, 0xfd, 0xd8, 0x02, 0x95, 0x52,
+    0x1a, 0xf1, 0x68, 0xb7, 0x64, 0xe3, 0x8c, 0xad, 0x23, 0x74, 0xb2, 0x27, 0xaf, 0xdf, 0x76, 0xcf,
+    0xef, 0xee, 0x3d, 0x6f, 0x9c, 0xc5, 0x29, 0xc9, 0xff, 0x75, 0xa3, 0xc5, 0x3c, 0x3f, 0x2f, 0x8b,
+    0x41, 0x77, 0x60, 0x7d, 0xb2, 0x37, 0x2f, 0xee, 0xc4, 0xa3, 0x73, 0xe9, 0x04, 0x17, 0xbb, 0x9e,
+    0xce, 0xaa, 0x62, 0x63, 0x1f, 0x47, 0xab, 0xeb, 0x7c, 0x5c, 0xf0, 0xd1, 0xe2, 0xaa, 0x58, 0xde,
+    0xb6, 0x83, 0x3d, 0xab, 0x51, 0xc5, 0xda, 0xb3, 0x30, 0x15, 0xa8, 0xf0, 0x17, 0x24, 0xb1, 0x0c,
+    0xce, 0xa3, 0xbd, 0x1e, 0x23, 0x9a, 0xb5, 0x19, 0x00, 0x85, 0xad, 0xcb, 0x80, 0x70, 0x32, 0x0d,
+    0x80, 0x4a, 0x49, 0xd1, 0xbd, 0x8e, 0x03, 0x3d, 0x74, 0xc6, 0x60, 0x8e, 0x94, 0x1e, 0x73, 0xe0,
+    0x70, 0xb8, 0xca, 0x14, 0x70, 0x75, 0x9a, 0xee, 0x75, 0x74, 0xb8, 0x06, 0xad, 0x61, 0x34, 0xdc,
+    0xa0, 0xf6, 0xa5, 0x6b, 0xd2, 0xb8, 0x5a, 0x4b, 0x43, 0x46, 0x2a, 0x9a, 0xa0, 0x9a, 0xfb, 0xaf,
+    0xd0, 0x7e, 0x69, 0x45, 0x53, 0x75, 0xc8, 0x24, 0x93, 0xc1, 0xef, 0x10, 0x85, 0x51, 0x3d, 0x2b,
+    0xe3, 0x59, 0x0d, 0xa9, 0x6c, 0x4d, 0x4a, 0xb3, 0x3c, 0xd6, 0x99, 0x9a, 0x63, 0xb6, 0xe6, 0x48,
+    0xb3, 0x32, 0x40, 0xa6, 0x0a, 0x99, 0x1b, 0x22, 0xf9, 0x66, 0xf0, 0x72, 0xa9, 0x4d, 0x86, 0x16,
+    0xca, 0xf8, 0x98, 0x21, 0xfb, 0xa0, 0xce, 0xb9, 0x05, 0xb2, 0xfa, 0xb1, 0xc4, 0x22, 0xe7, 0x0c,
+    0x91, 0xb1, 0xe8, 0x1b, 0xe8, 0x9f, 0xaf, 0x34, 0x10, 0x95, 0x36, 0xc7, 0xef, 0x33, 0x35, 0x68,
+    0xc6, 0x06, 0xea, 0xaf, 0xe9, 0xd8, 0xc8, 0x82, 0x81, 0x1e, 0x4a, 0x6f, 0xa1, 0x10, 0x99, 0x7c,
+    0x06, 0x28, 0xf2, 0xa4, 0x10, 0x1f, 0x89, 0x9b, 0xc7, 0x8e, 0x50, 0x24, 0xc8, 0x84, 0xf5, 0x91,
+    0xb6, 0xe0, 0x83, 0xcb, 0x90, 0xdd, 0x9c, 0xc6, 0x55, 0x61, 0xb2, 0xa2, 0x47, 0xcd, 0xf4, 0xb5,
+    0xf6, 0x98, 0x20, 0x75, 0xb3, 0x09, 0xba, 0x37, 0x9a, 0x96, 0x44, 0x5d, 0xdf, 0x83, 0x13, 0x2d,
+    0x4d, 0x90, 0x02, 0x5c, 0x12, 0xab, 0x34, 0x68, 0xe2, 0x12, 0x15, 0x38, 0xaa, 0x60, 0x30, 0xee,
+    0xb5, 0x83, 0x24, 0xc6, 0xfa, 0x0c, 0x50, 0x6d, 0xed, 0x00, 0x2c, 0xb0, 0x7b, 0x62, 0xa4, 0x20,
+    0x49, 0x22, 0x41, 0xac, 0xf6, 0x98, 0x92, 0x98, 0x9b, 0x51, 0x98, 0x11, 0x52, 0xc4, 0x0b, 0xa5,
+    0x06, 0x0e, 0x44, 0xbc, 0x10, 0xa7, 0xd4, 0xc5, 0x61, 0x15, 0x41, 0x97, 0xb7, 0x19, 0x1d, 0xa2,
+    0x78, 0x4f, 0x4f, 0x36, 0xa5, 0x6c, 0xc3, 0x2f, 0xbe, 0x17, 0x2f, 0xa0, 0x3e, 0x19, 0x53, 0x86,
+    0x9c, 0x64, 0x93, 0xbb, 0x25, 0x99, 0xfc, 0x14, 0xaf, 0xac, 0xba, 0xa5, 0xdb, 0xaf, 0xea, 0x61,
+    0xcc, 0x43, 0xda, 0x4e, 0x12, 0xf3, 0x80, 0x83, 0xc6, 0x7d, 0x45, 0x05, 0x9c, 0x64, 0x77, 0x80,
+    0xf8, 0x9a, 0xc4, 0x8f, 0x0a, 0x52, 0xc1, 0x54, 0x81, 0xaf, 0x52, 0xd3, 0x4f, 0x80, 0xf7, 0x00,
+    0x7f, 0xa4, 0x4e, 0x53, 0x64, 0xc1, 0xe8, 0xdd, 0x29, 0x4a, 0x00, 0x19, 0x52, 0x86, 0x26, 0xc3,
+    0xeb, 0x94, 0x01, 0x54, 0xe1, 0x60, 0x19, 0xd5, 0x0b, 0x30, 0xeb, 0x06, 0x07, 0x70, 0x04, 0xbe,
+    0x92, 0x1e, 0x29, 0x47, 0xc4, 0x50, 0x7b, 0x9e, 0x51, 0xa4, 0x78, 0x6b, 0x78, 0xbf, 0x90, 0x9a,
+    0xd8, 0x1a, 0x30, 0xb7, 0xc1, 0x40, 0x47, 0x31, 0xb8, 0x31, 0x06, 0x6c, 0x88, 0x64, 0x14, 0xf8,
+    0x35, 0x3a, 0x34, 0x0f, 0x53, 0x93, 0xd7, 0x43, 0x79, 0x31, 0xd1, 0x7b, 0xa4, 0x0f, 0xa2, 0x14,
+    0x35, 0x79, 0x82, 0x0c, 0x10, 0x17, 0xce, 0x6f, 0x89, 0xb6, 0x25, 0xbb, 0x93, 0xe4, 0x10, 0x3c,
+    0x46, 0xb6, 0x56, 0x54, 0xb4, 0x35, 0x27, 0xd9, 0x02, 0x29, 0x61, 0xb3, 0x56, 0x93, 0xf1, 0x10,
+    0x0f, 0xd0, 0xa6, 0xc5, 0x8c, 0xe0, 0x89, 0x82, 0x32, 0xe4, 0x39, 0xc1, 0x1a, 0xf2, 0xa2, 0x08,
+    0x95, 0xc3, 0x26, 0x64, 0x75, 0xb8, 0xf7, 0x29, 0x6d, 0x03, 0x7a, 0xa7, 0x33, 0x10, 0xe9, 0x33,
+    0x3a, 0x99, 0x80, 0x71, 0xa1, 0x00, 0x69, 0xb3, 0x8d, 0x1d, 0x7e, 0xdf, 0x05, 0xfd, 0x68, 0x7b,
+    0x68, 0x27, 0xcc, 0x87, 0x0b, 0x7b, 0xb2, 0x7c, 0x28, 0x07, 0x0a, 0xda, 0x40, 0xd2, 0xf4, 0xaa,
+    0x1c, 0xd4, 0x52, 0x42, 0xab, 0x4a, 0x97, 0x14, 0xe1, 0x81, 0x1c, 0x28, 0x85, 0x30, 0x46, 0x12,
+    0x80, 0x65, 0x90, 0x50, 0x15, 0x14, 0x8c, 0xd5, 0x50, 0x1a, 0xf6, 0xed, 0x2c, 0x2b, 0x64, 0x60,
+    0xd8, 0x87, 0x9b, 0xe0, 0x76, 0x1c, 0x8b, 0xac, 0x1e, 0x13, 0x09, 0x0f, 0x4c, 0xa0, 0x7b, 0x6f,
+    0x09, 0x09, 0xac, 0x0a, 0x1c, 0xd6, 0x9e, 0xbc, 0x57, 0xd2, 0xc5, 0x19, 0x8a, 0x54, 0x84, 0x25,
+    0xa9, 0xcd, 0xf1, 0xa6, 0x7d, 0x3a, 0xf3, 0x9a, 0xf6, 0x47, 0xe9, 0x28, 0x5a, 0x5a, 0xe0, 0x98,
+    0x2a, 0xa1, 0x09, 0x58, 0x19, 0x42, 0x96, 0xa4, 0x34, 0x79, 0x71, 0x22, 0x5f, 0x96, 0x3e, 0x11,
+    0x73, 0xe8, 0xb1, 0x06, 0x20, 0x8d, 0x36, 0x1a, 0xd0, 0xa1, 0x98, 0x70, 0xe0, 0x5d, 0x59, 0x0e,
+    0x3e, 0x6c, 0x11, 0x4e, 0x02, 0x63, 0x7b, 0x92, 0xaa, 0x24, 0xdb, 0x24, 0x72, 0x7b, 0x78, 0x18,
+    0xcb, 0x6e, 0x18, 0x3b, 0x5c, 0x64, 0xa9, 0x5b, 0x74, 0xf2, 0x35, 0x73, 0x65, 0xeb, 0x1d, 0xea,
+    0xc8, 0xa6, 0xf7, 0x34, 0xcb, 0x05, 0xc6, 0x3a, 0x45, 0x13, 0xa2, 0x22, 0x26, 0xca, 0xf9, 0x12,
+    0x14, 0x01, 0x29, 0x64, 0x68, 0xe9, 0x79, 0x85, 0xf1, 0xbc, 0xaf, 0xc0, 0x3a, 0x49, 0x14, 0xe0,
+    0xa6, 0x56, 0x06, 0x81, 0x94, 0x8a, 0x2b, 0x22, 0x47, 0xaf, 0x5d, 0x60, 0x78, 0xe5, 0xfb, 0x10,
+    0x5d, 0x09, 0x9f, 0x84, 0x1f, 0xa0, 0xa0, 0x52, 0x4a, 0x88, 0x33, 0xa8, 0xd9, 0x90, 0xcf, 0x07,
+    0xcd, 0x4a, 0x64, 0x28, 0x36, 0x2a, 0xb1, 0x7a, 0x88, 0x41, 0xb2, 0xb6, 0x61, 0x86, 0x89, 0xc9,
+    0x11, 0xf0, 0x25, 0xa6, 0x17, 0x48, 0x30, 0x27, 0x19, 0xd7, 0x18, 0x5f, 0x10, 0x6c, 0xf5, 0x3d,
+    0xe1, 0x4e, 0x46, 0xa8, 0x67, 0xd9, 0x6f, 0xa5, 0x67, 0x21, 0x18, 0x9e, 0xc1, 0x1e, 0x45, 0xa7,
+    0x03, 0x9c, 0xa0, 0xf5, 0xb2, 0x8a, 0x81, 0xd4, 0xf2, 0x90, 0x21, 0xb3, 0x4b, 0xc7, 0x0a, 0xf2,
+    0x8a, 0x5c, 0x80, 0xf5, 0x06, 0xaf, 0x20, 0x72, 0x9e, 0xd5, 0xee, 0x6a, 0x96, 0x8a, 0x35, 0xc2,
+    0xdb, 0x61, 0x96, 0xe6, 0x8c, 0x0e, 0xeb, 0x29, 0x1e, 0xe0, 0x51, 0x56, 0xd3, 0x36, 0xa4, 0xa4,
+    0xa9, 0x52, 0x1a, 0xbe, 0x67, 0x54, 0x62, 0x9c, 0x97, 0xb5, 0xf9, 0xc0, 0xb8, 0x24, 0xe4, 0xb2,
+    0x16, 0xfa, 0x84, 0x56, 0x39, 0x8c, 0x25, 0xa1, 0xbe, 0x56, 0x91, 0x25, 0x20, 0x25, 0x92, 0x19,
+    0x49, 0xa1, 0xb4, 0x26, 0x79, 0xce, 0x45, 0xac, 0x12, 0x13, 0x0c, 0x2b, 0xc9, 0x33, 0x90, 0xda,
+    0x06, 0x81, 0xa1, 0x00, 0xa9, 0x4b, 0x2a, 0xe1, 0x5d, 0x80, 0x76, 0x9d, 0x4b, 0xa5, 0x02, 0x08,
+    0x20, 0x7f, 0xd0, 0x1f, 0x7f, 0x52, 0x2a, 0xe9, 0x68, 0x86, 0xa3, 0x00, 0xcc, 0x21, 0x28, 0x02,
+    0x5f, 0x53, 0xa8, 0x12, 0x7a, 0x2a, 0x16, 0x57, 0x33, 0x7c, 0x1a, 0x4b, 0xfc, 0x9c, 0x26, 0x8a,
+    0x9e, 0xef, 0x39, 0x55, 0xca, 0x94, 0x6a, 0x6c, 0xcd, 0x58, 0xbb, 0xf0, 0xe4, 0xc0, 0x19, 0xab,
+    0xb9, 0x27, 0x25, 0x49, 0xd7, 0x68, 0x3d, 0xb0, 0xd6, 0x4d, 0x5f, 0xed, 0x67, 0x14, 0x9f, 0x99,
+    0xc7, 0x25, 0x19, 0xd6, 0x3a, 0x4a, 0x31, 0x1e, 0xa1, 0xf5, 0x96, 0x5d, 0xcd, 0x06, 0xbe, 0xd7,
+    0x35, 0xd6, 0xb8, 0x53, 0x3a, 0x38, 0x05, 0x10, 0xa2, 0xf6, 0xd5, 0xc9, 0x64, 0x78, 0x72, 0x70,
+    0x1b, 0x4f, 0x59, 0x82, 0x9f, 0xba, 0x68, 0x27, 0x58, 0x24, 0xb6, 0x91, 0xce, 0x8b, 0xac, 0x55,
+    0xd8, 0xa9, 0xe7, 0x68, 0x41, 0x1f, 0x5d, 0x6a, 0xf6, 0x17, 0x4b, 0x01, 0x40, 0x4a, 0xd7, 0x9c,
+    0x76, 0xb1, 0xef, 0x64, 0xcf, 0x36, 0x16, 0x81, 0x08, 0x7a, 0x47, 0x13, 0x4d, 0x86, 0x5a, 0x3f,
+    0x79, 0x68, 0x12, 0x1e, 0x0a, 0xa7, 0x23, 0x88, 0x24, 0x3c, 0x21, 0x34, 0x08, 0xc8, 0xb8, 0x89,
+    0x42, 0x01, 0x15, 0x2f, 0x36, 0x06, 0x1f, 0x42, 0x6b, 0x72, 0xb6, 0xb1, 0x0c, 0x64, 0xd0, 0xd5,
+    0x07, 0x28, 0x8b, 0xfe, 0x94, 0x64, 0xfc, 0x19, 0x2a, 0x4e, 0x38, 0x0f, 0xde, 0x19, 0x07, 0xfe,
+    0x08, 0x7e, 0xab, 0x89, 0x18, 0x0a, 0x65, 0x12, 0x2d, 0x12, 0x88, 0xca, 0x88, 0x69, 0xfd, 0x45,
+    0x20, 0xe2, 0x6b, 0xef, 0x80, 0x6c, 0xc9, 0xd9, 0x12, 0x91, 0x0d, 0x57, 0x02, 0x9e, 0x05, 0xa0,
+    0xab, 0x43, 0xde, 0x72, 0x9c, 0x9f, 0x08, 0x30, 0x90, 0xf2, 0xc9, 0x0f, 0x29, 0x55, 0x23, 0x35,
+    0x66, 0x0a, 0x8a, 0x91, 0xf6, 0x6c, 0x63, 0xf9, 0xf7, 0x80, 0xc8, 0x17, 0x80, 0x5a, 0x09, 0x54,
+    0x42, 0xdb, 0x82, 0x6c, 0x4b, 0xa0, 0x88, 0x98, 0x21, 0x3c, 0x09, 0x24, 0xa1, 0x82, 0xb1, 0x50,
+    0x38, 0x7b, 0x69, 0x4a, 0xc7, 0x75, 0x0b, 0xf4, 0xea, 0xcf, 0x36, 0x96, 0x90, 0x4c, 0xb0, 0x17,
+    0x94, 0x4e, 0x7f, 0x21, 0x49, 0x67, 0x56, 0xb3, 0x33, 0x18, 0xd6, 0x35, 0x7b, 0x5a, 0x64, 0x2c,
+    0x75, 0xe1, 0xcc, 0x07, 0x2a, 0x4e, 0x50, 0xf5, 0x5b, 0xca, 0x86, 0x67, 0xfd, 0x65, 0xb5, 0xa9,
+    0x00, 0xa1, 0x1c, 0xf2, 0xc9, 0x94, 0x14, 0x87, 0xa4, 0xe6, 0x04, 0x86, 0x86, 0xc5, 0x92, 0x89,
+    0xe5, 0xf2, 0x67, 0xc6, 0x71, 0xda, 0x30, 0x91, 0x30, 0xf9, 0x6c, 0x63, 0x19, 0x19, 0x0b, 0x7a,
+    0xf3, 0x8e, 0x7c, 0x1b, 0xf5, 0x08, 0x3c, 0x0a, 0x72, 0x3b, 0x82, 0x71, 0x87, 0xf5, 0x98, 0x43,
+    0xd5, 0x0c, 0xac, 0x64, 0x28, 0xf9, 0x50, 0x6a, 0xa7, 0xbf, 0xd8, 0x79, 0x82, 0x7f, 0xe5, 0x28,
+    0x37, 0x06, 0x93, 0xc6, 0xc0, 0x21, 0xeb, 0x29, 0x55, 0x7b, 0x8a, 0x97, 0x40, 0xa9, 0x9a, 0x6c,
+    0x41, 0xdc, 0x0d, 0x20, 0x39, 0x51, 0x86, 0x62, 0x00, 0x55, 0x8c, 0x8f, 0x8c, 0x73, 0x8c, 0xf7,
+    0x8e, 0x43, 0xd9, 0x33, 0x30, 0xb9, 0xd4, 0x64, 0x61, 0xcd, 0xb5, 0x8b, 0xa4, 0x71, 0xcf, 0x25,
+    0x9f, 0x34, 0xe4, 0xe0, 0x91, 0x23, 0x59, 0x59, 0xa4, 0x1e, 0xca, 0xf9, 0x50, 0x0b, 0x25, 0x4a,
+    0x12, 0x84, 0xb2, 0x03, 0xb4, 0x26, 0xe1, 0x40, 0xfd, 0xad, 0x60, 0x6b, 0xf4, 0xa7, 0x1f, 0x94,
+    0x72, 0x96, 0xbc, 0x24, 0xc0, 0x4b, 0x50, 0x93, 0x52, 0x56, 0x90, 0xb1, 0x84, 0x33, 0x46, 0x72,
+    0x66, 0xab, 0x12, 0x41, 0x67, 0x7f, 0x1e, 0xd9, 0x07, 0xfd, 0x20, 0x10, 0x9a, 0xfe, 0xbe, 0x81,
+    0x75, 0xc4, 0x0f, 0xf5, 0x11, 0x9d, 0x43, 0x18, 0x0a, 0x7e, 0x67, 0x89, 0x1f, 0x00, 0xbf, 0x64,
+    0xef, 0xcd, 0x1a, 0xef, 0xdd, 0x58, 0x04, 0x22, 0xf4, 0x97, 0x08, 0x60, 0x06, 0x0a, 0x23, 0xb0,
+    0x2d, 0x07, 0x1c, 0x05, 0x83, 0x26, 0x0a, 0x7a, 0x44, 0x1a, 0x5f, 0x46, 0xfd, 0x07, 0xa5, 0x69,
+    0xeb, 0xcf, 0x36, 0xd6, 0xfd, 0xf8, 0xb4, 0x8d, 0x4a, 0x28, 0x19, 0x54, 0x65, 0x84, 0x7c, 0xea,
+    0xb1, 0x82, 0x74, 0x2c, 0xb1, 0x11, 0x4b, 0x95, 0x84, 0x01, 0x38, 0x43, 0x10, 0x93, 0x42, 0x86,
+    0x3a, 0x8d, 0x32, 0x25, 0xea, 0x26, 0x63, 0x09, 0xc1, 0xd7, 0x50, 0xcd, 0xf0, 0x4c, 0x6a, 0x4f,
+    0xa1, 0x4e, 0xba, 0x6c, 0x7e, 0x09, 0xff, 0x58, 0xd5, 0x2f, 0xd9, 0x7a, 0xa1, 0x7e, 0x39, 0xe0,
+    0x09, 0xe3, 0x01, 0x82, 0xcb, 0x70, 0x44, 0x21, 0xeb, 0x40, 0x59, 0xe0, 0x4a, 0x20, 0x11, 0xeb,
+    0x7b, 0xf4, 0xdf, 0x88, 0x8a, 0x53, 0x4a, 0xda, 0x10, 0xd3, 0x91, 0x9b, 0x22, 0xc8, 0xd0, 0x18,
+    0xc3, 0x0e, 0xb5, 0xd0, 0xd9, 0xc6, 0x16, 0xa8, 0x28, 0xf4, 0x1c, 0xd7, 0x74, 0x40, 0xe0, 0x7c,
+    0xed, 0x1c, 0xd6, 0x72, 0x8a, 0xd1, 0x64, 0x47, 0x19, 0x38, 0x1f, 0x53, 0x4d, 0x48, 0x09, 0x8d,
+    0xe0, 0xd4, 0x20, 0x67, 0x20, 0xe2, 0x40, 0xcb, 0x91, 0x12, 0xa9, 0x2c, 0x23, 0x90, 0xa2, 0x32,
+    0xc4, 0x0c, 0x0c, 0x43, 0x29, 0x98, 0x44, 0xae, 0xb8, 0x15, 0x57, 0xd4, 0xa8, 0xf6, 0x18, 0xa4,
+    0x3d, 0x37, 0x04, 0x96, 0x13, 0x84, 0xaa, 0xef, 0x19, 0x5d, 0x25, 0xb5, 0x0d, 0x5c, 0x6b, 0xb1,
+    0x2b, 0x2a, 0xc3, 0x19, 0xd3, 0xb3, 0x5b, 0x12, 0x15, 0x67, 0x54, 0x5d, 0xd6, 0x50, 0xda, 0x30,
+    0xdc, 0x81, 0x48, 0x2e, 0xe5, 0xa3, 0xab, 0x8b, 0x11, 0x2a, 0x3c, 0x5c, 0xb2, 0x94, 0xf4, 0xd9,
+    0x8f, 0x1d, 0x0d, 0x90, 0xda, 0x08, 0x35, 0x90, 0x34, 0x06, 0xd4, 0x6f, 0x24, 0x30, 0x3b, 0xd5,
+    0x54, 0xbc, 0xa9, 0xcc, 0x3a, 0x4e, 0x06, 0x78, 0xf2, 0x86, 0x37, 0xef, 0xe1, 0x63, 0x1b, 0xaa,
+    0x78, 0xcc, 0x29, 0x36, 0x3a, 0xed, 0xe3, 0xeb, 0xfa, 0x34, 0xa0, 0x6e, 0xb1, 0x9f, 0x1e, 0x8f,
+    0xae, 0xdb, 0x91, 0xbc, 0xf9, 0x68, 0x6a, 0xb4, 0x2a, 0x2a, 0xea, 0xa8, 0xbb, 0x0e, 0x9c, 0xdb,
+    0x55, 0xf4, 0xdb, 0xff, 0xfc, 0xdf, 0xff, 0xf9, 0x3b, 0xf1, 0xb2, 0x19, 0x3d, 0x1e, 0xe5, 0xcd,
+    0x37, 0x2e, 0x5d, 0xdb, 0x7d, 0xbc, 0x1a, 0x2f, 0x67, 0xd7, 0xd5, 0x9a, 0xe4, 0x68, 0x24, 0xfe,
+    0xa6, 0x38, 0x7f, 0xb9, 0x18, 0xbf, 0x29, 0x2a, 0x71, 0xb1, 0x58, 0x8a, 0xb3, 0xe7, 0x5f, 0x8a,
+    0xe6, 0xeb, 0x93, 0x66, 0x4a, 0x89, 0x91, 0xbb, 0xd5, 0x93, 0xde, 0xd3, 0xb2, 0x68, 0x7a, 0xfc,
+    0x57, 0xb3, 0x2b, 0xfa, 0x2e, 0xa8, 0x19, 0xba, 0xb8, 0x99, 0x8f, 0xe9, 0x83, 0x23, 0xd1, 0x8c,
+    0xb6, 0x84, 0x0f, 0x0e, 0x7b, 0x1f, 0x16, 0x61, 0x70, 0x55, 0x81, 0xc5, 0xa2, 0x5a, 0x8c, 0x17,
+    0xa5, 0x38, 0x11, 0xe5, 0x62, 0x9c, 0xd3, 0xb2, 0x61, 0xf7, 0xee, 0xe4, 0x44, 0xec, 0x53, 0x63,
+    0xbe, 0x3a, 0xda, 0x17, 0x3f, 0x17, 0xfb, 0x77, 0x2b, 0xba, 0x39, 0xa2, 0x9b, 0xa3, 0xfd, 0xee,
+    0xc3, 0xa2, 0xbb, 0x15, 0x56, 0x53, 0xcb, 0xdc, 0x31, 0x6a, 0x49, 0x7c, 0x2e, 0xf6, 0x47, 0xa3,
+    0x7d, 0xfc, 0xb4, 0xd4, 0xa7, 0x0b, 0xb0, 0xa5, 0xd7, 0x77, 0xab, 0x51, 0x59, 0x4c, 0x56, 0xfb,
+    0x87, 0x7d, 0x4a, 0xc3, 0xf3, 0xd9, 0x3c, 0x5f, 0xbe, 0x7b, 0xf5, 0xee, 0xba, 0x00, 0xd1, 0xfd,
+    0x7c, 0xb9, 0xcc, 0xdf, 0x9d, 0xdf, 0x5c, 0x5c, 0x14, 0xcb, 0xfd, 0x76, 0x7f, 0x3c, 0x6f, 0x31,
+    0x5f, 0x5c, 0x17, 0x73, 0xcc, 0xc1, 0xa6, 0x4e, 0x9e, 0xf6, 0xf6, 0x85, 0xe0, 0x2a, 0x7e, 0x7b,
+    0x53, 0xcc, 0xc7, 0x44, 0x60, 0xd0, 0xfb, 0x12, 0x0b, 0x11, 0xbe, 0x18, 0xdf, 0xd0, 0x61, 0xce,
+    0xf0, 0xb2, 0xa8, 0x9e, 0x97, 0x05, 0xdd, 0x3e, 0x7b, 0xf7, 0xf5, 0xe4, 0x60, 0xbf, 0x3d, 0x37,
+    0xd9, 0x3f, 0x1c, 0xd2, 0x07, 0x57, 0xa7, 0xf5, 0xe7, 0x75, 0x24, 0xc1, 0xff, 0xfc, 0xf1, 0x8f,
+    0xff, 0xca, 0x1f, 0x15, 0xed, 0xff, 0x64, 0x4a, 0xec, 0x12, 0xdf, 0xe4, 0x57, 0xbc, 0x93, 0xee,
+    0x68, 0xa6, 0x3d, 0x97, 0xd9, 0xa0, 0x38, 0xbb, 0x10, 0x07, 0x9b, 0xf6, 0x3c, 0x84, 0x4f, 0x15,
+    0xf9, 0x92, 0xee, 0x17, 0x37, 0xd5, 0xfd, 0xc1, 0x6e, 0xed, 0x87, 0xfb, 0x8a, 0x19, 0x97, 0x8b,
+    0x55, 0xf1, 0xa8, 0x66, 0xfe, 0x6f, 0x0a, 0xf8, 0xa7, 0xff, 0x10, 0x5f, 0xf6, 0x8e, 0x93, 0xfe,
+    0x64, 0x8a, 0x98, 0x7c, 0x8c, 0xe8, 0xe6, 0x56, 0xb1, 0x08, 0x61, 0xb6, 0x56, 0xc3, 0x7d, 0x9f,
+    0xce, 0x04, 0x1d, 0x2c, 0x6d, 0x53, 0x47, 0xb1, 0x5c, 0x2e, 0x96, 0x8f, 0xaa, 0x03, 0xc3, 0xac,
+    0xab, 0x83, 0x6d, 0xcb, 0xaf, 0x8a, 0xd5, 0x2a, 0xbf, 0x64, 0x7d, 0x16, 0xb7, 0xd8, 0xde, 0x03,
+    0x2a, 0x64, 0x39, 0x1e, 0x19, 0x4e, 0xf2, 0x2a, 0x17, 0x33, 0x84, 0x55, 0x0e, 0xef, 0x5b, 0x5c,
+    0x88, 0x2f, 0xc8, 0x7b, 0x9f, 0xb1, 0xf7, 0x1e, 0x6e, 0x2c, 0x11, 0x22, 0xbf, 0xbe, 0x2e, 0xdf,
+    0x35, 0x9f, 0xa9, 0xbd, 0xa8, 0x39, 0x1c, 0x50, 0x08, 0x7d, 0x37, 0x9b, 0x57, 0x91, 0xd7, 0xf5,
+    0x68, 0x1e, 0x1e, 0xf6, 0xb5, 0xf3, 0xa1, 0x2f, 0xeb, 0xfa, 0x55, 0x07, 0x23, 0xeb, 0x6f, 0xdf,
+    0xda, 0x10, 0xbc, 0x55, 0xe2, 0x60, 0x55, 0x14, 0x62, 0xb5, 0x1c, 0x8f, 0x1a, 0x44, 0x19, 0x4e,
+    0x0f, 0x8f, 0xc4, 0xaf, 0x9b, 0xc3, 0xb4, 0x4c, 0x54, 0x88, 0xb6, 0xac, 0x0d, 0x9b, 0xd7, 0x59,
+    0x47, 0xac, 0x9a, 0x22, 0xc6, 0x72, 0xf1, 0xa6, 0x78, 0x77, 0xb1, 0x24, 0xfb, 0x1d, 0xe8, 0x24,
+    0xfe, 0xeb, 0xf7, 0xe2, 0xaf, 0x7e, 0xf1, 0xec, 0x50, 0x40, 0xa9, 0xb9, 0x98, 0x14, 0x25, 0xf6,
+    0x7c, 0x30, 0x9e, 0xe6, 0xf3, 0xcb, 0x62, 0x32, 0x58, 0x7f, 0x13, 0x79, 0x3e, 0xab, 0xae, 0xf2,
+    0x6b, 0x84, 0x39, 0x66, 0x76, 0xd4, 0xa0, 0x92, 0x22, 0x1f, 0x4f, 0x45, 0x33, 0x5b, 0x34, 0xb3,
+    0x0f, 0x3f, 0xe9, 0x23, 0xd2, 0xcb, 0xe7, 0xbf, 0x78, 0xf1, 0xfc, 0x9b, 0x57, 0x2f, 0xa1, 0x70,
+    0x9d, 0x9e, 0x6c, 0x0c, 0x3d, 0xfb, 0xfa, 0xd5, 0x8b, 0x2f, 0xbe, 0xfd, 0xfb, 0x67, 0xbf, 0x7a,
+    0xf5, 0x9c, 0x86, 0x5f, 0x20, 0x7f, 0x0f, 0xc7, 0xc5, 0xac, 0x3c, 0x68, 0xd7, 0x8c, 0x44, 0xf7,
+    0x6d, 0x29, 0x21, 0xe4, 0x26, 0x14, 0x90, 0x0c, 0xdf, 0x2c, 0xba, 0xdd, 0xbc, 0x2b, 0xaa, 0x07,
+    0x98, 0xf9, 0x98, 0x61, 0xd8, 0x06, 0x3d, 0x03, 0x92, 0xc5, 0xe9, 0xdd, 0xaf, 0xe5, 0x6b, 0xf1,
+    0x29, 0x30, 0x52, 0x1d, 0xc2, 0x65, 0xab, 0x9b, 0xe5, 0x9c, 0x39, 0x7c, 0x37, 0x7f, 0x33, 0x5f,
+    0xdc, 0xcd, 0x7b, 0x06, 0xa8, 0xf5, 0x7c, 0x0f, 0x79, 0xab, 0x1a, 0xe2, 0x98, 0x8e, 0x7a, 0xfd,
+    0x64, 0x83, 0x78, 0x3d, 0x06, 0xca, 0xf2, 0xf0, 0x63, 0xc8, 0xc6, 0xeb, 0xf4, 0xeb, 0xbe, 0x63,
+    0x50, 0xda, 0x38, 0xa8, 0x77, 0x7d, 0x89, 0x19, 0xf2, 0x09, 0xdf, 0x1c, 0xb7, 0x1a, 0xe5, 0xe7,
+    0xcf, 0x3f, 0xbf, 0xef, 0x8a, 0x08, 0xae, 0x97, 0xb5, 0x21, 0x4e, 0xe9, 0xc3, 0x4d, 0xf8, 0xca,
+    0x65, 0xc6, 0xe4, 0x33, 0x61, 0x60, 0x41, 0xa2, 0xf1, 0x17, 0xc2, 0x7c, 0xcc, 0x05, 0x45, 0x51,
+    0x02, 0x6c, 0x36, 0x84, 0x56, 0xe2, 0xb3, 0xcf, 0x3a, 0x51, 0x9f, 0x3e, 0xd8, 0x45, 0xab, 0x3e,
+    0x5d, 0xab, 0xef, 0xe0, 0xa0, 0x9d, 0xfc, 0x39, 0xe9, 0xf2, 0x33, 0x21, 0xdf, 0x5e, 0x5c, 0x1c,
+    0x3e, 0x94, 0xf3, 0xbe, 0x2d, 0x5f, 0xcc, 0x56, 0x2b, 0xb8, 0x51, 0x2e, 0x9a, 0x18, 0x3d, 0x12,
+    0x77, 0xf9, 0xac, 0x4e, 0x9f, 0x9d, 0xcf, 0x6e, 0xd0, 0x40, 0x44, 0xaf, 0x8a, 0x39, 0xe0, 0x09,
+    0xa3, 0xfb, 0x1b, 0x5b, 0x12, 0x6b, 0x13, 0x3e, 0xba, 0xcd, 0x5d, 0xaa, 0x27, 0xad, 0x2f, 0x2e,
+    0x2e, 0xa0, 0x4a, 0x8c, 0x93, 0xd6, 0xfa, 0xae, 0xfa, 0x27, 0xb0, 0x51, 0xab, 0x32, 0xa2, 0x4d,
+    0x16, 0x12, 0x4f, 0x9f, 0xc2, 0x26, 0xaf, 0xa1, 0xab, 0x03, 0x25, 0x8e, 0x8f, 0xeb, 0x77, 0x9f,
+    0x89, 0x70, 0xf8, 0x40, 0x6d, 0x5b, 0x0d, 0x5c, 0xcb, 0x7c, 0x4f, 0x11, 0x62, 0xbd, 0x95, 0xcf,
+    0xb1, 0x97, 0xcd, 0xa1, 0x0f, 0x8f, 0x3b, 0xc1, 0x7d, 0x18, 0x6a, 0xa3, 0x69, 0x37, 0xeb, 0x07,
+    0x15, 0x09, 0x7f, 0x3d, 0x0c, 0xd5, 0xfc, 0x66, 0x79, 0x79, 0x7e, 0xf0, 0x67, 0xef, 0x79, 0xd7,
+    0xf5, 0xdc, 0xd7, 0x1f, 0x32, 0xb1, 0xf1, 0x82, 0xdc, 0xe5, 0xb1, 0x97, 0xfa, 0xf5, 0x87, 0xc3,
+    0xdf, 0x6c, 0x46, 0x14, 0xab, 0x1b, 0xbe, 0xa6, 0xe3, 0xa6, 0x7e, 0xe0, 0x45, 0x24, 0xd9, 0x5c,
+    0x0c, 0x44, 0x75, 0xb7, 0x10, 0xe3, 0xd9, 0x12, 0x49, 0x77, 0xd5, 0x9b, 0x50, 0x0b, 0x55, 0x94,
+    0x8a, 0x0c, 0xff, 0xb1, 0x64, 0xc7, 0x1f, 0xa1, 0x6c, 0xfa, 0xd3, 0x7a, 0x9d, 0xde, 0xb9, 0xee,
+    0x7c, 0x73, 0x21, 0xa7, 0x93, 0x12, 0x61, 0x80, 0xcb, 0xb0, 0xfe, 0x2a, 0x9f, 0xbf, 0x1b, 0x3f,
+    0xa9, 0x35, 0xf3, 0x70, 0xaa, 0xa6, 0xa9, 0x7a, 0xeb, 0xd4, 0x26, 0x4a, 0xdf, 0x3f, 0x22, 0xdf,
+    0x0e, 0xf1, 0xf6, 0x6b, 0x04, 0x78, 0x44, 0x42, 0xe2, 0xba, 0x9d, 0xe9, 0x23, 0xc9, 0xe9, 0x65,
+    0x95, 0x2f, 0xab, 0x5e, 0xa5, 0xdb, 0x64, 0xf3, 0x0e, 0x1d, 0x1f, 0x96, 0xac, 0x0f, 0xcb, 0xda,
+    0xf5, 0x1f, 0x9d, 0xfa, 0x5f, 0xde, 0x17, 0xd5, 0x78, 0x7a, 0x80, 0x9a, 0x92, 0x87, 0xf6, 0x33,
+    0xf1, 0x1e, 0x98, 0x50, 0x4d, 0x17, 0x13, 0x14, 0xab, 0xdf, 0xfe, 0xf2, 0xe5, 0xab, 0x7d, 0xf1,
+    0xe1, 0xb0, 0xb7, 0x83, 0x21, 0xe5, 0xb5, 0x83, 0x25, 0x65, 0xf2, 0xe5, 0xf0, 0x1f, 0x56, 0x8b,
+    0xf9, 0xc1, 0xe1, 0xc3, 0x61, 0xce, 0xe6, 0xf7, 0x72, 0xfd, 0x96, 0x82, 0xe7, 0x23, 0xf5, 0x13,
+    0x51, 0x19, 0xae, 0x6e, 0xc6, 0x63, 0x40, 0x14, 0xd5, 0xd0, 0x3f, 0xfc, 0xe1, 0x1f, 0xeb, 0x4f,
+    0xd7, 0xc5, 0xdd, 0xe2, 0x4d, 0x31, 0xff, 0x94, 0xeb, 0xe9, 0x1f, 0xfe, 0xf0, 0x7b, 0xf1, 0x97,
+    0xf9, 0xac, 0xbc, 0x57, 0x07, 0x89, 0x7e, 0xe1, 0xd3, 0x94, 0x2f, 0x3f, 0x59, 0x80, 0xfd, 0xfd,
+    0x27, 0x02, 0x31, 0x62, 0x36, 0xab, 0x24, 0x71, 0x4f, 0x21, 0x28, 0xce, 0xa1, 0xc0, 0xe2, 0xff,
+    0xbf, 0x5f, 0xde, 0xcb, 0x73, 0x2a, 0xb9, 0xf6, 0x37, 0xb9, 0xdd, 0x77, 0x0c, 0xf4, 0x5a, 0x6d,
+    0x07, 0x74, 0x3c, 0xaa, 0xff, 0x3f, 0x80, 0xe3, 0x11, 0xff, 0x0f, 0x38, 0xff, 0x0b, 0x0a, 0x05,
+    0xd1, 0x75, 0x97, 0x33, 0x00, 0x00,
+};
+
+// settings.html: 16748 -> 3916 bytes
+constexpr uint8_t WEB_ASSET_SETTINGS_HTML[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x1c, 0xdb, 0x6e, 0x1b, 0xc7,
+    0xf5, 0x3d, 0x5f, 0x31, 0xd9, 0x06, 0x21, 0x89, 0xf0, 0x26, 0x59, 0x36, 0x62, 0x8a, 0x64, 0x20,
+    0x4b, 0x72, 0xe4, 0xd4, 0x92, 0x05, 0x53, 0xae, 0x9b, 0x04, 0x81, 0x3d, 0xdc, 0x1d, 0x92, 0x1b,
+    0x2d, 0x77, 0x99, 0xdd, 0x59, 0xd1, 0x8c, 0xa3, 0xd7, 0xbe, 0xb6, 0x40, 0x02, 0xf4, 0xa5, 0x40,
+    0x80, 0xf6, 0x07, 0x5a, 0xa0, 0xe8, 0x0f, 0xf4, 0x4f, 0xf2, 0x05, 0xf9, 0x84, 0x9e, 0x33, 0x97,
+    0xdd, 0xd9, 0x0b, 0xa9, 0x25, 0x1d, 0xf4, 0xc1, 0x01, 0xcc, 0xdd, 0x9d, 0x99, 0x73, 0xe6, 0x9c,
+    0x33, 0xe7, 0x36, 0x67, 0x46, 0xe9, 0x7f, 0x78, 0xf2, 0xec, 0xf8, 0xea, 0xcb, 0xcb, 0x53, 0x32,
+    0xe3, 0x73, 0x6f, 0xf8, 0x41, 0x5f, 0x3e, 0x08, 0xe9, 0xcf, 0x18, 0x75, 0xf0, 0x05, 0x5e, 0xe7,
+    0x8c, 0x53, 0x62, 0xcf, 0x68, 0x18, 0x31, 0x3e, 0xb0, 0x62, 0x3e, 0x69, 0x7d, 0x6a, 0x91, 0x8e,
+    0xd9, 0x39, 0xe3, 0x7c, 0xd1, 0x62, 0xdf, 0xc5, 0xee, 0xcd, 0xc0, 0xfa, 0x63, 0xeb, 0xc5, 0x51,
+    0xeb, 0x38, 0x98, 0x2f, 0x28, 0x77, 0xc7, 0x1e, 0xb3, 0x88, 0x1d, 0xf8, 0x9c, 0xf9, 0x00, 0xf9,
+    0xe4, 0x74, 0xc0, 0x9c, 0x29, 0x4b, 0x61, 0xb9, 0xcb, 0x3d, 0x36, 0x3c, 0xf6, 0x02, 0xfb, 0x9a,
+    0x8c, 0x18, 0xe7, 0xae, 0x3f, 0x8d, 0xfa, 0x1d, 0xd9, 0x6a, 0x60, 0xf7, 0xe9, 0x9c, 0x0d, 0xac,
+    0x1b, 0x97, 0x2d, 0x17, 0x41, 0xc8, 0x0d, 0x84, 0x4b, 0xd7, 0xe1, 0xb3, 0x81, 0xc3, 0x6e, 0x5c,
+    0x9b, 0xb5, 0xc4, 0x47, 0x93, 0xb8, 0xbe, 0xcb, 0x5d, 0xea, 0xb5, 0x22, 0x9b, 0x7a, 0x6c, 0xb0,
+    0x97, 0x4e, 0xe6, 0xb9, 0xfe, 0x35, 0x09, 0x99, 0x37, 0xb0, 0x22, 0xbe, 0xf2, 0x58, 0x34, 0x63,
+    0x0c, 0x70, 0xcd, 0x42, 0x36, 0x51, 0x2d, 0x6d, 0x3b, 0x8a, 0x3e, 0xbb, 0x19, 0x3c, 0x9c, 0x3c,
+    0x3c, 0x38, 0xb0, 0x1f, 0x3e, 0x78, 0x60, 0x8f, 0xe9, 0x03, 0xfb, 0x3e, 0x55, 0x18, 0xfa, 0x1d,
+    0x2d, 0x91, 0xfe, 0x38, 0x70, 0x56, 0x0a, 0xa9, 0xe3, 0xde, 0x10, 0xdb, 0xa3, 0x51, 0x34, 0xb0,
+    0x90, 0x2a, 0xea, 0xfa, 0x2c, 0xb4, 0x64, 0x1f, 0xca, 0x70, 0x6f, 0xf8, 0xcb, 0x9f, 0xff, 0x49,
+    0xf2, 0x0c, 0x42, 0xf3, 0x07, 0x7a, 0xc8, 0x87, 0xad, 0x16, 0xb9, 0x72, 0xe7, 0x4c, 0x77, 0x93,
+    0x56, 0x2b, 0x01, 0x8f, 0x98, 0xcd, 0xdd, 0xc0, 0x4f, 0x26, 0xa0, 0xa1, 0x93, 0xe0, 0x46, 0xec,
+    0xfb, 0x43, 0x00, 0x12, 0xd0, 0x80, 0x73, 0xdf, 0xe8, 0x31, 0xa8, 0x9a, 0x04, 0xe1, 0xbc, 0x15,
+    0x06, 0x4b, 0x03, 0x10, 0x65, 0x41, 0xc7, 0xcc, 0x1b, 0x22, 0xe4, 0xf7, 0x81, 0xcf, 0x7a, 0xfd,
+    0x8e, 0x6c, 0x30, 0x87, 0x44, 0xcc, 0x83, 0xe9, 0x89, 0xeb, 0x0c, 0x2c, 0xae, 0xc6, 0x59, 0x1a,
+    0xa9, 0xec, 0xcb, 0xa0, 0x04, 0x88, 0x60, 0x21, 0xa8, 0xbd, 0xa1, 0x5e, 0x0c, 0xcb, 0x75, 0x1a,
+    0x87, 0xc1, 0x82, 0x75, 0x9e, 0x06, 0xbe, 0x13, 0xf8, 0xd6, 0x50, 0x3e, 0x49, 0xfd, 0xf3, 0xf3,
+    0xab, 0xce, 0xa3, 0xd1, 0x55, 0xa3, 0xdf, 0x91, 0xc3, 0xab, 0xe0, 0x78, 0xc4, 0x42, 0x58, 0x3c,
+    0x6b, 0x28, 0x9f, 0xa4, 0x7e, 0x7c, 0x7a, 0xd5, 0x39, 0x3e, 0xdd, 0x12, 0xc9, 0x25, 0x0d, 0xdd,
+    0xc8, 0x1a, 0x8a, 0xc7, 0x8e, 0x28, 0x8e, 0xe6, 0x11, 0x67, 0xa1, 0x43, 0xe7, 0xd6, 0x30, 0x79,
+    0xdd, 0x11, 0xd5, 0xf3, 0x60, 0xce, 0xac, 0x21, 0xfe, 0xee, 0x88, 0xe0, 0x9c, 0x3a, 0xa1, 0x0b,
+    0xea, 0x20, 0x9f, 0x3b, 0x22, 0xf9, 0x83, 0xcb, 0x7c, 0x1f, 0x14, 0x5c, 0xae, 0x27, 0x73, 0x86,
+    0xb2, 0x61, 0x47, 0x6c, 0x5f, 0xc5, 0xa1, 0x6b, 0xcf, 0xac, 0xa1, 0x7c, 0xee, 0x88, 0x64, 0xc4,
+    0xc1, 0x56, 0x66, 0x81, 0x07, 0x32, 0x4e, 0x5e, 0x77, 0x5d, 0x2e, 0x3e, 0x63, 0x3e, 0x2c, 0xb9,
+    0x7c, 0x92, 0xfa, 0x29, 0x20, 0x39, 0xdd, 0x16, 0xc9, 0x19, 0xf3, 0x22, 0x70, 0x1c, 0xae, 0x35,
+    0xd4, 0x6f, 0x3b, 0x22, 0x3a, 0x0f, 0x22, 0x1b, 0xcd, 0x50, 0x3e, 0x49, 0xfd, 0x7c, 0xf4, 0xfb,
+    0x6a, 0xf0, 0x47, 0x73, 0x06, 0xf2, 0xa4, 0x9d, 0x0b, 0xb6, 0x7c, 0xf5, 0x65, 0x10, 0x5e, 0x5b,
+    0x43, 0x78, 0x23, 0xf8, 0x06, 0x94, 0x8c, 0x80, 0x92, 0x93, 0xab, 0xed, 0x10, 0x1d, 0xcf, 0xe0,
+    0x77, 0x1a, 0x58, 0x43, 0xf5, 0x02, 0xe2, 0x05, 0x34, 0xc7, 0xdb, 0xa2, 0x39, 0x61, 0xfe, 0x0d,
+    0x3a, 0x3b, 0xf9, 0x44, 0x86, 0xae, 0x3a, 0xe7, 0xdb, 0x22, 0x79, 0x1a, 0x44, 0xaf, 0x8e, 0xfc,
+    0x29, 0xe8, 0x5f, 0x84, 0x3e, 0x22, 0x22, 0xea, 0x83, 0xd4, 0x2f, 0x01, 0xdd, 0xe5, 0xb6, 0xe8,
+    0x46, 0x34, 0x78, 0x75, 0x49, 0x63, 0x0f, 0x98, 0x1b, 0xfd, 0xf7, 0x1f, 0x01, 0x11, 0xef, 0xa4,
+    0xfe, 0xe8, 0x79, 0x55, 0x3c, 0x91, 0x4b, 0x3b, 0x57, 0xc1, 0xf5, 0x0a, 0x10, 0x88, 0x07, 0xa9,
+    0x7f, 0x31, 0xda, 0x06, 0x76, 0x34, 0xa3, 0xfe, 0x74, 0x46, 0x41, 0x5d, 0xf4, 0x9b, 0x90, 0xee,
+    0x36, 0x18, 0x20, 0x08, 0x50, 0x88, 0x73, 0xe0, 0x1e, 0x92, 0x57, 0x52, 0x1f, 0x7d, 0xbe, 0x0d,
+    0x8e, 0x93, 0x78, 0x8c, 0x24, 0x88, 0x07, 0xb8, 0xdc, 0xca, 0xf3, 0xc7, 0x11, 0x0f, 0xa9, 0x87,
+    0x44, 0xac, 0x1c, 0x9f, 0xad, 0x80, 0x02, 0xf1, 0x24, 0xf5, 0x23, 0x54, 0xb4, 0xa3, 0xca, 0x9a,
+    0x76, 0x49, 0x6d, 0x77, 0xe2, 0xda, 0x9d, 0xa3, 0xd8, 0xbe, 0xf6, 0xa8, 0x0f, 0x6e, 0x4a, 0xbf,
+    0x91, 0xfa, 0xc5, 0x57, 0x80, 0xea, 0xe2, 0xab, 0xaa, 0xa8, 0x5e, 0x5c, 0x1d, 0x5b, 0x43, 0xf8,
+    0x29, 0x1b, 0xdc, 0xef, 0x48, 0xc7, 0x65, 0x44, 0xbe, 0x0e, 0x84, 0x3e, 0xe3, 0x73, 0x1c, 0x73,
+    0x9e, 0x06, 0xd0, 0x31, 0xf7, 0x09, 0xfc, 0x6b, 0x45, 0x73, 0xea, 0x79, 0x16, 0x09, 0x7c, 0xdb,
+    0x73, 0xed, 0x6b, 0x08, 0x67, 0xf4, 0x86, 0xe9, 0x58, 0x58, 0x6f, 0x00, 0xd7, 0xf0, 0x4d, 0x74,
+    0x43, 0xbf, 0x23, 0x91, 0x18, 0x58, 0xa3, 0x05, 0xf5, 0x65, 0x60, 0xfc, 0xbe, 0x15, 0x71, 0xca,
+    0xe3, 0x28, 0x8d, 0x8c, 0xf2, 0x73, 0x08, 0xa4, 0xc1, 0x20, 0x33, 0x58, 0x87, 0x44, 0x24, 0x19,
+    0x03, 0x6b, 0x4e, 0xc3, 0xa9, 0xeb, 0xf7, 0xc8, 0x5e, 0xc8, 0xe6, 0xa4, 0x7b, 0x48, 0xc6, 0x41,
+    0xe8, 0xb0, 0xb0, 0x65, 0x07, 0x5e, 0x10, 0xf6, 0xc8, 0xef, 0x0e, 0x0e, 0x0e, 0x0e, 0x93, 0xa4,
+    0xa5, 0x5a, 0x34, 0x77, 0xfd, 0x45, 0xcc, 0x09, 0x5f, 0x2d, 0x00, 0xbb, 0x1f, 0xcf, 0xc7, 0x60,
+    0x95, 0x82, 0xbc, 0x59, 0x10, 0x87, 0x40, 0xda, 0xc2, 0xa3, 0x36, 0x03, 0x3f, 0x0a, 0xb3, 0x0c,
+    0xac, 0xb3, 0x33, 0x8b, 0xcc, 0xe9, 0x9b, 0x81, 0xb5, 0x7f, 0x0f, 0x5e, 0x5c, 0x7f, 0x60, 0x75,
+    0x13, 0xe2, 0x25, 0x6c, 0x94, 0x99, 0x5d, 0xb3, 0xab, 0x86, 0x00, 0x2d, 0xae, 0x83, 0x56, 0xdf,
+    0xcb, 0x73, 0xb8, 0x81, 0x0e, 0x98, 0x26, 0xe6, 0x2c, 0x4f, 0xc9, 0xf9, 0xb9, 0xa2, 0xe4, 0xfe,
+    0xc3, 0x4a, 0x94, 0xe4, 0xd7, 0x76, 0x67, 0xb1, 0x38, 0x74, 0x95, 0x23, 0xe5, 0xe4, 0x44, 0x91,
+    0x72, 0x6f, 0x4f, 0x91, 0xb2, 0x97, 0x27, 0x85, 0x28, 0xa5, 0xa9, 0x20, 0x9a, 0xf6, 0x36, 0xa2,
+    0x81, 0xa4, 0x71, 0xb6, 0x4e, 0x30, 0x7b, 0xfb, 0xff, 0x67, 0x6a, 0x56, 0x8c, 0x86, 0x39, 0x62,
+    0xbe, 0x84, 0xff, 0x14, 0x15, 0xfb, 0xdd, 0xfd, 0xae, 0x56, 0x9e, 0xee, 0xc3, 0x87, 0x5b, 0x2d,
+    0x56, 0x35, 0x43, 0x9c, 0xb8, 0x9e, 0xf7, 0x08, 0xd6, 0x31, 0x62, 0x21, 0x9a, 0x1f, 0xda, 0xe2,
+    0xaf, 0x3f, 0xff, 0xf8, 0x2f, 0xf2, 0x22, 0x62, 0x44, 0xb5, 0xab, 0x74, 0xb7, 0x60, 0x93, 0x85,
+    0x09, 0x4a, 0xec, 0x3b, 0x63, 0xdb, 0x1b, 0xed, 0x1a, 0xfa, 0xab, 0x59, 0x36, 0xba, 0x20, 0x5b,
+    0xfa, 0x25, 0x33, 0xa3, 0x3f, 0x82, 0x36, 0x98, 0xe7, 0x0c, 0x0d, 0x70, 0xb7, 0xcc, 0xde, 0xc4,
+    0xb0, 0x53, 0x76, 0xaf, 0x87, 0xf0, 0x60, 0x3a, 0x85, 0x5d, 0x58, 0xce, 0xc9, 0x9a, 0x1a, 0x60,
+    0xcf, 0x98, 0x7d, 0x3d, 0x0e, 0xde, 0x48, 0x1d, 0xa0, 0x62, 0x62, 0x31, 0xef, 0xa9, 0x4f, 0x61,
+    0x03, 0xe7, 0x08, 0x49, 0x62, 0x34, 0x63, 0x1a, 0xdb, 0x51, 0x3a, 0x06, 0x64, 0x9a, 0xd5, 0x42,
+    0x25, 0xc7, 0xa1, 0x04, 0x26, 0x59, 0x3e, 0x0a, 0x9a, 0x98, 0xdf, 0x78, 0x94, 0x19, 0x79, 0x8e,
+    0xaa, 0xe3, 0xc0, 0x9f, 0xb8, 0xd3, 0x2c, 0xc7, 0x5c, 0xcc, 0xa5, 0x57, 0x0a, 0x18, 0x72, 0x62,
+    0x8f, 0xb5, 0x44, 0x6b, 0x9e, 0x73, 0x9e, 0x6e, 0x6c, 0xcd, 0xd6, 0x30, 0xdf, 0x24, 0x86, 0x0e,
+    0x4f, 0xe8, 0x0a, 0x36, 0xa4, 0xb3, 0xf2, 0x4e, 0xc9, 0xdb, 0xfa, 0xfe, 0x11, 0xa7, 0x21, 0x5f,
+    0xdf, 0x7d, 0xea, 0x3b, 0x65, 0x9d, 0xd0, 0x96, 0x23, 0x06, 0x47, 0x15, 0x88, 0xee, 0xf3, 0x74,
+    0x1b, 0x9a, 0x61, 0x84, 0x38, 0x94, 0xd3, 0x16, 0x38, 0x39, 0xf4, 0x1b, 0xc3, 0x3e, 0x77, 0x20,
+    0xe5, 0xf4, 0x1d, 0xc1, 0x87, 0x23, 0x3e, 0xd7, 0x2c, 0xbe, 0x76, 0x1c, 0x74, 0xd5, 0x62, 0x7a,
+    0xe1, 0x3b, 0xc3, 0x72, 0x28, 0x34, 0x90, 0x0c, 0x44, 0x84, 0xac, 0x5a, 0x3a, 0x68, 0x77, 0x3f,
+    0xed, 0x75, 0xbb, 0x5b, 0x40, 0x33, 0x48, 0x11, 0x34, 0xec, 0x5e, 0x16, 0xb6, 0x53, 0x5c, 0x99,
+    0x2c, 0x8f, 0xfb, 0x92, 0xc7, 0xab, 0x98, 0x45, 0xef, 0x2f, 0x93, 0xf7, 0x24, 0x93, 0x2f, 0x19,
+    0xa4, 0x63, 0xef, 0x31, 0x9b, 0x07, 0x6a, 0x2d, 0x67, 0x60, 0xe6, 0xef, 0x2f, 0x97, 0xf7, 0x25,
+    0x97, 0x8f, 0x61, 0xdf, 0xfe, 0xde, 0xf2, 0xf8, 0x40, 0xf2, 0x38, 0x82, 0x98, 0x19, 0xbe, 0xbf,
+    0x5c, 0x76, 0x15, 0x97, 0xf1, 0x7b, 0xe4, 0x5f, 0xa1, 0x25, 0x1f, 0x58, 0xa0, 0x09, 0xe9, 0xdd,
+    0x22, 0xbb, 0xcb, 0x25, 0x5f, 0xd9, 0x7c, 0x41, 0xe6, 0x60, 0xd9, 0xc4, 0x60, 0x7d, 0x2e, 0x26,
+    0x23, 0xff, 0x3b, 0x65, 0x63, 0x2f, 0xe9, 0x35, 0x8b, 0x17, 0xe4, 0x89, 0xcf, 0x59, 0x08, 0x52,
+    0xd8, 0x31, 0x21, 0x8b, 0x79, 0x90, 0xc7, 0x94, 0x4b, 0xcc, 0x16, 0x1a, 0x7c, 0xe6, 0xfa, 0xdc,
+    0x1a, 0x9e, 0x05, 0x4b, 0x12, 0x4c, 0x38, 0xf3, 0x09, 0x84, 0x6f, 0xe8, 0xc2, 0x22, 0x70, 0x34,
+    0x83, 0x2c, 0x56, 0x7c, 0xe3, 0x22, 0x11, 0x0a, 0x48, 0xe7, 0x94, 0xbb, 0x36, 0xe4, 0xc1, 0xa0,
+    0x40, 0x0b, 0x53, 0x00, 0x69, 0xfd, 0x75, 0x29, 0x66, 0xd5, 0x93, 0x6e, 0xaa, 0xc2, 0xe6, 0x36,
+    0xcf, 0xa0, 0x9f, 0xcf, 0x26, 0x93, 0xd2, 0xad, 0x73, 0x76, 0x20, 0xb8, 0xa4, 0xd3, 0x1b, 0x16,
+    0xae, 0xc8, 0x7d, 0xa2, 0x36, 0x6b, 0x15, 0x80, 0xf6, 0x12, 0xa8, 0xbd, 0x6d, 0xc0, 0xee, 0x75,
+    0x35, 0xd8, 0xbd, 0xee, 0x16, 0x60, 0x0f, 0x12, 0x30, 0xdc, 0xd6, 0x56, 0x21, 0x6f, 0x3f, 0x81,
+    0xd8, 0x17, 0x30, 0x95, 0x78, 0xfa, 0x34, 0xa5, 0xae, 0x32, 0xd0, 0xfe, 0x41, 0x02, 0x74, 0x50,
+    0x19, 0xe8, 0x5e, 0xca, 0xd0, 0x83, 0x75, 0x40, 0x25, 0x05, 0x8e, 0xbb, 0x4c, 0xed, 0x65, 0x46,
+    0x57, 0x12, 0x6b, 0x4b, 0x35, 0x76, 0xbd, 0xa5, 0x49, 0x35, 0x7b, 0x27, 0x4b, 0x3b, 0xa7, 0x7e,
+    0x0c, 0x06, 0xa6, 0xcc, 0x64, 0x2b, 0xfb, 0xca, 0x80, 0xe6, 0x0c, 0xab, 0x7c, 0xf7, 0xe8, 0xd1,
+    0x10, 0x0f, 0x93, 0x12, 0xf6, 0x79, 0xe8, 0x4e, 0xa7, 0x2c, 0x94, 0x18, 0xe4, 0xde, 0xf1, 0xa7,
+    0x9f, 0x04, 0x42, 0xf2, 0x62, 0x41, 0x2e, 0x82, 0xe5, 0x26, 0xe6, 0xe7, 0x62, 0xfa, 0x77, 0x62,
+    0xfe, 0x82, 0xf1, 0x25, 0x56, 0x65, 0xf5, 0x41, 0xcf, 0x76, 0xfc, 0xc3, 0x46, 0xf7, 0x3f, 0x05,
+    0x14, 0x25, 0x3b, 0x3f, 0x24, 0xd6, 0x97, 0xc3, 0x5a, 0xae, 0x3f, 0x09, 0x12, 0x5a, 0xf1, 0xa3,
+    0x85, 0x91, 0x66, 0xb8, 0x75, 0xa5, 0x44, 0x6e, 0xc2, 0xce, 0x03, 0xe7, 0xce, 0xa3, 0x20, 0x35,
+    0x33, 0x0e, 0xcd, 0xfb, 0xa1, 0xc2, 0x2e, 0xf1, 0x22, 0x1d, 0x8b, 0xab, 0xb1, 0xa9, 0xca, 0x07,
+    0xa6, 0x70, 0x4c, 0x17, 0x22, 0x20, 0x5c, 0x06, 0x21, 0x07, 0x3d, 0xa8, 0x1f, 0xd9, 0x36, 0x8b,
+    0x22, 0xf8, 0x04, 0x5f, 0x5a, 0xad, 0x54, 0x08, 0xbb, 0x9d, 0x97, 0xee, 0x63, 0x97, 0x1c, 0x7b,
+    0x2e, 0xf3, 0x39, 0xa9, 0xc3, 0x46, 0xd1, 0x47, 0xba, 0xc1, 0x6f, 0x2b, 0x52, 0x1a, 0xbb, 0x55,
+    0x11, 0xb5, 0xd8, 0x6d, 0x81, 0xb8, 0x6c, 0xff, 0x79, 0x97, 0x84, 0x13, 0x19, 0x0b, 0x02, 0x47,
+    0xa3, 0x27, 0x27, 0x65, 0x82, 0xce, 0xed, 0xcb, 0x39, 0x7b, 0xc3, 0xe5, 0x9e, 0x7c, 0xe9, 0x4e,
+    0x5c, 0x04, 0xca, 0xd5, 0x66, 0xb4, 0xb6, 0xe0, 0xf9, 0xa8, 0x28, 0xcc, 0x78, 0xcc, 0x9f, 0xf2,
+    0x19, 0xf8, 0x96, 0xfd, 0x7c, 0x69, 0x28, 0xcb, 0xd1, 0x36, 0x14, 0x5f, 0xc2, 0x18, 0x98, 0xc5,
+    0xa9, 0x40, 0xf0, 0x42, 0x0d, 0x4d, 0x89, 0xbe, 0x4c, 0x5a, 0x32, 0x84, 0x3f, 0x65, 0xe8, 0x93,
+    0xd8, 0x7c, 0xc1, 0x57, 0xb8, 0x3a, 0xd7, 0x8c, 0x41, 0xe8, 0x8c, 0xc3, 0x10, 0xa4, 0x9b, 0xe1,
+    0xe3, 0xc1, 0xc1, 0x6f, 0xc6, 0xc7, 0xc6, 0x72, 0xc8, 0xc6, 0x82, 0xc8, 0x04, 0x62, 0xf3, 0x98,
+    0xda, 0xd7, 0x49, 0x35, 0x44, 0x74, 0x33, 0x27, 0x5f, 0xf6, 0xd0, 0x85, 0x8f, 0xc7, 0x6a, 0x3c,
+    0x72, 0x96, 0x53, 0x6a, 0x77, 0x82, 0x67, 0xd7, 0xbe, 0xf2, 0x05, 0x13, 0xea, 0x7a, 0x25, 0x35,
+    0x91, 0x92, 0xaa, 0x48, 0x51, 0x25, 0x77, 0xb2, 0xf0, 0x9d, 0x4b, 0x42, 0x8b, 0x85, 0xb7, 0x02,
+    0xff, 0xb9, 0x96, 0x75, 0xc9, 0xf8, 0x11, 0x0e, 0x23, 0xd2, 0x07, 0x44, 0xc4, 0x9d, 0xcf, 0x99,
+    0xe3, 0x52, 0xce, 0x30, 0xb1, 0xd9, 0xba, 0xee, 0x73, 0x57, 0x98, 0x53, 0xaa, 0x9f, 0xc4, 0xb7,
+    0xa2, 0xe3, 0x5c, 0xef, 0xea, 0xb5, 0xf7, 0xdc, 0xd5, 0xd7, 0x53, 0x75, 0x69, 0xa0, 0x93, 0x80,
+    0xe2, 0xd5, 0x02, 0x6b, 0xf8, 0xcb, 0x9f, 0xfe, 0x42, 0x1e, 0xa9, 0x85, 0x3f, 0x0b, 0xb0, 0xc2,
+    0x48, 0xd5, 0x2d, 0x01, 0xc9, 0x9c, 0x7c, 0x8f, 0xec, 0xd0, 0x5d, 0x24, 0xce, 0xa6, 0xd3, 0x21,
+    0x4f, 0x03, 0xea, 0x10, 0xd0, 0x19, 0x12, 0xe9, 0xb8, 0x01, 0x8c, 0x2f, 0xe8, 0x94, 0x11, 0x0f,
+    0x7a, 0xd4, 0x38, 0x27, 0xb0, 0xe3, 0x39, 0x98, 0x47, 0x9b, 0x3a, 0x0e, 0x24, 0x0d, 0x3e, 0x7f,
+    0xea, 0x46, 0x90, 0x59, 0xb2, 0xb0, 0x5e, 0x3b, 0x79, 0x76, 0x7e, 0x2c, 0x2f, 0x44, 0x20, 0x26,
+    0xe6, 0xd4, 0x9a, 0x64, 0x12, 0xfb, 0x82, 0xe6, 0x7a, 0x83, 0xbc, 0x4d, 0x04, 0x50, 0x28, 0xae,
+    0x1e, 0xe2, 0xec, 0x8f, 0xa1, 0x95, 0x2c, 0x5d, 0x3e, 0xd3, 0x06, 0x48, 0xc6, 0xaa, 0xd0, 0x2a,
+    0x12, 0xd4, 0xf1, 0x8a, 0x38, 0x6c, 0x42, 0x63, 0x8f, 0x27, 0x78, 0x90, 0xaa, 0x11, 0xc8, 0x0a,
+    0x31, 0xa8, 0xc6, 0x5b, 0x78, 0x4b, 0x19, 0x12, 0x49, 0x0d, 0x9f, 0x61, 0x86, 0xed, 0xfa, 0xc0,
+    0x0c, 0x23, 0x21, 0xfb, 0x2e, 0x66, 0x11, 0x3f, 0x14, 0x89, 0xaf, 0xc6, 0x1f, 0x32, 0xf0, 0xdb,
+    0xb0, 0x05, 0xe6, 0xa8, 0x2c, 0x3c, 0x02, 0xcb, 0x58, 0xac, 0x24, 0x25, 0x30, 0xca, 0xc0, 0x76,
+    0x45, 0xa7, 0x4d, 0x02, 0x4b, 0x17, 0xab, 0xf0, 0xe2, 0x10, 0x5c, 0x29, 0x48, 0xa8, 0x83, 0x08,
+    0xa0, 0x28, 0xc1, 0xdd, 0x8a, 0x87, 0xa1, 0xe2, 0x5e, 0xf7, 0x40, 0x81, 0x69, 0xfe, 0x4d, 0x5a,
+    0x4d, 0x49, 0x30, 0x6e, 0xcf, 0xea, 0xb5, 0x0e, 0x5d, 0xb8, 0x1d, 0x81, 0xab, 0xd6, 0x30, 0x74,
+    0xb3, 0x8d, 0xc7, 0xc5, 0xf5, 0x90, 0x0c, 0x86, 0x24, 0x6c, 0x7f, 0x1b, 0xa1, 0x14, 0x8b, 0xdd,
+    0xb8, 0x07, 0xc4, 0x11, 0x6f, 0x33, 0x76, 0x00, 0xf6, 0x2d, 0x7a, 0xda, 0x51, 0x2c, 0xa2, 0x57,
+    0x23, 0xd7, 0x4f, 0x44, 0xfe, 0x9f, 0x1c, 0x35, 0x89, 0xa1, 0xfa, 0x72, 0x45, 0x22, 0xcc, 0xfc,
+    0xd0, 0x74, 0x58, 0xe9, 0x10, 0x73, 0x6f, 0x25, 0x46, 0x1a, 0xa5, 0xd2, 0x52, 0x80, 0x5c, 0x86,
+    0x28, 0x60, 0x5c, 0xf5, 0x55, 0x0a, 0xa0, 0x6d, 0x4d, 0x8c, 0x54, 0xc6, 0x93, 0x1b, 0x78, 0x6b,
+    0x7c, 0xdd, 0x66, 0xa4, 0x65, 0x53, 0x94, 0x35, 0x43, 0x59, 0x81, 0xeb, 0x8b, 0x02, 0x8f, 0xb5,
+    0x59, 0x18, 0x06, 0xa0, 0xb7, 0xa7, 0xf8, 0x10, 0x2b, 0x84, 0x9a, 0x22, 0xd6, 0xa1, 0x07, 0xba,
+    0xcb, 0x1a, 0xa9, 0x5a, 0x19, 0x4a, 0x95, 0x24, 0x55, 0xda, 0xbf, 0x4c, 0x03, 0x12, 0x80, 0xbf,
+    0xa2, 0x91, 0xd0, 0xb0, 0x31, 0x4e, 0x03, 0x6a, 0x02, 0x2e, 0xc8, 0x05, 0x0d, 0x01, 0x0f, 0xc7,
+    0x60, 0x9d, 0xc2, 0x36, 0xc0, 0xf9, 0x62, 0x10, 0x4d, 0x51, 0x4d, 0x3c, 0xca, 0xc9, 0x17, 0xa3,
+    0x67, 0x17, 0x24, 0x18, 0x7f, 0x0b, 0xc6, 0xdd, 0x24, 0xcb, 0x19, 0x5e, 0x58, 0x48, 0x77, 0x69,
+    0x0b, 0xbc, 0xea, 0x14, 0xa1, 0xf6, 0x8a, 0xb0, 0xd5, 0xce, 0xab, 0x15, 0x7a, 0x20, 0xa9, 0x56,
+    0x30, 0x92, 0xce, 0xa3, 0x26, 0x91, 0xce, 0xe3, 0x89, 0x63, 0xae, 0x78, 0xc8, 0x78, 0x1c, 0xfa,
+    0x25, 0xda, 0xd6, 0xcc, 0xa8, 0xc5, 0x1c, 0x28, 0x0d, 0x9c, 0x1e, 0xa9, 0x5d, 0x3e, 0x1b, 0x5d,
+    0xd5, 0x9a, 0x46, 0x0f, 0x16, 0x7d, 0x59, 0x18, 0xf5, 0xc8, 0x5b, 0x52, 0x53, 0x26, 0xde, 0xba,
+    0x02, 0xff, 0x5c, 0x83, 0xc1, 0x82, 0x53, 0x10, 0x2e, 0x90, 0xd3, 0x41, 0x25, 0xad, 0x91, 0x5b,
+    0x13, 0x14, 0x8d, 0xa2, 0x27, 0x98, 0x6c, 0x47, 0x90, 0x17, 0xfb, 0x53, 0x77, 0xb2, 0xaa, 0x3f,
+    0x13, 0xec, 0xb6, 0x27, 0x61, 0x30, 0x3f, 0xf5, 0xa1, 0x95, 0x45, 0x8a, 0x7e, 0x43, 0xc1, 0x6f,
+    0x7f, 0x23, 0x53, 0x40, 0xc5, 0x19, 0x09, 0xa1, 0xd4, 0xb5, 0x6c, 0x9a, 0xc4, 0xb4, 0x0d, 0xf5,
+    0x35, 0x87, 0x57, 0xf4, 0x75, 0x3f, 0xfc, 0x90, 0x35, 0x1d, 0xf2, 0x19, 0xa9, 0xfd, 0xf2, 0xb7,
+    0x1f, 0x09, 0x7a, 0x77, 0xa7, 0x46, 0x7a, 0xf8, 0xf5, 0x57, 0xf2, 0x18, 0x42, 0x26, 0x7c, 0x36,
+    0x72, 0xea, 0xa7, 0x24, 0x8d, 0xf0, 0x87, 0x55, 0x34, 0xb1, 0x94, 0x38, 0x88, 0xf3, 0x11, 0x6b,
+    0xca, 0x79, 0x84, 0x6e, 0xd6, 0x4a, 0x34, 0x31, 0x55, 0x81, 0x14, 0x05, 0x64, 0x8f, 0xe8, 0x9a,
+    0x11, 0x47, 0xc2, 0x9b, 0x62, 0xcb, 0x54, 0x07, 0x54, 0x7f, 0x4e, 0x20, 0x0a, 0x0f, 0x52, 0x6f,
+    0x0e, 0x5a, 0x7a, 0x2a, 0xa1, 0x1f, 0xad, 0x9e, 0x38, 0x29, 0x26, 0x83, 0x3f, 0xe6, 0xb5, 0x31,
+    0x11, 0x54, 0xeb, 0x0f, 0xc0, 0x0a, 0x75, 0x66, 0x84, 0x88, 0x43, 0x17, 0x90, 0x06, 0x42, 0x7f,
+    0x4d, 0xb2, 0x44, 0x6a, 0xe4, 0x13, 0x52, 0x37, 0xa4, 0xa9, 0x5e, 0x85, 0x2c, 0x99, 0xe4, 0x2f,
+    0xc5, 0x01, 0xb1, 0x07, 0x7d, 0x0d, 0x58, 0x54, 0x1d, 0x5c, 0x25, 0xae, 0x66, 0x71, 0xe2, 0x5a,
+    0xed, 0x70, 0xcd, 0x5c, 0xd0, 0x71, 0xdb, 0x04, 0xff, 0xdb, 0xed, 0x96, 0xda, 0xae, 0x88, 0x31,
+    0x22, 0x9c, 0x88, 0x1c, 0x23, 0x92, 0x5e, 0x5e, 0xc5, 0x81, 0x5a, 0x94, 0x44, 0x1e, 0x1c, 0x92,
+    0x97, 0x73, 0x21, 0x6a, 0x15, 0x24, 0xea, 0x07, 0x4b, 0xa0, 0xc4, 0x67, 0x4b, 0x72, 0x92, 0x09,
+    0x4a, 0x64, 0xad, 0x98, 0x6b, 0x62, 0xbb, 0x5d, 0x6b, 0xb4, 0xc5, 0xc6, 0x01, 0x81, 0x83, 0x25,
+    0x8e, 0x51, 0x05, 0xaa, 0x0a, 0x08, 0x54, 0xd9, 0xa2, 0x88, 0xe2, 0x5c, 0x76, 0x54, 0x42, 0xe2,
+    0xd0, 0x55, 0x11, 0x41, 0x65, 0x1e, 0xc4, 0xc9, 0x71, 0x09, 0x01, 0xd8, 0x0c, 0x52, 0xfa, 0x84,
+    0xec, 0x55, 0x40, 0x82, 0x07, 0xbe, 0x45, 0x1c, 0x8f, 0x63, 0xcf, 0xfb, 0x12, 0x7a, 0xea, 0xa5,
+    0xab, 0xa9, 0xc3, 0x57, 0xb2, 0x46, 0x51, 0x99, 0x6d, 0x24, 0x41, 0x2e, 0x89, 0x6f, 0xc6, 0xc2,
+    0x61, 0x9c, 0x2c, 0x6b, 0xdf, 0x40, 0xa9, 0x1e, 0x6e, 0x50, 0xab, 0x9b, 0x52, 0x3e, 0x6f, 0xd7,
+    0x9b, 0x6b, 0xe6, 0x8a, 0x47, 0x41, 0x87, 0xa4, 0x1b, 0x54, 0x6a, 0xf4, 0xe2, 0xf9, 0xd3, 0x11,
+    0x70, 0x6f, 0xcf, 0x2e, 0x45, 0x6b, 0xdd, 0xa4, 0x4f, 0xcf, 0xd9, 0xab, 0x4e, 0xa9, 0xe1, 0x5a,
+    0x0d, 0x7b, 0x2b, 0x44, 0x90, 0x5a, 0x72, 0x99, 0xa4, 0xb6, 0x56, 0xec, 0x77, 0x8b, 0x5c, 0x88,
+    0xd5, 0xe4, 0xaf, 0xb2, 0x0d, 0x20, 0x60, 0x5b, 0x34, 0xee, 0xa4, 0xff, 0x02, 0x5c, 0x35, 0x6f,
+    0xad, 0xfb, 0x02, 0x18, 0x9a, 0x76, 0x50, 0x7b, 0x39, 0x2f, 0x36, 0x6e, 0xaf, 0xee, 0x02, 0x16,
+    0xdb, 0x0e, 0xef, 0xd4, 0x9b, 0x77, 0xd1, 0x19, 0x21, 0xd4, 0x5e, 0xc5, 0x95, 0x30, 0x83, 0xb8,
+    0x12, 0x67, 0xaf, 0xf2, 0x3a, 0x98, 0xc0, 0x20, 0xce, 0x5e, 0x25, 0xf9, 0x67, 0x66, 0x44, 0x41,
+    0xf6, 0x2a, 0x4a, 0xdf, 0x04, 0x44, 0x29, 0xf6, 0xaa, 0x09, 0xbe, 0xb2, 0x3d, 0xa4, 0x97, 0x30,
+    0xca, 0x2d, 0x22, 0x73, 0xc9, 0x62, 0xa3, 0x65, 0x98, 0x39, 0xb2, 0x99, 0x1e, 0x57, 0xb1, 0x93,
+    0xe2, 0x7d, 0x08, 0x60, 0x44, 0xef, 0x83, 0x07, 0xc4, 0xe8, 0x6e, 0xab, 0x63, 0x9d, 0x94, 0xab,
+    0x92, 0xdb, 0x12, 0xc9, 0x46, 0x89, 0x64, 0x40, 0x61, 0x3d, 0xa2, 0x36, 0x6c, 0xdd, 0x4f, 0x29,
+    0xe4, 0x28, 0x90, 0x08, 0xad, 0xf0, 0x22, 0xbb, 0xc3, 0xde, 0x34, 0xf2, 0x99, 0x95, 0xd4, 0xbd,
+    0x50, 0xc4, 0xbc, 0x84, 0x66, 0xd8, 0x5d, 0x85, 0xab, 0x91, 0xa8, 0x62, 0x41, 0x66, 0xfd, 0x9a,
+    0x87, 0x5f, 0xa7, 0x67, 0x54, 0x1f, 0xbd, 0x15, 0x88, 0x6e, 0xad, 0x6f, 0x5e, 0x67, 0xb2, 0x26,
+    0xf4, 0xc1, 0x80, 0x26, 0xbf, 0x45, 0x81, 0xa6, 0x1c, 0xba, 0x5a, 0xdb, 0x38, 0xb2, 0xca, 0xf0,
+    0x0e, 0xed, 0x45, 0x9e, 0x37, 0x21, 0x11, 0xa7, 0x58, 0x86, 0x01, 0x62, 0xad, 0x82, 0x72, 0xb5,
+    0xc9, 0x59, 0xb5, 0x45, 0x77, 0x93, 0x24, 0xaf, 0x32, 0x98, 0x36, 0x0e, 0x2b, 0x12, 0xe8, 0xac,
+    0xc7, 0x0c, 0x9d, 0x4d, 0x45, 0xae, 0x53, 0x82, 0xf5, 0xb6, 0x44, 0x27, 0x4d, 0x4d, 0xb3, 0xce,
+    0xce, 0x7a, 0x78, 0x2b, 0xab, 0xdf, 0x1a, 0x0a, 0x6b, 0xee, 0x48, 0xbb, 0x03, 0x17, 0xe0, 0x82,
+    0xea, 0xd5, 0x61, 0x73, 0x0a, 0x78, 0xc9, 0x98, 0x4d, 0xf0, 0xae, 0x26, 0x6e, 0x23, 0x04, 0xf9,
+    0x24, 0x8c, 0x7d, 0xd8, 0x9d, 0xc0, 0x6e, 0xd8, 0x77, 0xa7, 0x33, 0xde, 0x28, 0xa4, 0x36, 0x29,
+    0x8d, 0x88, 0xb4, 0xa9, 0xec, 0xbd, 0x64, 0x0b, 0x31, 0x12, 0x29, 0xbc, 0x18, 0xd5, 0x68, 0x2f,
+    0xc4, 0x96, 0x36, 0xe4, 0xf5, 0x7d, 0x30, 0x92, 0x6e, 0x0d, 0x43, 0x7d, 0xad, 0x87, 0xc9, 0x9e,
+    0x1a, 0xa5, 0x68, 0x83, 0x84, 0xba, 0x5b, 0x1c, 0xbc, 0xde, 0xd3, 0x89, 0x3d, 0x8f, 0x20, 0x46,
+    0xc8, 0xb0, 0xe8, 0xef, 0xbe, 0x36, 0x89, 0xfc, 0x06, 0x64, 0x2c, 0x07, 0xe2, 0x44, 0xb5, 0x6e,
+    0xb7, 0xd7, 0x05, 0xec, 0xed, 0x08, 0x36, 0x25, 0xbc, 0x0e, 0xe4, 0x34, 0xda, 0x73, 0xba, 0xa8,
+    0x5f, 0x88, 0x9b, 0x61, 0x86, 0xa8, 0x15, 0x3f, 0x6f, 0x89, 0x89, 0x8b, 0xdc, 0xae, 0xa7, 0xaa,
+    0xc4, 0x82, 0x8a, 0x29, 0xb5, 0x54, 0xc1, 0x0d, 0x79, 0xf5, 0x46, 0x23, 0x3e, 0xdc, 0xca, 0x07,
+    0xc8, 0xea, 0x2f, 0xb2, 0x2a, 0xfe, 0x64, 0x24, 0x58, 0x50, 0xdb, 0xe5, 0x2b, 0x98, 0x5b, 0x53,
+    0x01, 0x99, 0xf6, 0x9e, 0xc8, 0xb1, 0xbb, 0xed, 0xfb, 0xb5, 0x77, 0xc2, 0xbd, 0x08, 0xc4, 0xb6,
+    0x5c, 0x94, 0x7b, 0xa2, 0xec, 0x0c, 0x78, 0x6e, 0x28, 0x26, 0xf1, 0x31, 0xd1, 0xd8, 0x1c, 0xbe,
+    0x36, 0x0b, 0x6f, 0x63, 0x14, 0x33, 0x56, 0x4e, 0x8e, 0x6b, 0xc3, 0xb6, 0x13, 0x54, 0xbd, 0x5e,
+    0xd3, 0xee, 0xa0, 0xb9, 0x9b, 0xcc, 0x4d, 0x37, 0x58, 0xee, 0xc5, 0x8e, 0x3c, 0x0f, 0x52, 0xa9,
+    0xd4, 0x91, 0x7d, 0x03, 0xc0, 0xda, 0x3f, 0x0a, 0xef, 0x57, 0xe6, 0x16, 0x61, 0xdc, 0x13, 0x74,
+    0x76, 0xc0, 0x0e, 0xba, 0x09, 0x84, 0x85, 0x8d, 0x4d, 0x36, 0xb3, 0xc8, 0xb3, 0xf2, 0x1a, 0x7a,
+    0x3f, 0x7a, 0xab, 0x21, 0x6f, 0x5f, 0x29, 0xce, 0x5e, 0x37, 0xab, 0xbb, 0xc2, 0x8c, 0x2f, 0x91,
+    0x94, 0x48, 0x07, 0x30, 0x30, 0xac, 0xaa, 0x92, 0x4f, 0x2c, 0xc1, 0x84, 0x9e, 0xa5, 0x0a, 0x1e,
+    0xc3, 0xff, 0x35, 0xaa, 0x73, 0x2b, 0x66, 0x7f, 0xdd, 0x94, 0xf4, 0x8a, 0xf4, 0x6f, 0x5b, 0xe0,
+    0x57, 0x60, 0xc4, 0x09, 0x82, 0x79, 0xd1, 0xb7, 0xde, 0x25, 0x6d, 0x94, 0x34, 0xfc, 0x6e, 0x3b,
+    0x37, 0xb4, 0xa9, 0x99, 0x11, 0xb8, 0x30, 0xef, 0xad, 0xa9, 0x61, 0x25, 0xc9, 0x45, 0xe6, 0x56,
+    0x41, 0x79, 0x7a, 0x91, 0xbf, 0x35, 0xb0, 0x31, 0xc3, 0xc8, 0x15, 0xd5, 0x92, 0x7a, 0x5a, 0x95,
+    0x0c, 0x23, 0x7b, 0xbc, 0x6f, 0x04, 0x31, 0x8d, 0x65, 0xb3, 0x7d, 0xe7, 0x4f, 0x7c, 0x77, 0x4f,
+    0x54, 0xf5, 0x7c, 0xbd, 0x6d, 0x69, 0xad, 0x9a, 0xd2, 0x65, 0x4e, 0x98, 0xcb, 0xa5, 0xae, 0x8e,
+    0x81, 0xe5, 0xc8, 0x42, 0x34, 0xc8, 0x9e, 0xf0, 0x96, 0x94, 0x74, 0x25, 0x1c, 0x56, 0xd8, 0x72,
+    0x75, 0xb5, 0x77, 0x28, 0x6c, 0x19, 0xa5, 0x9e, 0x5a, 0xe6, 0x98, 0xb8, 0x56, 0x5a, 0xd1, 0xca,
+    0x15, 0xb0, 0xe4, 0x1f, 0xff, 0x2d, 0x83, 0x6b, 0xe6, 0x7f, 0x58, 0xac, 0x63, 0xdd, 0x5d, 0xa0,
+    0x2a, 0x4c, 0x59, 0xa9, 0x4e, 0x05, 0x92, 0xd4, 0x47, 0x22, 0x1b, 0xf5, 0x56, 0xd7, 0x76, 0x75,
+    0x59, 0xb7, 0x8a, 0xbe, 0x1a, 0x67, 0xc0, 0x66, 0xed, 0x40, 0xb6, 0xc2, 0x5e, 0xcc, 0x61, 0x15,
+    0xc2, 0x9e, 0x3e, 0xd2, 0x2c, 0xc1, 0x10, 0x45, 0xae, 0x23, 0xb2, 0x8a, 0x2a, 0xe1, 0x33, 0x77,
+    0x3a, 0x97, 0xc9, 0x4f, 0x35, 0x42, 0x3d, 0x26, 0x9f, 0x98, 0x67, 0x0e, 0xa8, 0x0d, 0x7f, 0x81,
+    0xe5, 0x66, 0x90, 0x4d, 0x52, 0x97, 0x92, 0xa2, 0xcf, 0x59, 0x15, 0x1e, 0xb7, 0x3f, 0x0a, 0xde,
+    0x6c, 0xca, 0x3a, 0xcc, 0x63, 0x7a, 0xb3, 0xd8, 0x26, 0x11, 0xa0, 0xa0, 0xae, 0xd8, 0x1b, 0x6e,
+    0x10, 0x2a, 0xbd, 0x12, 0xd2, 0x43, 0x06, 0x83, 0x01, 0xe9, 0xa2, 0x0e, 0x65, 0x8f, 0x10, 0x85,
+    0x06, 0x19, 0xa7, 0xdc, 0x86, 0x88, 0x3c, 0xa6, 0x29, 0x55, 0x58, 0x5f, 0xf7, 0x23, 0x1e, 0x06,
+    0xfe, 0x74, 0x78, 0x2c, 0xf9, 0xc0, 0x3f, 0xd9, 0x90, 0x0d, 0xe4, 0xa3, 0xb7, 0x7a, 0xf6, 0xdb,
+    0xd7, 0x87, 0x99, 0xb2, 0x8c, 0x26, 0xc5, 0x5d, 0x34, 0x4c, 0x6c, 0x9f, 0x00, 0x3a, 0xf2, 0x03,
+    0xd1, 0x18, 0x9f, 0x5c, 0x66, 0x90, 0xa5, 0x40, 0xeb, 0xd0, 0xe5, 0x38, 0xdb, 0xcb, 0x6e, 0x3b,
+    0xb2, 0x13, 0x69, 0x18, 0x75, 0x54, 0x2a, 0x33, 0x1e, 0x98, 0xfc, 0xd7, 0x9f, 0x7f, 0xfe, 0x3b,
+    0x39, 0xd6, 0x8d, 0x42, 0x12, 0xa2, 0xf5, 0xa7, 0x7f, 0x93, 0x13, 0x37, 0x4a, 0x46, 0xd7, 0x8a,
+    0xf5, 0x20, 0xa2, 0x57, 0xab, 0xed, 0xc2, 0xa0, 0xf0, 0xec, 0xea, 0xfc, 0x29, 0xc8, 0x27, 0x9d,
+    0xf5, 0xae, 0xfc, 0x33, 0xa3, 0x28, 0x05, 0xff, 0x3a, 0x17, 0x5c, 0x6d, 0x65, 0x2f, 0x79, 0x5d,
+    0x30, 0x6f, 0x16, 0x6c, 0x42, 0x65, 0x8e, 0xcb, 0x68, 0x94, 0xd1, 0xae, 0xb2, 0x47, 0xc7, 0x85,
+    0x64, 0x9c, 0x62, 0x66, 0x3a, 0xd7, 0x52, 0xc7, 0xc4, 0x14, 0x44, 0x39, 0x46, 0x8f, 0x54, 0x35,
+    0x7b, 0x4c, 0x0e, 0x5a, 0x7f, 0xab, 0xcc, 0x11, 0xa9, 0xd9, 0x94, 0x36, 0x96, 0x48, 0x6b, 0x3d,
+    0x32, 0x74, 0x15, 0x9b, 0x90, 0xe5, 0xbd, 0x4c, 0xc1, 0x08, 0xf5, 0x95, 0x85, 0x4d, 0x42, 0x37,
+    0x2f, 0x32, 0x14, 0x17, 0x10, 0xb5, 0x5c, 0x63, 0x69, 0xe4, 0xe9, 0xd3, 0x1d, 0x40, 0x63, 0x32,
+    0x66, 0x2d, 0x33, 0xda, 0x4d, 0x6d, 0x62, 0x68, 0xad, 0xbb, 0x5b, 0x8f, 0x56, 0x9c, 0xde, 0x6f,
+    0x4c, 0xd4, 0xd5, 0xf1, 0x7e, 0x79, 0x7a, 0x5e, 0x12, 0xc6, 0xb3, 0x07, 0xe8, 0x00, 0xb6, 0xf6,
+    0x1c, 0x48, 0x1f, 0x88, 0x92, 0x8f, 0x3f, 0xce, 0x06, 0x47, 0xfc, 0xde, 0x82, 0x9e, 0x5c, 0x91,
+    0x02, 0x1c, 0xf4, 0x73, 0x86, 0x27, 0x87, 0xf2, 0x9c, 0x9c, 0x4e, 0x20, 0x1d, 0xc1, 0x70, 0x06,
+    0x29, 0xb7, 0xc3, 0x50, 0xe9, 0x79, 0x20, 0xa2, 0x9b, 0x50, 0x4d, 0xe3, 0xc6, 0x45, 0xce, 0x91,
+    0x97, 0x1e, 0x7c, 0x80, 0x71, 0x88, 0x53, 0xb5, 0x76, 0x28, 0x66, 0xa8, 0x37, 0x72, 0x07, 0x1b,
+    0xeb, 0xeb, 0x05, 0xea, 0xba, 0x40, 0x72, 0xbe, 0xdf, 0xef, 0xc8, 0x8b, 0xb4, 0xfd, 0x8e, 0xfc,
+    0x9f, 0x2a, 0xfc, 0x0f, 0x23, 0xc6, 0x9f, 0xcd, 0x6c, 0x41, 0x00, 0x00,
+};
+
+const WebAsset WEB_ASSETS[] = {
+    {"/script.js", "application/javascript", WEB_ASSET_SCRIPT_JS, sizeof(WEB_ASSET_SCRIPT_JS), 0, "\"f61f27bd17de5462\""},
+    {"/style.css", "text/css", WEB_ASSET_STYLE_CSS, sizeof(WEB_ASSET_STYLE_CSS), 4015, "\"9f944c966cba6c5a\""},
+    {"/index.html", "text/html", WEB_ASSET_INDEX_HTML, sizeof(WEB_ASSET_INDEX_HTML), 13207, "\"b3b9774e890654ed\""},
+    {"/settings.html", "text/html", WEB_ASSET_SETTINGS_HTML, sizeof(WEB_ASSET_SETTINGS_HTML), 16748, "\"bbb61da446760804\""},
+};
+
+const uint8_t WEB_ASSET_COUNT = 4;
@@ -3,93 +3,154 @@
 #include <AsyncTCP.h>
 #include <ESPAsyncWebServer.h>
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "preview.h"
+
 // LED array from leds.h
 extern CRGB leds[];
-extern const int NUM_LEDS;
-extern const int NUM_SEGMENTS;
-extern const int LEDS_PER_SEGMENT;
-extern const int COLON_LEDS;
 
 // ============================================================================
 // WebSocket LED Preview
 // ============================================================================
-// Provides real-time LED state streaming to web clients via WebSocket.
-// Clients receive binary data with averaged RGB values per segment.
+// Streams the LED state to web clients, change-driven: a keyframe when a
+// client connects, then only the units that changed (see preview.h for the
+// message format). A static display sends nothing.
+//
+// Endpoints:
+//   - /ws/leds:      29 segments (average RGB per segment, colon last)
+//   - /ws/leds-full: all 282 LEDs, same protocol (optional, nothing is
+//                    computed while it has no clients)
 //
-// Protocol:
-//   - Endpoint: /ws/leds
-//   - Format: Binary, 29 segments × 3 bytes (RGB) = 87 bytes
-//   - Update rate: ~20 FPS (50ms interval)
+// The frame is sampled every PREVIEW_INTERVAL_MS and encoded once per
+// endpoint into reference-counted buffers (one delta, at most one keyframe)
+// that every client's queue shares. Each client is paced on its own (see
+// "Per-Client Pacing" in preview.h): a new, slow or lagging client gets a
+// keyframe of the newest frame, the others the shared delta. A client that
+// asks with "key" makes every client resync.
 //
 // Segment layout:
 //   - Segments 0-27: 4 digits × 7 segments each (10 LEDs per segment)
 //   - Segment 28: Colon (2 LEDs at index 140-141)
 // ============================================================================
-
 AsyncWebSocket ledSocket("/ws/leds");
+AsyncWebSocket ledFullSocket("/ws/leds-full");
+
+PreviewEncoder<NUM_SEGMENTS> segmentPreview;
+PreviewEncoder<NUM_LEDS> ledPreview;
+PreviewClientState segmentPreviewClients[PREVIEW_MAX_CLIENTS];
+PreviewClientState ledPreviewClients[PREVIEW_MAX_CLIENTS];
 
-// WebSocket event handler
+// Set from the AsyncTCP task, consumed by loopWebSocket()
+std::atomic<bool> segmentKeyframeWanted(false);
+std::atomic<bool> ledKeyframeWanted(false);
+
+// WebSocket event handler (both endpoints)
 void onWsEvent(AsyncWebSocket *server, AsyncWebSocketClient *client,
                AwsEventType type, void *arg, uint8_t *data, size_t len) {
+  std::atomic<bool> &keyframeWanted =
+      (server == &ledFullSocket) ? ledKeyframeWanted : segmentKeyframeWanted;
   if (type == WS_EVT_CONNECT) {
-    Serial.printf("WebSocket client #%u connected\n", client->id());
+    Serial.printf("WebSocket client #%u connected (%s)\n", client->id(),
+                  server->url());
+    keyframeWanted = true;
   } else if (type == WS_EVT_DISCONNECT) {
     Serial.printf("WebSocket client #%u disconnected\n", client->id());
+  } else if (type == WS_EVT_DATA && len == 3 && memcmp(data, "key", 3) == 0) {
+    keyframeWanted = true; // Client missed a message
   }
 }
 
-// Send LED data to all connected WebSocket clients
-// Format: Binary data with 29 segments × 3 bytes (RGB average per segment)
-void sendLedPreview() {
-  if (ledSocket.count() == 0)
-    return; // No clients connected
-
-  // Send averaged RGB per segment (29 segments × 3 bytes = 87 bytes)
-  uint8_t buffer[29 * 3];
+// Shared message buffer, freed once the last client queue let go of it
+inline AsyncWebSocketSharedBuffer sharePreviewMessage(const uint8_t *message,
+                                                      uint16_t length) {
+  return std::make_shared<std::vector<uint8_t>>(message, message + length);
+}
 
-  for (int seg = 0; seg < 28; seg++) {
-    // Calculate start index for this segment
-    int start = seg * 10;
-    if (seg >= 14)
-      start += 2; // Skip colon LEDs after segment 13
+// Encode the frame once and give every client what its pacing allows
+template <uint16_t UNITS>
+void streamPreview(AsyncWebSocket &socket, PreviewEncoder<UNITS> &encoder,
+                   PreviewClientState *clients,
+                   std::atomic<bool> &keyframeWanted, const uint8_t *rgb) {
+  static uint8_t message[PreviewEncoder<UNITS>::MESSAGE_BYTES];
+  static uint8_t keyframe[PreviewEncoder<UNITS>::KEYFRAME_BYTES];
+  uint16_t length = encoder.encode(rgb, message);
+  if (keyframeWanted.exchange(false)) {
+    resyncPreviewClients(clients);
+  }
 
-    // Average the 10 LEDs in this segment
-    uint32_t r = 0, g = 0, b = 0;
-    for (int i = 0; i < 10; i++) {
-      r += leds[start + i].r;
-      g += leds[start + i].g;
-      b += leds[start + i].b;
+  AsyncWebSocketSharedBuffer deltaBuffer, keyframeBuffer;
+  uint32_t now = millis();
+  for (AsyncWebSocketClient &client : socket.getClients()) {
+    if (client.status() != WS_CONNECTED) {
+      continue;
+    }
+    PreviewClientState *state = previewClient(clients, client.id());
+    if (!state) {
+      continue; // More clients than pacing slots
+    }
+    switch (pacePreviewClient(*state, client.queueLen(), now, length > 0)) {
+    case PREVIEW_SEND_DELTA:
+      if (!deltaBuffer) {
+        deltaBuffer = sharePreviewMessage(message, length);
+      }
+      client.binary(deltaBuffer);
+      state->bytes += length;
+      break;
+    case PREVIEW_SEND_KEYFRAME:
+      if (!keyframeBuffer) {
+        keyframeBuffer =
+            sharePreviewMessage(keyframe, encoder.keyframe(keyframe));
+      }
+      client.binary(keyframeBuffer);
+      state->bytes += keyframeBuffer->size();
+      break;
+    case PREVIEW_SKIP:
+      break;
     }
-    buffer[seg * 3] = r / 10;
-    buffer[seg * 3 + 1] = g / 10;
-    buffer[seg * 3 + 2] = b / 10;
   }
+  releasePreviewClients(clients);
+}
 
-  // Colon segment (segment 28, at LED index 140-141)
-  buffer[28 * 3] = (leds[140].r + leds[141].r) / 2;
-  buffer[28 * 3 + 1] = (leds[140].g + leds[141].g) / 2;
-  buffer[28 * 3 + 2] = (leds[140].b + leds[141].b) / 2;
-
-  ledSocket.binaryAll(buffer, sizeof(buffer));
+// Sample the LEDs and stream them to the connected clients
+void sendLedPreview() {
+  if (ledSocket.count() > 0) {
+    uint8_t rgb[NUM_SEGMENTS * 3];
+    previewSegments(leds, rgb);
+    streamPreview(ledSocket, segmentPreview, segmentPreviewClients,
+                  segmentKeyframeWanted, rgb);
+  }
+  if (ledFullSocket.count() > 0) {
+    streamPreview(ledFullSocket, ledPreview, ledPreviewClients,
+                  ledKeyframeWanted, (const uint8_t *)leds);
+  }
 }
 
-// Register WebSocket handler with AsyncWebServer
+// Register WebSocket handlers with AsyncWebServer
 void setupWebSocket(AsyncWebServer &server) {
   Serial.println("=== WebSocket Setup ===");
   ledSocket.onEvent(onWsEvent);
+  ledFullSocket.onEvent(onWsEvent);
   server.addHandler(&ledSocket);
-  Serial.println("  Endpoint: /ws/leds");
-  Serial.println("  Protocol: Binary (87 bytes per frame)");
-  Serial.println("  Update rate: ~20 FPS");
+  server.addHandler(&ledFullSocket);
+  Serial.println("  Endpoints: /ws/leds (segments), /ws/leds-full (LEDs)");
+  Serial.printf("  Protocol: v%d, keyframe + deltas (%u / %u byte keyframes)\n",
+                PREVIEW_VERSION, PreviewEncoder<NUM_SEGMENTS>::KEYFRAME_BYTES,
+                PreviewEncoder<NUM_LEDS>::KEYFRAME_BYTES);
+  Serial.printf("  Sampling: every %d ms, only changes are sent\n",
+                PREVIEW_INTERVAL_MS);
   Serial.println("=======================\n");
 }
 
 // Call this from the main loop to send LED updates
 void loopWebSocket() {
   static unsigned long lastWsUpdate = 0;
-  if (millis() - lastWsUpdate > 50) { // ~20 FPS for WebSocket
+  if (millis() - lastWsUpdate >= PREVIEW_INTERVAL_MS) {
     lastWsUpdate = millis();
     sendLedPreview();
     ledSocket.cleanupClients();
+    ledFullSocket.cleanupClients();
   }
 }